@@ -0,0 +1,113 @@
+#include "bench_runner.h"
+#ifdef CP_PERF
+#include "misc/perf_counters.hpp"
+#endif
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+
+using namespace std;
+
+BenchRunner::BenchRunner(int argc, char** argv) : scale(1.0), benches_run(0) {
+    if (const char* env = getenv("BENCH_SCALE"))
+        scale = atof(env);
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg.rfind("--scale=", 0) == 0)
+            scale = atof(arg.c_str() + 8);
+    }
+    if (scale <= 0)
+        scale = 1.0;
+    cout << "⏱️  Benchmark runner initialized (scale: " << scale << ")\n";
+}
+
+void BenchRunner::set_module(const string& module) {
+    current_module = module;
+    cout << "\n=== Benchmarking " << module << " ===\n";
+}
+
+long long BenchRunner::scaled(long long n) const {
+    return max(1LL, (long long)llround(n * scale));
+}
+
+double BenchRunner::run(const string& bench_name, long long ops, function<void()> body) {
+    return run_timed(bench_name, ops, body, true);
+}
+
+double BenchRunner::run_external(const string& bench_name, long long ops, function<void()> body) {
+    return run_timed(bench_name, ops, body, false);
+}
+
+double BenchRunner::run_timed(const string& bench_name, long long ops, const function<void()>& body, bool perf_line) {
+    benches_run++;
+    cout << "Bench: " << bench_name << " ... ";
+    cout.flush();
+
+#ifdef CP_PERF
+    PerfSample perf_start = PerfCounters::thread_local_instance().read();
+    auto events_start = perf_event_counts();
+#endif
+    auto start = chrono::high_resolution_clock::now();
+    body();
+    auto end = chrono::high_resolution_clock::now();
+#ifdef CP_PERF
+    PerfSample perf = PerfCounters::thread_local_instance().read() - perf_start;
+    string events = perf_event_delta(events_start, perf_event_counts(), ops);
+#endif
+
+    double seconds = chrono::duration<double>(end - start).count();
+    cout << fixed << setprecision(2) << seconds * 1e3 << " ms";
+    if (ops > 0)
+        cout << " (" << setprecision(2) << seconds * 1e9 / ops << " ns/op)";
+    cout << "\n";
+    cout.unsetf(ios::fixed);
+#ifdef CP_PERF
+    if (perf_line) {
+        cout << "   perf: " << perf_format(perf, ops) << "\n";
+        if (!events.empty())
+            cout << "   events: " << events << "\n";
+    }
+#else
+    (void)perf_line;
+#endif
+    return seconds;
+}
+
+double BenchRunner::run_bytes(const string& bench_name, long long bytes, function<void()> body) {
+    benches_run++;
+    cout << "Bench: " << bench_name << " ... ";
+    cout.flush();
+
+#ifdef CP_PERF
+    PerfSample perf_start = PerfCounters::thread_local_instance().read();
+    auto events_start = perf_event_counts();
+#endif
+    auto start = chrono::high_resolution_clock::now();
+    body();
+    auto end = chrono::high_resolution_clock::now();
+#ifdef CP_PERF
+    PerfSample perf = PerfCounters::thread_local_instance().read() - perf_start;
+    string events = perf_event_delta(events_start, perf_event_counts());
+#endif
+
+    double seconds = chrono::duration<double>(end - start).count();
+    cout << fixed << setprecision(2) << seconds * 1e3 << " ms";
+    if (seconds > 0)
+        cout << " (" << setprecision(2) << bytes / seconds / 1e9 << " GB/s)";
+    cout << "\n";
+    cout.unsetf(ios::fixed);
+#ifdef CP_PERF
+    cout << "   perf: " << perf_format(perf) << "\n";
+    if (!events.empty())
+        cout << "   events: " << events << "\n";
+#endif
+    return seconds;
+}
+
+void BenchRunner::summary() {
+    cout << "\n=== Benchmark Summary for " << current_module << " ===\n";
+    cout << "Benchmarks run: " << benches_run << "\n";
+#ifdef CP_PERF
+    perf_report(cout);
+#endif
+}
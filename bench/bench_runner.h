@@ -0,0 +1,39 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Keeps the optimizer from discarding a computed value.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+class BenchRunner {
+private:
+    string current_module;
+    double scale;
+    int benches_run;
+
+    double run_timed(const string& bench_name, long long ops, const function<void()>& body, bool perf);
+
+public:
+    // Reads the size multiplier from `--scale=X` or the BENCH_SCALE environment variable.
+    BenchRunner(int argc, char** argv);
+
+    void set_module(const string& module);
+
+    // n multiplied by the scale factor, at least 1.
+    long long scaled(long long n) const;
+
+    // Runs `body` once and reports wall time and ns per operation.
+    double run(const string& bench_name, long long ops, function<void()> body);
+
+    // Same, for a body that runs another process (system()): the perf
+    // counters only see this one, so no perf line is printed.
+    double run_external(const string& bench_name, long long ops, function<void()> body);
+
+    // Same, reporting throughput in GB/s for a body that processes `bytes` bytes.
+    double run_bytes(const string& bench_name, long long bytes, function<void()> body);
+
+    void summary();
+};
@@ -0,0 +1,41 @@
+// Writes a scaled input for one of the data-structures CSES drivers to stdout.
+//
+//   cses_gen cses1648 --n=10000000 --q=10000000 --updates=30 --range=64 --seed=7 > big.in
+//
+// --updates is the percentage of update operations, --range bounds the
+// length of every range (0 = two uniform ends) and --max-value the values.
+#include "cses_inputs.h"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cerr << "usage: " << argv[0] << " <problem> [--n=N] [--q=Q] [--updates=P] [--range=L] [--max-value=V] [--seed=S]\n"
+             << "problems:";
+        for (auto& p : cses_generated_problems()) cerr << " " << p;
+        cerr << "\n";
+        return 2;
+    }
+    CsesInputSpec spec;
+    for (int i = 2; i < argc; i++) {
+        string arg = argv[i];
+        auto value = [&](const string& key) { return arg.rfind(key, 0) == 0 ? arg.substr(key.size()) : string(); };
+        if (auto v = value("--n="); !v.empty()) spec.n = stoi(v);
+        else if (auto v = value("--q="); !v.empty()) spec.q = stoll(v);
+        else if (auto v = value("--updates="); !v.empty()) spec.update_percent = stoi(v);
+        else if (auto v = value("--range="); !v.empty()) spec.max_range = stoi(v);
+        else if (auto v = value("--max-value="); !v.empty()) spec.max_value = stoi(v);
+        else if (auto v = value("--seed="); !v.empty()) spec.seed = stoull(v);
+        else {
+            cerr << "unknown option " << arg << "\n";
+            return 2;
+        }
+    }
+    if (spec.n < 1 || spec.q < 0 || spec.update_percent < 0 || spec.update_percent > 100 || spec.max_value < 1) {
+        cerr << "need n >= 1, q >= 0, 0 <= updates <= 100, max-value >= 1\n";
+        return 2;
+    }
+    if (!write_cses_input(argv[1], spec, stdout)) {
+        cerr << "unknown problem " << argv[1] << "\n";
+        return 2;
+    }
+    return 0;
+}
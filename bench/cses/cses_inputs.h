@@ -0,0 +1,113 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Synthetic inputs for the data-structures CSES drivers
+// (test/data-structures/cses*), in the judge's format but at any size.
+struct CsesInputSpec {
+    int n = 200000;
+    long long q = 200000;
+    int update_percent = 50;   // share of update operations; cses1647 has none
+    int max_range = 0;         // longest range of an operation, 0 = unbounded
+    int max_value = 1000000000;
+    uint64_t seed = 1;
+};
+
+namespace cses_inputs_detail {
+
+// Buffered decimal writer; iostreams dominate the cost at 10^7 lines.
+class Writer {
+public:
+    explicit Writer(FILE* out) : out(out) {}
+    ~Writer() { flush(); }
+
+    Writer& num(long long v) {
+        if (buf.size() - len < 24) flush();
+        if (v < 0) buf[len++] = '-', v = -v;
+        char tmp[20];
+        int k = 0;
+        do tmp[k++] = char('0' + v % 10), v /= 10;
+        while (v);
+        while (k) buf[len++] = tmp[--k];
+        return *this;
+    }
+    Writer& put(char c) {
+        if (len == buf.size()) flush();
+        buf[len++] = c;
+        return *this;
+    }
+    void flush() {
+        fwrite(buf.data(), 1, len, out);
+        len = 0;
+    }
+
+private:
+    FILE* out;
+    array<char, 1 << 16> buf;
+    size_t len = 0;
+};
+
+}  // namespace cses_inputs_detail
+
+// Problems the generator knows; a driver variant such as "cses1651_2" reads
+// the input of the problem before the underscore.
+inline const vector<string>& cses_generated_problems() {
+    static const vector<string> problems = {"cses1647", "cses1648", "cses1649", "cses1651", "cses1736"};
+    return problems;
+}
+
+inline string cses_base_problem(const string& driver) { return driver.substr(0, driver.find('_')); }
+
+// Writes the input of `problem` to out; false if the problem is unknown.
+inline bool write_cses_input(const string& problem, const CsesInputSpec& spec, FILE* out) {
+    string id = cses_base_problem(problem);
+    if (find(cses_generated_problems().begin(), cses_generated_problems().end(), id) == cses_generated_problems().end())
+        return false;
+
+    mt19937_64 rng(spec.seed);
+    auto uniform = [&](long long lo, long long hi) { return lo + (long long)(rng() % uint64_t(hi - lo + 1)); };
+    const int n = spec.n;
+    // 1-based [a, b]: two uniform ends like the judge's tests, or a bounded length.
+    auto range = [&]() {
+        long long a = uniform(1, n), b;
+        if (spec.max_range > 0) {
+            b = min<long long>(n, a + uniform(0, spec.max_range - 1));
+        } else {
+            b = uniform(1, n);
+            if (a > b) swap(a, b);
+        }
+        return pair{a, b};
+    };
+    // Polynomial Queries caps values at 10^6 so the sums stay in 64 bits longer.
+    const long long max_value = id == "cses1736" ? min(spec.max_value, 1000000) : spec.max_value;
+    auto update = [&]() { return (long long)uniform(0, 99) < spec.update_percent; };
+
+    cses_inputs_detail::Writer w(out);
+    w.num(n).put(' ').num(spec.q).put('\n');
+    for (int i = 0; i < n; i++) w.num(uniform(1, max_value)).put(i + 1 < n ? ' ' : '\n');
+    for (long long i = 0; i < spec.q; i++) {
+        if (id == "cses1647") {
+            auto [a, b] = range();
+            w.num(a).put(' ').num(b);
+        } else if (id == "cses1648" || id == "cses1649") {
+            if (update()) {
+                w.num(1).put(' ').num(uniform(1, n)).put(' ').num(uniform(1, max_value));
+            } else {
+                auto [a, b] = range();
+                w.num(2).put(' ').num(a).put(' ').num(b);
+            }
+        } else if (id == "cses1651") {
+            if (update()) {
+                auto [a, b] = range();
+                w.num(1).put(' ').num(a).put(' ').num(b).put(' ').num(uniform(1, max_value));
+            } else {
+                w.num(2).put(' ').num(uniform(1, n));
+            }
+        } else {   // cses1736
+            auto [a, b] = range();
+            w.num(update() ? 1 : 2).put(' ').num(a).put(' ').num(b);
+        }
+        w.put('\n');
+    }
+    return true;
+}
@@ -0,0 +1,108 @@
+// Runs the data-structures CSES drivers on generated inputs of growing n
+// with a fixed number of operations and plots ns per operation, so cache
+// cliffs in the segment trees and Fenwick trees show up as steps.
+//
+//   cses_scaling cses1648=path/to/driver ... [--q=Q] [--min-n=N] [--max-n=N]
+//                [--updates=P] [--range=L] [--csv=file] [--scale=X]
+//
+// Each point runs the driver twice, with q operations and with none, and
+// charges only the difference to the operations: reading the array and
+// starting the process are not part of ns/op. The `scaling` CMake target
+// passes every driver; q defaults to 2^20 times the bench scale.
+#include "../bench_runner.h"
+#include "cses_inputs.h"
+
+struct Driver {
+    string name, path;
+};
+
+struct Point {
+    string problem;
+    int n;
+    long long q;
+    double seconds, ns_per_op;
+};
+
+static double run_driver(BenchRunner& bench, const Driver& d, const CsesInputSpec& spec, const string& input) {
+    FILE* f = fopen(input.c_str(), "wb");
+    if (!f || !write_cses_input(d.name, spec, f)) {
+        cerr << "cannot write " << input << "\n";
+        exit(1);
+    }
+    fclose(f);
+    string cmd = "\"" + d.path + "\" < \"" + input + "\" > /dev/null";
+    string label = d.name + " n=" + to_string(spec.n) + " q=" + to_string(spec.q);
+    int status = 0;
+    double seconds = bench.run_external(label, spec.q, [&]() { status = system(cmd.c_str()); });
+    if (status != 0) {
+        cerr << d.name << " exited with status " << status << "\n";
+        exit(1);
+    }
+    return seconds;
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    vector<Driver> drivers;
+    CsesInputSpec spec;
+    spec.q = bench.scaled(1 << 20);
+    long long min_n = 1 << 10, max_n = 1 << 22;
+    string csv;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        auto value = [&](const string& key) { return arg.rfind(key, 0) == 0 ? arg.substr(key.size()) : string(); };
+        if (auto v = value("--q="); !v.empty()) spec.q = stoll(v);
+        else if (auto v = value("--min-n="); !v.empty()) min_n = stoll(v);
+        else if (auto v = value("--max-n="); !v.empty()) max_n = stoll(v);
+        else if (auto v = value("--updates="); !v.empty()) spec.update_percent = stoi(v);
+        else if (auto v = value("--range="); !v.empty()) spec.max_range = stoi(v);
+        else if (auto v = value("--csv="); !v.empty()) csv = v;
+        else if (arg.rfind("--", 0) != 0 && arg.find('=') != string::npos)
+            drivers.push_back({arg.substr(0, arg.find('=')), arg.substr(arg.find('=') + 1)});
+    }
+    if (drivers.empty()) {
+        cerr << "usage: " << argv[0] << " <problem>=<driver> ... [--q=Q] [--min-n=N] [--max-n=N] [--updates=P] [--range=L] [--csv=file]\n";
+        return 2;
+    }
+
+    const string input = "cses_scaling.in";
+    vector<Point> points;
+    for (auto& d : drivers) {
+        bench.set_module("CSES scaling - " + d.name);
+        for (long long n = min_n; n <= max_n; n *= 4) {
+            CsesInputSpec at = spec;
+            at.n = int(n);
+            at.q = 0;
+            double base = run_driver(bench, d, at, input);
+            at.q = spec.q;
+            double full = run_driver(bench, d, at, input);
+            points.push_back({d.name, int(n), spec.q, full, max(0.0, full - base) * 1e9 / max(1LL, spec.q)});
+        }
+    }
+    remove(input.c_str());
+
+    // One bar chart per driver, bars relative to its slowest size.
+    cout << "\n=== ns per operation (q = " << spec.q << ", " << spec.update_percent << "% updates) ===\n";
+    for (auto& d : drivers) {
+        double worst = 0;
+        for (auto& p : points)
+            if (p.problem == d.name) worst = max(worst, p.ns_per_op);
+        cout << "\n" << d.name << "\n";
+        for (auto& p : points) {
+            if (p.problem != d.name) continue;
+            int bar = worst > 0 ? int(llround(50 * p.ns_per_op / worst)) : 0;
+            cout << "  n=" << left << setw(9) << p.n << right << fixed << setprecision(1) << setw(9) << p.ns_per_op
+                 << " ns/op " << string(bar, '#') << "\n";
+            cout.unsetf(ios::fixed);
+        }
+    }
+
+    if (!csv.empty()) {
+        ofstream out(csv);
+        out << "problem,n,q,seconds,ns_per_op\n";
+        for (auto& p : points) out << p.problem << "," << p.n << "," << p.q << "," << p.seconds << "," << p.ns_per_op << "\n";
+        cout << "\nWrote " << csv << "\n";
+    }
+    bench.summary();
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "../bench_runner.h"
+#include "geometry/convex_hull.hpp"
+
+using namespace std;
+
+// Baseline: std::sort + monotone chain on every point.
+template <typename T>
+vector<Point<T>> plain_hull(vector<Point<T>> p) {
+    sort(p.begin(), p.end());
+    return hull_detail::monotone_chain(p.data(), p.size());
+}
+
+template <typename T>
+void bench_input(BenchRunner& bench, const string& name, const vector<Point<T>>& p) {
+    const int n = p.size();
+    PointsSoA<T> soa(p);
+    bench.run(name + ", std::sort + chain", n, [&]() { do_not_optimize(plain_hull(p).size()); });
+    bench.run(name + ", filter + radix + chain", n, [&]() { do_not_optimize(convex_hull(p).size()); });
+    bench.run(name + ", SoA input", n, [&]() { do_not_optimize(convex_hull(soa).size()); });
+    bench.run(name + ", all cores", n, [&]() { do_not_optimize(convex_hull(p, 0).size()); });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    const int n = bench.scaled(10000000);
+    mt19937_64 rng(1);
+    uniform_real_distribution<double> unit(-1, 1);
+
+    bench.set_module("Convex hull - uniform in a disk");
+    vector<PointD> disk;
+    while (int(disk.size()) < n) {
+        double x = unit(rng), y = unit(rng);
+        if (x * x + y * y <= 1) disk.push_back({x * 1e6, y * 1e6});
+    }
+    bench_input(bench, "double", disk);
+    vector<PointI> disk_i(n);
+    for (int i = 0; i < n; i++) disk_i[i] = {llround(disk[i].x), llround(disk[i].y)};
+    bench_input(bench, "int64", disk_i);
+
+    bench.set_module("Convex hull - on a circle");
+    vector<PointD> circle(bench.scaled(2000000));
+    for (auto& p : circle) {
+        double a = unit(rng) * M_PI;
+        p = {1e6 * cos(a), 1e6 * sin(a)};
+    }
+    bench_input(bench, "double", circle);
+    bench.summary();
+}
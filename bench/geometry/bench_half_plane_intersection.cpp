@@ -0,0 +1,51 @@
+#include "../bench_runner.h"
+#include "geometry/half_plane_intersection.hpp"
+
+using namespace std;
+
+// Baseline: clip a box by every half-plane in turn, O(n * k) for k vertices.
+vector<PointD> clip_all(const vector<HalfPlane<long long>>& hs, double R) {
+    vector<PointD> poly = {{-R, -R}, {R, -R}, {R, R}, {-R, R}};
+    for (auto& h : hs) {
+        PointD p{double(h.p.x), double(h.p.y)}, d{double(h.d.x), double(h.d.y)};
+        vector<PointD> out;
+        for (size_t i = 0, n = poly.size(); i < n; i++) {
+            PointD a = poly[i], b = poly[(i + 1) % n];
+            double sa = d.cross(a - p), sb = d.cross(b - p);
+            if (sa >= 0) out.push_back(a);
+            if ((sa < 0) != (sb < 0)) out.push_back(a + (b - a) * (sa / (sa - sb)));
+        }
+        poly.swap(out);
+    }
+    return poly;
+}
+
+// n half-planes tangent to a circle, every one of them an edge of the result.
+vector<HalfPlane<long long>> tangents(int n, long long R, mt19937_64& rng) {
+    vector<HalfPlane<long long>> hs;
+    for (int i = 0; i < n; i++) {
+        double a = 2 * M_PI * i / n;
+        PointI p{llround(R * cos(a)), llround(R * sin(a))}, d{llround(-sin(a) * R), llround(cos(a) * R)};
+        hs.push_back({p, p + d});
+    }
+    shuffle(hs.begin(), hs.end(), rng);
+    return hs;
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench.set_module("Half-plane intersection");
+    mt19937_64 rng(1);
+    const long long R = 200000000;   // |coordinates| <= 2^29 keeps the predicates exact
+
+    auto small = tangents(bench.scaled(5000), R, rng);
+    bench.run("clip a box O(n^2), n = " + to_string(small.size()), small.size(),
+              [&]() { do_not_optimize(clip_all(small, 2.0 * R).size()); });
+    bench.run("half_plane_intersection, n = " + to_string(small.size()), small.size(),
+              [&]() { do_not_optimize(half_plane_intersection(small).size()); });
+
+    auto hs = tangents(bench.scaled(1000000), R, rng);
+    bench.run("half_plane_intersection, n = " + to_string(hs.size()), hs.size(),
+              [&]() { do_not_optimize(half_plane_intersection(hs).size()); });
+    bench.summary();
+}
@@ -0,0 +1,41 @@
+#include "../bench_runner.h"
+#include "geometry/minkowski_sum.hpp"
+#include "geometry/convex_hull.hpp"
+
+using namespace std;
+
+// Baseline: hull of all n * m pairwise sums.
+vector<PointI> all_sums(const vector<PointI>& P, const vector<PointI>& Q) {
+    vector<PointI> s;
+    s.reserve(P.size() * Q.size());
+    for (auto& p : P)
+        for (auto& q : Q) s.push_back(p + q);
+    return convex_hull(s);
+}
+
+// Convex polygon with vertices on a circle of radius R around c.
+vector<PointI> round_polygon(int n, long long R, PointI c, double phase) {
+    vector<PointI> p(n);
+    for (int i = 0; i < n; i++) {
+        double a = 2 * M_PI * i / n + phase;
+        p[i] = c + PointI{llround(R * cos(a)), llround(R * sin(a))};
+    }
+    return convex_hull(p);
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench.set_module("Minkowski sum");
+    const long long R = 1000000000000LL;
+
+    auto p1 = round_polygon(bench.scaled(1000), R, {}, 0), q1 = round_polygon(bench.scaled(1000), R, {}, 1e-3);
+    string small = ", " + to_string(p1.size()) + " + " + to_string(q1.size());
+    bench.run("hull of all sums O(nm)" + small, p1.size() + q1.size(), [&]() { do_not_optimize(all_sums(p1, q1).size()); });
+    bench.run("minkowski_sum" + small, p1.size() + q1.size(), [&]() { do_not_optimize(minkowski_sum(p1, q1).size()); });
+
+    auto P = round_polygon(bench.scaled(1000000), R, {}, 0), Q = round_polygon(bench.scaled(1000000), R, {3 * R, 0}, 1e-7);
+    string big = ", " + to_string(P.size()) + " + " + to_string(Q.size());
+    bench.run("minkowski_sum" + big, P.size() + Q.size(), [&]() { do_not_optimize(minkowski_sum(P, Q).size()); });
+    bench.run("convex_intersect (disjoint)" + big, P.size() + Q.size(), [&]() { do_not_optimize(convex_intersect(P, Q)); });
+    bench.summary();
+}
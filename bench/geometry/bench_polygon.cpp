@@ -0,0 +1,67 @@
+#include "../bench_runner.h"
+#include "geometry/polygon.hpp"
+#include "geometry/convex_hull.hpp"
+
+using namespace std;
+
+// O(n) crossing number, the usual per-point test.
+bool crossing_inside(const vector<PointI>& poly, PointI p) {
+    bool in = false;
+    for (size_t i = 0, n = poly.size(); i < n; i++) {
+        PointI a = poly[i], b = poly[(i + 1) % n];
+        if ((a.y > p.y) != (b.y > p.y) && (b.y > a.y) == (orientation(a, b, p) > 0)) in = !in;
+    }
+    return in;
+}
+
+// Star-shaped polygon with n vertices of radius in [R / 2, R].
+vector<PointI> star(int n, long long R, mt19937_64& rng) {
+    vector<PointI> poly(n);
+    for (int i = 0; i < n; i++) {
+        double a = 2 * M_PI * i / n, r = R * (0.5 + 0.5 * (rng() % 1000) / 1000.0);
+        poly[i] = {llround(r * cos(a)), llround(r * sin(a))};
+    }
+    return poly;
+}
+
+void bench_polygon(BenchRunner& bench, int n) {
+    const int q = bench.scaled(4000000);
+    const long long R = 1000000000;
+    mt19937_64 rng(n);
+    auto poly = star(n, R, rng);
+    vector<PointI> qs(q);
+    for (auto& p : qs) p = {(long long)(rng() % (2 * R)) - R, (long long)(rng() % (2 * R)) - R};
+    PolygonIndex<long long> idx(poly);
+    string suffix = ", " + to_string(n) + "-gon";
+
+    const int nq = max(1, q / max(1, n / 10));
+    bench.run("crossing number O(n)" + suffix, nq, [&]() {
+        int c = 0;
+        for (int i = 0; i < nq; i++) c += crossing_inside(poly, qs[i]);
+        do_not_optimize(c);
+    });
+    bench.run("PolygonIndex::locate" + suffix, q, [&]() {
+        int c = 0;
+        for (auto& p : qs) c += idx.locate(p) == Location::inside;
+        do_not_optimize(c);
+    });
+    bench.run("PolygonIndex::locate_batch" + suffix, q, [&]() { do_not_optimize(idx.locate_batch(qs).data()); });
+    bench.run("PolygonIndex::locate_batch, all cores" + suffix, q,
+              [&]() { do_not_optimize(idx.locate_batch(qs, 0).data()); });
+
+    ConvexPolygon<long long> cp(convex_hull(poly));
+    bench.run("ConvexPolygon::locate (hull)" + suffix, q, [&]() {
+        int c = 0;
+        for (auto& p : qs) c += cp.locate(p) == Location::inside;
+        do_not_optimize(c);
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench.set_module("Point in polygon - throughput");
+    bench_polygon(bench, 16);
+    bench_polygon(bench, 300);
+    bench_polygon(bench, 5000);
+    bench.summary();
+}
@@ -0,0 +1,43 @@
+#include "../bench_runner.h"
+#include "geometry/rotating_calipers.hpp"
+#include "geometry/convex_hull.hpp"
+
+using namespace std;
+
+// Baseline: all pairs, O(n^2).
+__int128 all_pairs_diameter2(const vector<PointI>& h) {
+    __int128 best = 0;
+    for (size_t i = 0; i < h.size(); i++)
+        for (size_t j = i + 1; j < h.size(); j++) best = max(best, (h[i] - h[j]).norm2());
+    return best;
+}
+
+// Convex polygon: random edge vectors sorted by angle, chained.
+vector<PointI> random_convex(int n, long long range, mt19937_64& rng) {
+    vector<PointI> e(n);
+    PointI sum;
+    for (auto& v : e) v = {(long long)(rng() % (2 * range + 1)) - range, (long long)(rng() % (2 * range + 1)) - range}, sum = sum + v;
+    e.push_back(-sum);
+    auto half = [](PointI q) { return q.y < 0 || (q.y == 0 && q.x < 0); };
+    sort(e.begin(), e.end(), [&](PointI a, PointI b) { return half(a) != half(b) ? half(a) < half(b) : a.cross(b) > 0; });
+    vector<PointI> poly = {{0, 0}};
+    for (auto& v : e) poly.push_back(poly.back() + v);
+    return convex_hull(poly);
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    mt19937_64 rng(1);
+    bench.set_module("Rotating calipers");
+
+    auto small = random_convex(bench.scaled(3000), 1000000000, rng);
+    bench.run("all pairs O(n^2), " + to_string(small.size()) + "-gon", small.size(),
+              [&]() { do_not_optimize(all_pairs_diameter2(small)); });
+    bench.run("hull_diameter, " + to_string(small.size()) + "-gon", small.size(),
+              [&]() { do_not_optimize(hull_diameter(small).dist2); });
+
+    auto h = random_convex(bench.scaled(1000000), 1000000000, rng);
+    bench.run("hull_diameter, " + to_string(h.size()) + "-gon", h.size(), [&]() { do_not_optimize(hull_diameter(h).dist2); });
+    bench.run("hull_width, " + to_string(h.size()) + "-gon", h.size(), [&]() { do_not_optimize(hull_width(h)); });
+    bench.summary();
+}
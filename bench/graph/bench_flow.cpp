@@ -0,0 +1,60 @@
+#include "../bench_runner.h"
+#include "graph/flow.hpp"
+
+using namespace std;
+
+using MCF = MinCostFlow<int, long long>;
+
+// Complete bipartite assignment instance: n workers x n jobs, costs in [1, max_cost]
+MCF dense_bipartite(int n, long long max_cost, mt19937_64& rng) {
+    MCF mcf(2 * n + 2);
+    int s = 2 * n, t = 2 * n + 1;
+    for (int i = 0; i < n; i++) {
+        mcf.add_edge(s, i, 1, 0);
+        mcf.add_edge(n + i, t, 1, 0);
+    }
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            mcf.add_edge(i, n + j, 1, (long long)(rng() % max_cost) + 1);
+    return mcf;
+}
+
+void bench_dense_bipartite(BenchRunner& bench, long long max_cost) {
+    int n = bench.scaled(2000);
+    bench.set_module("MinCostFlow - dense bipartite " + to_string(n) + "x" + to_string(n) +
+                     ", costs <= " + to_string(max_cost));
+    mt19937_64 rng(12345);
+    const MCF base = dense_bipartite(n, max_cost, rng);
+    long long edges = 1LL * n * n + 2 * n;
+    int s = 2 * n, t = 2 * n + 1;
+
+    vector<pair<string, MCF::Strategy>> strategies = {
+        {"SSP + DaryHeap", MCF::Strategy::DaryHeap},
+        {"SSP + RadixHeap", MCF::Strategy::RadixHeap},
+        {"SSP + Dense", MCF::Strategy::Dense},
+    };
+    set<long long> costs;
+    for (auto& [name, strategy] : strategies) {
+        MCF mcf = base;
+        bench.run(name, edges, [&]() {
+            auto res = mcf.flow(s, t, numeric_limits<int>::max(), strategy);
+            costs.insert(res.second);
+            do_not_optimize(res);
+        });
+    }
+    MCF mcf = base;
+    bench.run("Cost scaling", edges, [&]() {
+        auto res = mcf.flow_cost_scaling(s, t);
+        costs.insert(res.second);
+        do_not_optimize(res);
+    });
+    if (costs.size() != 1)
+        cout << "⚠️  strategies disagree on the optimal cost\n";
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_dense_bipartite(bench, 1000);
+    bench_dense_bipartite(bench, 1000000000);
+    bench.summary();
+}
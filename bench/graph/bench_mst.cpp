@@ -0,0 +1,43 @@
+#include "../bench_runner.h"
+#include "graph/mst.hpp"
+
+using namespace std;
+
+void bench_random_graph(BenchRunner& bench, int threads) {
+    int n = bench.scaled(1000000);
+    int m = bench.scaled(10000000);
+    bench.set_module("MST - random graph n=" + to_string(n) + " m=" + to_string(m) +
+                     " threads=" + to_string(resolve_threads(threads)));
+    mt19937_64 rng(777);
+    vector<WeightedEdge<long long>> edges(m);
+    for (auto& e : edges) {
+        e.u = rng() % n;
+        e.v = rng() % n;
+        e.w = rng() % 1000000000;
+    }
+
+    vector<long long> weights;
+    bench.run("Kruskal (radix sort)", m, [&]() { weights.push_back(kruskal_mst(n, edges, threads).weight); });
+    bench.run("Filter-Kruskal", m, [&]() { weights.push_back(filter_kruskal_mst(n, edges).weight); });
+    bench.run("Boruvka (ConcurrentDSU)", m, [&]() { weights.push_back(boruvka_mst(n, edges, threads).weight); });
+    bench.run("Kruskal (std::sort baseline)", m, [&]() {
+        vector<int> ids(m);
+        iota(ids.begin(), ids.end(), 0);
+        sort(ids.begin(), ids.end(), [&](int a, int b) { return mst_edge_less(edges, a, b); });
+        DSU dsu(n);
+        long long w = 0;
+        for (int id : ids)
+            if (dsu.unite(edges[id].u, edges[id].v))
+                w += edges[id].w;
+        weights.push_back(w);
+    });
+    if (count(weights.begin(), weights.end(), weights[0]) != int(weights.size()))
+        cout << "⚠️  algorithms disagree on the forest weight\n";
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_random_graph(bench, 1);
+    bench_random_graph(bench, 0);
+    bench.summary();
+}
@@ -0,0 +1,36 @@
+#include "../bench_runner.h"
+#include "graph/dfs_bfs.hpp"
+
+using namespace std;
+
+void bench_random_graph(BenchRunner& bench, int avg_degree) {
+    int n = bench.scaled(1 << 22);
+    long long m = 1LL * n * avg_degree / 2;
+    bench.set_module("Traversal - random undirected graph n=" + to_string(n) + " m=" + to_string(m));
+    mt19937_64 rng(2024);
+    vector<pair<int, int>> edges(m);
+    for (auto& [u, v] : edges) {
+        u = rng() % n;
+        v = rng() % n;
+    }
+    CSRGraph g(n, edges, true);
+    long long arcs = g.num_arcs();
+
+    bench.run("BFS top-down", arcs, [&]() { do_not_optimize(bfs(g, 0)); });
+    bench.run("BFS direction-optimizing (1 thread)", arcs,
+              [&]() { do_not_optimize(bfs_direction_optimizing(g, g, 0, 1)); });
+    bench.run("BFS direction-optimizing (all threads)", arcs,
+              [&]() { do_not_optimize(bfs_direction_optimizing(g, g, 0, 0)); });
+    bench.run("Iterative DFS order", arcs, [&]() { do_not_optimize(dfs_order(g)); });
+    bench.run("Low-link (bridges + articulation points)", arcs, [&]() { do_not_optimize(low_link(g)); });
+
+    CSRGraph d(n, edges);
+    bench.run("SCC (iterative Tarjan)", m, [&]() { do_not_optimize(strongly_connected_components(d)); });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_random_graph(bench, 4);
+    bench_random_graph(bench, 16);
+    bench.summary();
+}
@@ -0,0 +1,69 @@
+#include "../bench_runner.h"
+#include "math/combinatorics.hpp"
+
+using namespace std;
+
+using mint = modint998244353;
+using comb = Combinatorics<mint>;
+
+void bench_binomials(BenchRunner& bench) {
+    bench.set_module("Combinatorics - binomials");
+    const int q = bench.scaled(1000000);
+    const int maxn = 10000000;
+    mt19937 rng(1);
+    vector<pair<long long, long long>> qs(q);
+    for (auto& [n, k] : qs) {
+        n = rng() % maxn;
+        k = rng() % (n + 1);
+    }
+
+    // What the tables replace: factorials precomputed, but one inversion per query.
+    vector<mint> fact(maxn);
+    fact[0] = 1;
+    for (int i = 1; i < maxn; i++)
+        fact[i] = fact[i - 1] * mint(i);
+    bench.run("factorial table + 1 inversion per query", q, [&]() {
+        mint sum = 0;
+        for (auto [n, k] : qs)
+            sum += fact[n] / (fact[k] * fact[n - k]);
+        do_not_optimize(sum);
+    });
+
+    comb::reset();
+    bench.run("table growth to 10^7 (single inversion)", maxn, [&]() { comb::reserve(maxn - 1); });
+    bench.run("comb::C per query", q, [&]() {
+        mint sum = 0;
+        for (auto [n, k] : qs)
+            sum += comb::C(n, k);
+        do_not_optimize(sum);
+    });
+    bench.run("comb::binomials batch", q, [&]() { do_not_optimize(comb::binomials(qs)[0]); });
+}
+
+void bench_rows(BenchRunner& bench) {
+    bench.set_module("Combinatorics - Stirling rows and Lucas");
+    const int n = bench.scaled(1 << 18);
+    bench.run("stirling1_row", n, [&]() { do_not_optimize(comb::stirling1_row(n)[1]); });
+    bench.run("stirling2_row", n, [&]() { do_not_optimize(comb::stirling2_row(n)[1]); });
+    bench.run("stirling2_row mod 1e9+7 (CRT)", n,
+              [&]() { do_not_optimize(Combinatorics<modint1000000007>::stirling2_row(n)[1]); });
+
+    LucasBinomial lucas(1000003);
+    const int q = bench.scaled(1000000);
+    mt19937_64 rng(2);
+    bench.run("LucasBinomial, n ~ 10^18", q, [&]() {
+        long long sum = 0;
+        for (int i = 0; i < q; i++) {
+            long long a = rng() >> 4, b = rng() >> 5;
+            sum += lucas.C(a, b);
+        }
+        do_not_optimize(sum);
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_binomials(bench);
+    bench_rows(bench);
+    bench.summary();
+}
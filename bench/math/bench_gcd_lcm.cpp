@@ -0,0 +1,85 @@
+#include "../bench_runner.h"
+#include "math/gcd_lcm.hpp"
+
+using namespace std;
+
+void bench_gcd(BenchRunner& bench) {
+    bench.set_module("GCD - binary vs std::gcd");
+    const int n = bench.scaled(10000000);
+    mt19937_64 rng(1);
+    vector<uint64_t> a(n), b(n);
+    vector<uint32_t> c(n), d(n);
+    for (int i = 0; i < n; i++) {
+        a[i] = rng() >> 1, b[i] = rng() >> 1;
+        c[i] = rng(), d[i] = rng();
+    }
+
+    bench.run("std::gcd 64-bit", n, [&]() {
+        uint64_t s = 0;
+        for (int i = 0; i < n; i++) s += std::gcd(a[i], b[i]);
+        do_not_optimize(s);
+    });
+    bench.run("binary_gcd 64-bit", n, [&]() {
+        uint64_t s = 0;
+        for (int i = 0; i < n; i++) s += binary_gcd(a[i], b[i]);
+        do_not_optimize(s);
+    });
+    bench.run("std::gcd 32-bit", n, [&]() {
+        uint64_t s = 0;
+        for (int i = 0; i < n; i++) s += std::gcd(c[i], d[i]);
+        do_not_optimize(s);
+    });
+    bench.run("binary_gcd 32-bit", n, [&]() {
+        uint64_t s = 0;
+        for (int i = 0; i < n; i++) s += binary_gcd(c[i], d[i]);
+        do_not_optimize(s);
+    });
+    // range-gcd style: running gcd over an array
+    bench.run("running gcd, std::gcd", n, [&]() {
+        uint64_t g = 0;
+        for (int i = 0; i < n; i++) g = std::gcd(g, a[i] << 3) | 8;
+        do_not_optimize(g);
+    });
+    bench.run("running gcd, binary_gcd", n, [&]() {
+        uint64_t g = 0;
+        for (int i = 0; i < n; i++) g = binary_gcd(g, a[i] << 3) | 8;
+        do_not_optimize(g);
+    });
+}
+
+void bench_factorization(BenchRunner& bench) {
+    bench.set_module("Factorization");
+    const int n = bench.scaled(100000);
+    mt19937_64 rng(2);
+    vector<uint64_t> xs(n);
+    for (auto& x : xs) x = rng() >> 1;
+
+    bench.run("miller_rabin, random 63-bit", n, [&]() {
+        int cnt = 0;
+        for (auto x : xs) cnt += miller_rabin(x | 1);
+        do_not_optimize(cnt);
+    });
+    const int m = bench.scaled(2000);
+    bench.run("prime_factors, random 63-bit", m, [&]() {
+        size_t total = 0;
+        for (int i = 0; i < m; i++) total += prime_factors(xs[i]).size();
+        do_not_optimize(total);
+    });
+    vector<uint64_t> semis(bench.scaled(200));
+    for (auto& s : semis) {
+        auto next_prime = [](uint64_t x) { while (!miller_rabin(x)) x++; return x; };
+        s = next_prime(rng() >> 33) * next_prime(rng() >> 33);
+    }
+    bench.run("pollard_rho, 62-bit semiprimes", semis.size(), [&]() {
+        uint64_t s = 0;
+        for (auto x : semis) s += pollard_rho(x);
+        do_not_optimize(s);
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_gcd(bench);
+    bench_factorization(bench);
+    bench.summary();
+}
@@ -0,0 +1,86 @@
+#include "../bench_runner.h"
+#include "math/linear_recurrence.hpp"
+#include "math/matrix.hpp"
+
+using namespace std;
+
+using mint = modint1000000007;
+
+// Textbook i-k-j product with a reduction after every multiply-add.
+Matrix<mint> naive_mul(const Matrix<mint>& x, const Matrix<mint>& y) {
+    Matrix<mint> c(x.n, y.m);
+    for (int i = 0; i < x.n; i++)
+        for (int k = 0; k < x.m; k++)
+            for (int j = 0; j < y.m; j++)
+                c[i][j] += x[i][k] * y[k][j];
+    return c;
+}
+
+Matrix<mint> random_matrix(mt19937& rng, int n) {
+    Matrix<mint> a(n, n);
+    for (auto& x : a.a)
+        x = mint(rng());
+    return a;
+}
+
+void bench_products(BenchRunner& bench) {
+    bench.set_module("Matrix - products");
+    mt19937 rng(1);
+    for (int n : {64, 200, 512}) {
+        auto a = random_matrix(rng, n), b = random_matrix(rng, n);
+        int reps = max<long long>(1, bench.scaled(200000000) / (1LL * n * n * n));
+        long long ops = 1LL * reps * n * n * n;
+        bench.run("naive i-k-j, n=" + to_string(n), ops, [&]() {
+            for (int r = 0; r < reps; r++)
+                do_not_optimize(naive_mul(a, b)[0][0]);
+        });
+        Matrix<mint> c;
+        vector<mint> scratch;
+        bench.run("tiled + delayed reduction, n=" + to_string(n), ops, [&]() {
+            for (int r = 0; r < reps; r++)
+                Matrix<mint>::multiply_into(a, b, c, scratch);
+            do_not_optimize(c[0][0]);
+        });
+    }
+
+    const int reps = bench.scaled(2000000);
+    Matrix<mint, 4> f;
+    for (auto& x : f.a)
+        x = mint(rng());
+    auto d = random_matrix(rng, 4);
+    bench.run("4x4 fixed size", reps, [&]() {
+        auto x = f;
+        for (int r = 0; r < reps; r++)
+            x = x * f;
+        do_not_optimize(x[0][0]);
+    });
+    bench.run("4x4 runtime size", reps, [&]() {
+        auto x = d;
+        for (int r = 0; r < reps; r++)
+            x = x * d;
+        do_not_optimize(x[0][0]);
+    });
+}
+
+void bench_recurrence(BenchRunner& bench) {
+    bench.set_module("Matrix - order-d recurrence, k = 10^18");
+    const unsigned long long k = 1000000000000000000ULL;
+    mt19937 rng(2);
+    for (int d : {50, 200}) {
+        vector<mint> c(d), init(d);
+        for (auto& x : c) x = mint(rng());
+        for (auto& x : init) x = mint(rng());
+        Matrix<mint> comp(d, d);
+        for (int j = 0; j < d; j++) comp[0][j] = c[j];
+        for (int i = 1; i < d; i++) comp[i][i - 1] = 1;
+        bench.run("companion matrix pow, d=" + to_string(d), 1, [&]() { do_not_optimize(comp.pow(k)[0][0]); });
+        bench.run("kitamasa, d=" + to_string(d), 1, [&]() { do_not_optimize(kitamasa(c, init, k)); });
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_products(bench);
+    bench_recurrence(bench);
+    bench.summary();
+}
@@ -0,0 +1,107 @@
+#include "../bench_runner.h"
+#include "math/modular.hpp"
+
+using namespace std;
+
+// Latency-bound chain (x = x * c + d) and a throughput-bound product over an array.
+template <typename Mul>
+uint64_t chain(long long iters, uint64_t x, Mul&& mul) {
+    for (long long i = 0; i < iters; i++)
+        x = mul(x, x + 12345);
+    return x;
+}
+
+void bench_multiplication(BenchRunner& bench) {
+    bench.set_module("Modular - multiplication");
+    const long long iters = bench.scaled(100000000);
+    const uint32_t MOD = 998244353;
+    volatile uint32_t runtime_mod_source = MOD;
+    const uint32_t runtime_mod = runtime_mod_source;
+
+    bench.run("naive % (compile-time MOD)", iters, [&]() {
+        do_not_optimize(chain(iters, 1, [&](uint64_t a, uint64_t b) { return a * (b % MOD) % MOD; }));
+    });
+    bench.run("naive % (runtime mod)", iters, [&]() {
+        do_not_optimize(chain(iters, 1, [&](uint64_t a, uint64_t b) { return a * (b % runtime_mod) % runtime_mod; }));
+    });
+
+    using mint = static_modint<998244353>;
+    bench.run("static_modint (Montgomery)", iters, [&]() {
+        mint x = 1, c = 12345;
+        for (long long i = 0; i < iters; i++)
+            x = x * (x + c);
+        do_not_optimize(x);
+    });
+
+    using dmint = dynamic_modint<0>;
+    dmint::set_mod(runtime_mod);
+    bench.run("dynamic_modint (Barrett)", iters, [&]() {
+        dmint x = 1, c = 12345;
+        for (long long i = 0; i < iters; i++)
+            x = x * (x + c);
+        do_not_optimize(x);
+    });
+
+    using dmint64 = dynamic_modint64<0>;
+    const uint64_t mod64 = (1ULL << 61) - 1;
+    dmint64::set_mod(mod64);
+    bench.run("naive % (64-bit, __int128)", iters, [&]() {
+        uint64_t x = 1;
+        for (long long i = 0; i < iters; i++)
+            x = (unsigned __int128)x * (x + 12345) % mod64;
+        do_not_optimize(x);
+    });
+    bench.run("dynamic_modint64 (Montgomery)", iters, [&]() {
+        dmint64 x = 1, c = 12345;
+        for (long long i = 0; i < iters; i++)
+            x = x * (x + c);
+        do_not_optimize(x);
+    });
+}
+
+void bench_throughput(BenchRunner& bench) {
+    bench.set_module("Modular - array products (throughput)");
+    const int n = bench.scaled(1 << 20);
+    const int rounds = 50;
+    mt19937 rng(1);
+    vector<uint32_t> a(n), b(n);
+    for (int i = 0; i < n; i++)
+        a[i] = rng() % 998244353, b[i] = rng() % 998244353;
+    volatile uint32_t runtime_mod_source = 998244353;
+    const uint32_t runtime_mod = runtime_mod_source;
+
+    bench.run("naive % (runtime mod)", 1LL * n * rounds, [&]() {
+        vector<uint32_t> c(n);
+        for (int r = 0; r < rounds; r++)
+            for (int i = 0; i < n; i++)
+                c[i] = uint64_t(a[i]) * b[i] % runtime_mod;
+        do_not_optimize(c[n / 2]);
+    });
+
+    using mint = modint998244353;
+    vector<mint> ma(a.begin(), a.end()), mb(b.begin(), b.end()), mc(n);
+    bench.run("static_modint (Montgomery)", 1LL * n * rounds, [&]() {
+        for (int r = 0; r < rounds; r++)
+            for (int i = 0; i < n; i++)
+                mc[i] = ma[i] * mb[i];
+        do_not_optimize(mc[n / 2]);
+    });
+
+    vector<mint> xs = mb;
+    bench.run("n separate inversions", n, [&]() {
+        for (auto& x : xs) x = x.inv();
+        do_not_optimize(xs[0]);
+    });
+    xs = mb;
+    bench.run("batch_inverse", n, [&]() {
+        batch_inverse(xs);
+        do_not_optimize(xs[0]);
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_multiplication(bench);
+    bench_throughput(bench);
+    bench.summary();
+}
@@ -0,0 +1,85 @@
+#include "../bench_runner.h"
+#include "math/polynomial.hpp"
+
+using namespace std;
+
+using mint = modint998244353;
+
+vector<mint> random_poly(mt19937& rng, int n) {
+    vector<mint> a(n);
+    for (auto& x : a)
+        x = mint(rng() % mint::mod());
+    return a;
+}
+
+// Naive O(n^2) vs NTT around the crossover used by convolution().
+void bench_crossover(BenchRunner& bench) {
+    bench.set_module("NTT - naive vs NTT crossover");
+    mt19937 rng(1);
+    for (int n : {16, 32, 64, 128, 256, 1024}) {
+        auto a = random_poly(rng, n), b = random_poly(rng, n);
+        int reps = max<long long>(1, bench.scaled(1 << 22) / (n * n));
+        bench.run("naive    n=" + to_string(n), 1LL * reps * n, [&]() {
+            for (int r = 0; r < reps; r++)
+                do_not_optimize(convolution_naive(a, b)[n / 2]);
+        });
+        bench.run("NTT      n=" + to_string(n), 1LL * reps * n, [&]() {
+            for (int r = 0; r < reps; r++) {
+                int sz = bit_ceil(unsigned(2 * n - 1));
+                vector<mint> fa(a), fb(b);
+                fa.resize(sz), fb.resize(sz);
+                NTT<mint>::forward(fa);
+                NTT<mint>::forward(fb);
+                for (int i = 0; i < sz; i++)
+                    fa[i] *= fb[i];
+                NTT<mint>::inverse(fa);
+                do_not_optimize(fa[n / 2]);
+            }
+        });
+    }
+}
+
+void bench_large(BenchRunner& bench) {
+    bench.set_module("NTT - large products");
+    mt19937 rng(2);
+    const int n = bench.scaled(1 << 20);
+    auto a = random_poly(rng, n), b = random_poly(rng, n);
+
+    if (ntt_cpu_has_avx2()) {
+        NTT<mint>::use_avx2 = true;
+        bench.run("convolution n x n (AVX2)", n, [&]() { do_not_optimize(convolution(a, b)[n]); });
+    }
+    NTT<mint>::use_avx2 = false;
+    bench.run("convolution n x n (scalar)", n, [&]() { do_not_optimize(convolution(a, b)[n]); });
+    NTT<mint>::use_avx2 = ntt_cpu_has_avx2();
+
+    using m7 = modint1000000007;
+    vector<m7> c(n), d(n);
+    for (int i = 0; i < n; i++)
+        c[i] = m7(rng()), d[i] = m7(rng());
+    bench.run("convolution_arbitrary mod 1e9+7", n, [&]() { do_not_optimize(convolution_arbitrary(c, d)[n]); });
+}
+
+void bench_series(BenchRunner& bench) {
+    bench.set_module("Polynomial - power series");
+    mt19937 rng(3);
+    const int n = bench.scaled(1 << 19);
+    auto f = random_poly(rng, n);
+    f[0] = 1;
+    bench.run("poly_inv", n, [&]() { do_not_optimize(poly_inv(f, n)[n - 1]); });
+    bench.run("poly_log", n, [&]() { do_not_optimize(poly_log(f, n)[n - 1]); });
+    f[0] = 0;
+    bench.run("poly_exp", n, [&]() { do_not_optimize(poly_exp(f, n)[n - 1]); });
+
+    const int m = bench.scaled(1 << 16);
+    auto g = random_poly(rng, m), xs = random_poly(rng, m);
+    bench.run("multipoint_eval", m, [&]() { do_not_optimize(multipoint_eval(g, xs)[0]); });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_crossover(bench);
+    bench_large(bench);
+    bench_series(bench);
+    bench.summary();
+}
@@ -0,0 +1,83 @@
+#include "../bench_runner.h"
+#include "math/prime_sieve.hpp"
+
+using namespace std;
+
+// Plain (non-segmented) byte sieve: the baseline the segmented sieve replaces.
+uint64_t count_primes_plain(uint64_t n) {
+    vector<char> comp(n + 1, 0);
+    uint64_t cnt = 0;
+    for (uint64_t i = 2; i <= n; i++) {
+        if (comp[i])
+            continue;
+        cnt++;
+        for (uint64_t j = i * i; j <= n; j += i)
+            comp[j] = 1;
+    }
+    return cnt;
+}
+
+void bench_sieves(BenchRunner& bench) {
+    bench.set_module("Prime Sieve - counting");
+    const uint64_t n = bench.scaled(1000000000);
+
+    bench.run("plain byte sieve", n, [&]() { do_not_optimize(count_primes_plain(n)); });
+    bench.run("segmented, 1 thread", n, [&]() { do_not_optimize(count_primes(0, n, 1)); });
+    bench.run("segmented, all threads", n, [&]() { do_not_optimize(count_primes(0, n, 0)); });
+    bench.run("prime_pi (Lucy)", n, [&]() { do_not_optimize(prime_pi(n)); });
+    const uint64_t big = bench.scaled(1000000000000LL);
+    bench.run("prime_pi(10^12 * scale)", 1, [&]() { do_not_optimize(prime_pi(big)); });
+}
+
+void bench_streaming(BenchRunner& bench) {
+    bench.set_module("Prime Sieve - streaming");
+    const uint64_t n = bench.scaled(1000000000);
+
+    bench.run("sum of primes, 1 thread", n, [&]() {
+        uint64_t sum = 0;
+        for_each_prime(0, n, [&](uint64_t p) { sum += p; });
+        do_not_optimize(sum);
+    });
+    int threads = resolve_threads(0);
+    bench.run("sum of primes, all threads", n, [&]() {
+        vector<uint64_t> sum(threads);
+        for_each_prime(0, n, [&](uint64_t p, int tid) { sum[tid] += p; }, threads);
+        do_not_optimize(accumulate(sum.begin(), sum.end(), 0ULL));
+    });
+    const uint64_t lo = 1000000000000000ULL, width = bench.scaled(100000000);
+    bench.run("window of 10^8 above 10^15", width, [&]() { do_not_optimize(count_primes(lo, lo + width)); });
+}
+
+void bench_spf(BenchRunner& bench) {
+    bench.set_module("Prime Sieve - smallest prime factor");
+    const int n = bench.scaled(100000000);
+
+    bench.run("LinearSieve", n, [&]() { do_not_optimize(LinearSieve(n).spf[n / 2 + 1]); });
+    bench.run("Eratosthenes spf", n, [&]() {
+        vector<int> spf(n + 1, 0);
+        for (long long i = 2; i <= n; i++)
+            if (spf[i] == 0)
+                for (long long j = i; j <= n; j += i)
+                    if (spf[j] == 0) spf[j] = i;
+        do_not_optimize(spf[n / 2 + 1]);
+    });
+    LinearSieve ls(n);
+    mt19937 rng(1);
+    vector<int> xs(1000000);
+    for (auto& x : xs)
+        x = rng() % n + 1;
+    bench.run("factorize 10^6 numbers", xs.size(), [&]() {
+        size_t total = 0;
+        for (int x : xs)
+            total += ls.factorize(x).size();
+        do_not_optimize(total);
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_sieves(bench);
+    bench_streaming(bench);
+    bench_spf(bench);
+    bench.summary();
+}
@@ -0,0 +1,39 @@
+#include "../bench_runner.h"
+#include "misc/binary_search.hpp"
+
+using namespace std;
+
+// One size per memory level: L1, L2, L3, DRAM.
+void bench_level(BenchRunner& bench, const char* level, int n, int q) {
+    mt19937 rng(n);
+    vector<int> a(n), qs(q);
+    for (auto& x : a) x = int(rng());
+    for (auto& x : qs) x = int(rng());
+    sort(a.begin(), a.end());
+    Eytzinger<int> e(a);
+    STree<int> st(a);
+
+    string suffix = string(", ") + level + " (n = " + to_string(n) + ")";
+    auto run = [&](const string& name, auto search) {
+        bench.run(name + suffix, q, [&]() {
+            long long total = 0;
+            for (int x : qs) total += search(x);
+            do_not_optimize(total);
+        });
+    };
+    run("std::lower_bound", [&](int x) { return lower_bound(a.begin(), a.end(), x) - a.begin(); });
+    run("branchless", [&](int x) { return branchless_lower_bound(a.begin(), a.end(), x) - a.begin(); });
+    run("Eytzinger + prefetch", [&](int x) { return e.lower_bound(x); });
+    run("S-tree", [&](int x) { return st.lower_bound(x); });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench.set_module("Static lower_bound on 32-bit keys");
+    const int q = bench.scaled(2000000);
+    bench_level(bench, "L1", 4096, q);
+    bench_level(bench, "L2", 1 << 16, q);
+    bench_level(bench, "L3", 1 << 20, q);
+    bench_level(bench, "DRAM", bench.scaled(1 << 25), q);
+    bench.summary();
+}
@@ -0,0 +1,52 @@
+#include "../bench_runner.h"
+#include "misc/coordinate_compression.hpp"
+
+using namespace std;
+
+void bench_build(BenchRunner& bench) {
+    bench.set_module("Coordinate compression - build");
+    const int n = bench.scaled(20000000);
+    mt19937_64 rng(1);
+    vector<long long> a(n);
+    for (auto& x : a) x = rng() % (4LL * n);
+
+    bench.run("sort + unique + lower_bound", n, [&]() {
+        vector<long long> keys = a;
+        sort(keys.begin(), keys.end());
+        keys.erase(unique(keys.begin(), keys.end()), keys.end());
+        vector<int> rank(n);
+        for (int i = 0; i < n; i++) rank[i] = lower_bound(keys.begin(), keys.end(), a[i]) - keys.begin();
+        do_not_optimize(rank.data());
+    });
+    bench.run("radix, 1 thread", n, [&]() { do_not_optimize(CoordinateCompression(a).rank.data()); });
+    bench.run("radix, all cores", n, [&]() { do_not_optimize(CoordinateCompression(a, 0).rank.data()); });
+}
+
+void bench_lookup(BenchRunner& bench) {
+    bench.set_module("Coordinate compression - rank lookups");
+    const int n = bench.scaled(4000000);
+    const int q = bench.scaled(10000000);
+    mt19937_64 rng(2);
+    vector<long long> a(n), qs(q);
+    for (auto& x : a) x = rng();
+    for (auto& x : qs) x = rng();
+    CoordinateCompression cc(a);
+
+    bench.run("std::lower_bound on sorted keys", q, [&]() {
+        long long total = 0;
+        for (long long x : qs) total += lower_bound(cc.keys.begin(), cc.keys.end(), x) - cc.keys.begin();
+        do_not_optimize(total);
+    });
+    bench.run("Eytzinger lower_bound", q, [&]() {
+        long long total = 0;
+        for (long long x : qs) total += cc.lower_bound(x);
+        do_not_optimize(total);
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_build(bench);
+    bench_lookup(bench);
+    bench.summary();
+}
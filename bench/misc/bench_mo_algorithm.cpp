@@ -0,0 +1,38 @@
+#include "../bench_runner.h"
+#include "misc/mo_algorithm.hpp"
+
+using namespace std;
+
+void bench_orders(BenchRunner& bench, int n, int q) {
+    mt19937_64 rng(1);
+    vector<int> a(n);
+    for (auto& x : a) x = rng() % 100000;
+    vector<pair<int, int>> qs(q);
+    for (auto& [l, r] : qs) {
+        l = rng() % (n + 1), r = rng() % (n + 1);
+        if (l > r) swap(l, r);
+    }
+
+    for (auto [name, mode] : {pair<const char*, MoOrder>{"Hilbert order", MoOrder::hilbert},
+                              pair<const char*, MoOrder>{"block order", MoOrder::block}}) {
+        vector<int> cnt(100000, 0);
+        int distinct = 0;
+        long long moves = 0, total = 0;
+        bench.run("q = " + to_string(q) + ", " + name, q, [&]() {
+            mo(n, qs, [&](int i) { distinct += cnt[a[i]]++ == 0, moves++; },
+               [&](int i) { distinct -= --cnt[a[i]] == 0, moves++; }, [&](int) { total += distinct; }, mode);
+        });
+        cout << "  pointer moves: " << moves << " (" << fixed << setprecision(1) << double(moves) / q
+             << " per query)\n";
+        cout.unsetf(ios::fixed);
+        do_not_optimize(total);
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench.set_module("Mo's algorithm - Hilbert vs block order, range distinct");
+    bench_orders(bench, bench.scaled(1000000), bench.scaled(1000000));
+    bench_orders(bench, bench.scaled(1000000), bench.scaled(100000));
+    bench.summary();
+}
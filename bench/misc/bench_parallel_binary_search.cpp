@@ -0,0 +1,46 @@
+#include "../bench_runner.h"
+#include "misc/parallel_binary_search.hpp"
+#include "data-structures/fenwick_tree.hpp"
+
+using namespace std;
+
+// "First update after which prefix_sum(pos[i]) >= need[i]" over point adds.
+void bench_thresholds(BenchRunner& bench) {
+    bench.set_module("Parallel binary search - first time a prefix sum reaches a threshold");
+    const int n = bench.scaled(200000), T = bench.scaled(200000), q = bench.scaled(200000);
+    mt19937 rng(1);
+    vector<pair<int, int>> upd(T);
+    for (auto& [p, v] : upd) p = rng() % n, v = rng() % 100;
+    vector<int> pos(q);
+    vector<long long> need(q);
+    for (int i = 0; i < q; i++) pos[i] = rng() % n, need[i] = rng() % (50LL * T);
+
+    using F = FenwickTree<long long>;
+    auto make = [&]() { return F(n); };
+    auto apply = [&](F& f, int t) { f.add(upd[t].first, upd[t].second); };
+    auto check = [&](F& f, int i) { return f.prefix_sum(pos[i]) >= need[i]; };
+
+    const int naive_q = max(1, q / 1000);
+    bench.run("replay per query (" + to_string(naive_q) + " queries)", naive_q, [&]() {
+        long long total = 0;
+        for (int i = 0; i < naive_q; i++) {
+            F f(n);
+            int t = 0;
+            while (t < T && !check(f, i)) apply(f, t++);
+            total += t;
+        }
+        do_not_optimize(total);
+    });
+    bench.run("parallel binary search, 1 thread", q, [&]() {
+        do_not_optimize(parallel_binary_search(q, T, make, apply, check).data());
+    });
+    bench.run("parallel binary search, all cores", q, [&]() {
+        do_not_optimize(parallel_binary_search(q, T, make, apply, check, 0).data());
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_thresholds(bench);
+    bench.summary();
+}
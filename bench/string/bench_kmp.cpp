@@ -0,0 +1,114 @@
+#include "../bench_runner.h"
+#include "string/kmp.hpp"
+
+using namespace std;
+
+// Log-like text: timestamps, levels, words from a small vocabulary.
+string make_log(size_t n, uint64_t seed) {
+    static const vector<string> words = {"request", "served", "user", "session", "cache", "miss", "hit",
+                                         "timeout", "GET", "POST", "/api/v1/items", "status=200", "status=404"};
+    static const vector<string> levels = {"INFO", "DEBUG", "WARN", "ERROR"};
+    mt19937_64 rng(seed);
+    string s;
+    s.reserve(n + 128);
+    while (s.size() < n) {
+        s += "2024-03-0" + to_string(1 + rng() % 9) + " 12:" + to_string(10 + rng() % 50) + ":00 ";
+        s += levels[rng() % 4];
+        for (int w = 0; w < 6; w++) s += ' ', s += words[rng() % words.size()];
+        s += " id=" + to_string(rng() % 100000) + "\n";
+    }
+    s.resize(n);
+    return s;
+}
+
+void bench_single_pattern(BenchRunner& bench) {
+    bench.set_module("Streaming KMP");
+    const size_t n = bench.scaled(200000000);
+    string text = make_log(n, 1);
+    const size_t chunk = 1 << 16;
+
+    for (string pat : {"status=500", "id=99999\n", "ERROR session"}) {
+        bench.run_bytes("KMP, 64 KiB chunks, \"" + (pat.back() == '\n' ? pat.substr(0, pat.size() - 1) : pat) + "\"", n,
+                        [&]() {
+                            KMP kmp(pat);
+                            long long cnt = 0;
+                            for (size_t i = 0; i < n; i += chunk)
+                                kmp.feed(string_view(text).substr(i, chunk), [&](uint64_t) { cnt++; });
+                            do_not_optimize(cnt);
+                        });
+    }
+    bench.run_bytes("string_view::find, \"ERROR session\"", n, [&]() {
+        long long cnt = 0;
+        string_view t(text);
+        for (size_t p = t.find("ERROR session"); p != string_view::npos; p = t.find("ERROR session", p + 1)) cnt++;
+        do_not_optimize(cnt);
+    });
+}
+
+void bench_many_patterns(BenchRunner& bench) {
+    bench.set_module("Aho-Corasick");
+    const size_t n = bench.scaled(200000000);
+    string text = make_log(n, 2);
+    mt19937_64 rng(3);
+
+    for (int k : {10, 1000, 5000}) {
+        vector<string> ps(k);
+        // ids to look for, plus a few vocabulary phrases that do occur
+        for (auto& p : ps) p = "id=" + to_string(rng() % 100000) + "\n";
+        ps[0] = "ERROR timeout", ps[1] = "status=404 GET";
+        AhoCorasick ac(ps);
+        bench.run_bytes(to_string(k) + " patterns (" + to_string(ac.states) + " states, " + to_string(ac.classes) +
+                            " classes)",
+                        n, [&]() {
+                            long long cnt = 0;
+                            auto st = ac.stream();
+                            st.feed(text, [&](int, uint64_t) { cnt++; });
+                            do_not_optimize(cnt);
+                        });
+        if (k == 10)
+            bench.run_bytes("10 patterns, one KMP each", n, [&]() {
+                long long cnt = 0;
+                for (auto& p : ps) {
+                    KMP kmp(p);
+                    kmp.feed(text, [&](uint64_t) { cnt++; });
+                }
+                do_not_optimize(cnt);
+            });
+    }
+}
+
+void bench_mapped_file(BenchRunner& bench) {
+    bench.set_module("Aho-Corasick over mmap");
+    const size_t n = bench.scaled(200000000);
+    string path = "/tmp/cp_bench_kmp_" + to_string(getpid()) + ".log";
+    {
+        string text = make_log(n, 4);
+        FILE* out = fopen(path.c_str(), "wb");
+        fwrite(text.data(), 1, text.size(), out);
+        fclose(out);
+    }
+    AhoCorasick ac({"ERROR", "timeout", "status=404", "id=12345\n"});
+    bench.run_bytes("MappedFile, 4 patterns", n, [&]() {
+        MappedFile file(path);
+        long long cnt = 0;
+        ac.stream().feed(file.view(), [&](int, uint64_t) { cnt++; });
+        do_not_optimize(cnt);
+    });
+    bench.run_bytes("read_chunks (1 MiB), 4 patterns", n, [&]() {
+        FILE* in = fopen(path.c_str(), "rb");
+        long long cnt = 0;
+        auto st = ac.stream();
+        read_chunks(in, 1 << 20, [&](string_view c) { st.feed(c, [&](int, uint64_t) { cnt++; }); });
+        fclose(in);
+        do_not_optimize(cnt);
+    });
+    remove(path.c_str());
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_single_pattern(bench);
+    bench_many_patterns(bench);
+    bench_mapped_file(bench);
+    bench.summary();
+}
@@ -0,0 +1,85 @@
+#include "../bench_runner.h"
+#include "string/rolling_hash.hpp"
+
+using namespace std;
+
+// Common double-hash baseline: two 32-bit prime moduli with `%`.
+struct DoubleModHash {
+    static constexpr uint64_t M1 = 1000000007, M2 = 998244353, B1 = 131, B2 = 137;
+    vector<uint64_t> h1, h2, p1, p2;
+    DoubleModHash(string_view s) : h1(s.size() + 1), h2(s.size() + 1), p1(s.size() + 1, 1), p2(s.size() + 1, 1) {
+        for (size_t i = 0; i < s.size(); i++) {
+            h1[i + 1] = (h1[i] * B1 + (unsigned char)s[i]) % M1;
+            h2[i + 1] = (h2[i] * B2 + (unsigned char)s[i]) % M2;
+            p1[i + 1] = p1[i] * B1 % M1;
+            p2[i + 1] = p2[i] * B2 % M2;
+        }
+    }
+    uint64_t get(size_t l, size_t r) const {
+        uint64_t a = (h1[r] + M1 * M1 - h1[l] * p1[r - l]) % M1;
+        uint64_t b = (h2[r] + M2 * M2 - h2[l] * p2[r - l]) % M2;
+        return a << 32 | b;
+    }
+};
+
+void bench_substring_hash(BenchRunner& bench) {
+    bench.set_module("Rolling hash - substring comparisons");
+    const int n = bench.scaled(10000000);
+    const int q = bench.scaled(20000000);
+    mt19937_64 rng(1);
+    string s(n, 'a');
+    for (auto& c : s) c = char('a' + rng() % 2);
+    vector<array<int, 3>> qs(q);
+    for (auto& [i, j, len] : qs) {
+        len = 1 + rng() % 1000;
+        i = rng() % (n - len), j = rng() % (n - len);
+    }
+
+    RollingHash h(s);
+    DoubleModHash d(s);
+    bench.run("build, mod 2^61 - 1", n, [&]() { do_not_optimize(RollingHash(s).pre.data()); });
+    bench.run("build, two 32-bit moduli", n, [&]() { do_not_optimize(DoubleModHash(s).h1.data()); });
+    bench.run("compare, mod 2^61 - 1", q, [&]() {
+        int eq = 0;
+        for (auto [i, j, len] : qs) eq += h.get(i, i + len) == h.get(j, j + len);
+        do_not_optimize(eq);
+    });
+    bench.run("compare, two 32-bit moduli", q, [&]() {
+        int eq = 0;
+        for (auto [i, j, len] : qs) eq += d.get(i, i + len) == d.get(j, j + len);
+        do_not_optimize(eq);
+    });
+    const int lq = q / 10;
+    bench.run("lcp by binary search", lq, [&]() {
+        size_t total = 0;
+        for (int t = 0; t < lq; t++) total += lcp(h, qs[t][0], h, qs[t][1]);
+        do_not_optimize(total);
+    });
+}
+
+void bench_windows(BenchRunner& bench) {
+    bench.set_module("Rolling hash - all windows of length k");
+    const size_t n = bench.scaled(50000000);
+    mt19937_64 rng(2);
+    string s(n, 'a');
+    for (auto& c : s) c = char('a' + rng() % 26);
+    const size_t k = 64;
+
+    bench.run_bytes("window_hashes (4 lanes)", n, [&]() {
+        auto w = window_hashes(s, k);
+        do_not_optimize(w.data());
+    });
+    bench.run_bytes("prefix hashes + get(i, i + k)", n, [&]() {
+        RollingHash h(s);
+        vector<uint64_t> w(n - k + 1);
+        for (size_t i = 0; i + k <= n; i++) w[i] = h.get(i, i + k);
+        do_not_optimize(w.data());
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_substring_hash(bench);
+    bench_windows(bench);
+    bench.summary();
+}
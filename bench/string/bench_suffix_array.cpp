@@ -0,0 +1,93 @@
+#include "../bench_runner.h"
+#include "string/suffix_array.hpp"
+
+using namespace std;
+
+// Prefix doubling with std::sort on (rank[i], rank[i + k]) pairs: O(n log^2 n).
+vector<int> sa_doubling(const string& s) {
+    int n = s.size();
+    vector<int> sa(n), rk(n), tmp(n);
+    for (int i = 0; i < n; i++) sa[i] = i, rk[i] = (unsigned char)s[i];
+    for (int k = 1;; k <<= 1) {
+        auto cmp = [&](int a, int b) {
+            if (rk[a] != rk[b]) return rk[a] < rk[b];
+            int ra = a + k < n ? rk[a + k] : -1, rb = b + k < n ? rk[b + k] : -1;
+            return ra < rb;
+        };
+        sort(sa.begin(), sa.end(), cmp);
+        tmp[sa[0]] = 0;
+        for (int i = 1; i < n; i++) tmp[sa[i]] = tmp[sa[i - 1]] + cmp(sa[i - 1], sa[i]);
+        rk.swap(tmp);
+        if (rk[sa[n - 1]] == n - 1) break;
+    }
+    return sa;
+}
+
+string make_text(int n, int sigma, uint64_t seed) {
+    mt19937_64 rng(seed);
+    string s(n, 'a');
+    for (auto& c : s) c = char('a' + rng() % sigma);
+    return s;
+}
+
+void bench_construction(BenchRunner& bench) {
+    bench.set_module("Suffix array - SA-IS vs doubling");
+    const int n = bench.scaled(2000000);
+    string random4 = make_text(n, 4, 1), random26 = make_text(n, 26, 2);
+    // log lines: long repeats, where doubling needs many rounds
+    string logs;
+    mt19937_64 rng(3);
+    while (int(logs.size()) < n)
+        logs += "2024-01-01 12:00:00 INFO request served id=" + to_string(rng() % 1000) + "\n";
+    logs.resize(n);
+
+    for (auto& [name, text] : vector<pair<string, const string*>>{
+             {"random, 4 letters", &random4}, {"random, 26 letters", &random26}, {"repetitive log", &logs}}) {
+        vector<int> sa;
+        bench.run("SA-IS, " + name, n, [&]() {
+            suffix_array_into(*text, sa);
+            do_not_optimize(sa.data());
+        });
+        bench.run("doubling, " + name, n, [&]() {
+            auto d = sa_doubling(*text);
+            do_not_optimize(d.data());
+        });
+        bench.run("Kasai LCP, " + name, n, [&]() {
+            auto lcp = lcp_array(*text, sa);
+            do_not_optimize(lcp.data());
+        });
+    }
+}
+
+void bench_queries(BenchRunner& bench) {
+    bench.set_module("Suffix array - queries");
+    const int n = bench.scaled(1000000);
+    const int q = bench.scaled(1000000);
+    SuffixArray st(make_text(n, 4, 4));
+    mt19937_64 rng(5);
+    vector<pair<int, int>> qs(q);
+    vector<string> pats(q);
+    for (int i = 0; i < q; i++) {
+        qs[i] = {int(rng() % n), int(rng() % n)};
+        int p = int(rng() % (n - 12));
+        pats[i] = st.s.substr(p, 4 + rng() % 8);
+    }
+
+    bench.run("lcp_query (RMQ)", q, [&]() {
+        long long s = 0;
+        for (auto [i, j] : qs) s += st.lcp_query(i, j);
+        do_not_optimize(s);
+    });
+    bench.run("count(pattern)", q, [&]() {
+        long long s = 0;
+        for (auto& p : pats) s += st.count(p);
+        do_not_optimize(s);
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_construction(bench);
+    bench_queries(bench);
+    bench.summary();
+}
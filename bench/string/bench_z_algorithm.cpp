@@ -0,0 +1,73 @@
+#include "../bench_runner.h"
+#include "string/z_algorithm.hpp"
+
+using namespace std;
+
+// Textbook Z-function with a byte-by-byte extension loop.
+vector<int> z_bytewise(string_view s) {
+    int n = s.size();
+    vector<int> z(n);
+    if (n) z[0] = n;
+    for (int i = 1, l = 0, r = 0; i < n; i++) {
+        if (i < r) z[i] = min(r - i, z[i - l]);
+        while (i + z[i] < n && s[z[i]] == s[i + z[i]]) z[i]++;
+        if (i + z[i] > r) l = i, r = i + z[i];
+    }
+    return z;
+}
+
+void bench_z(BenchRunner& bench) {
+    bench.set_module("Z-function - vectorized vs bytewise extension");
+    const size_t n = bench.scaled(100000000);
+    mt19937_64 rng(1);
+
+    string random(n, 'a'), runs, periodic;
+    for (auto& c : random) c = char('a' + rng() % 4);
+    // long runs of one letter: every restart extends far
+    while (runs.size() < n) runs += string(1 + rng() % 5000, char('a' + rng() % 2));
+    runs.resize(n);
+    // a long period with rare defects
+    string unit(10007, 'a');
+    for (auto& c : unit) c = char('a' + rng() % 26);
+    while (periodic.size() < n) periodic += unit;
+    periodic.resize(n);
+    for (int d = 0; d < 1000; d++) periodic[rng() % n] = '#';
+
+    for (auto& [name, s] : vector<pair<string, const string*>>{
+             {"random, 4 letters", &random}, {"long runs", &runs}, {"periodic with defects", &periodic}}) {
+        bench.run_bytes("z_function, " + name, n, [&]() {
+            auto z = z_function(*s);
+            do_not_optimize(z.data());
+        });
+        bench.run_bytes("bytewise, " + name, n, [&]() {
+            auto z = z_bytewise(*s);
+            do_not_optimize(z.data());
+        });
+    }
+}
+
+void bench_search(BenchRunner& bench) {
+    bench.set_module("Z-function - pattern search");
+    const size_t n = bench.scaled(100000000);
+    string text;
+    while (text.size() < n) text += "abababababababababababababababac";
+    text.resize(n);
+    string pat = text.substr(2, 200);
+
+    bench.run_bytes("z_search, concatenation-free", n, [&]() {
+        size_t cnt = 0;
+        z_search(pat, text, [&](size_t) { cnt++; });
+        do_not_optimize(cnt);
+    });
+    bench.run_bytes("bytewise Z of p + '#' + t", n, [&]() {
+        auto z = z_bytewise(pat + '#' + text);
+        do_not_optimize(z.data());
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchRunner bench(argc, argv);
+    bench_z(bench);
+    bench_search(bench);
+    bench.summary();
+}
@@ -33,6 +33,7 @@
 
 #pragma once
 #include<bits/stdc++.h>
+#include "misc/perf_hooks.hpp"
 using namespace std;
 
 template <typename T, typename F>
@@ -99,6 +100,7 @@ private:
     void push(int node) {
         if (lazy[node].is_empty())
             return;
+        CP_PERF_COUNT("LazyRangeMax push");
 
         if (lazy[node].has_set) {
             apply_set((node << 1), lazy[node].set_val);
@@ -113,6 +115,7 @@ private:
     }
     
     void update_range(int node, int start, int end, int l, int r, T val, bool is_set) {        
+        CP_PERF_COUNT("LazyRangeMax visit");
         if (start > r || end < l) 
             return;
         
@@ -132,6 +135,7 @@ private:
     }
     
     T query_range(int node, int start, int end, int l, int r) {
+        CP_PERF_COUNT("LazyRangeMax visit");
         if (start > r || end < l) 
             return identity;
         
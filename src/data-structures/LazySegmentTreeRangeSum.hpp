@@ -28,6 +28,7 @@
 
 #pragma once
 #include<bits/stdc++.h>
+#include "misc/perf_hooks.hpp"
 using namespace std;
 
 template <typename T>
@@ -93,6 +94,7 @@ private:
     void push(int node, int start, int end) {
         if (lazy[node].is_empty())
             return;
+        CP_PERF_COUNT("LazyRangeSum push");
 
         int mid = (start + end) / 2;
         if (lazy[node].has_set) {
@@ -108,6 +110,7 @@ private:
     }
     
     void update_range(int node, int start, int end, int l, int r, T val, bool is_set) {        
+        CP_PERF_COUNT("LazyRangeSum visit");
         if (start > r || end < l) 
             return;
         
@@ -127,6 +130,7 @@ private:
     }
     
     T query_range(int node, int start, int end, int l, int r) {
+        CP_PERF_COUNT("LazyRangeSum visit");
         if (start > r || end < l) 
             return T(0);
         
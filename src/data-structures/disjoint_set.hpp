@@ -8,6 +8,8 @@
  * - `sameComponent(u, v)` checks if two nodes are in the same set.
  * - `parent(u)` returns the representative of u's set (with compression).
  * - `size(u)` returns the size of u's set.
+ * - `ConcurrentDSU`: lock-free variant for multi-threaded use (CAS linking of
+ *   the larger-index root under the smaller one, path halving in `parent`).
  *
  * Time: Inverse Ackermann
  * Space: O(n)
@@ -18,6 +20,9 @@
  *  bool ok = dsu.sameComponent(0, 1); // true
  *  int rep = dsu.parent(0);
  *  int sz  = dsu.size(1);
+ *
+ *  ConcurrentDSU cdsu(n);          // unite/parent/sameComponent are thread-safe
+ *  cdsu.unite(0, 1);
  */
 
 #pragma once
@@ -59,3 +64,47 @@ struct DSU {
         return true;
     }
 };
+
+struct ConcurrentDSU {
+    int n;
+    vector <atomic <int>> par;
+    ConcurrentDSU(int n = 0): n(n), par(n) {
+        for (int i = 0; i < n; i++)
+            par[i].store(i, memory_order_relaxed);
+    }
+    int parent(int u) {
+        while (true) {
+            int p = par[u].load(memory_order_relaxed);
+            if (p == u)
+                return u;
+            int gp = par[p].load(memory_order_relaxed);
+            if (p != gp)
+                par[u].compare_exchange_weak(p, gp, memory_order_relaxed);
+            u = gp;
+        }
+    }
+    bool sameComponent(int u, int v) {
+        while (true) {
+            u = parent(u);
+            v = parent(v);
+            if (u == v)
+                return true;
+            if (par[u].load(memory_order_acquire) == u)
+                return false;
+        }
+    }
+    bool unite(int u, int v) {
+        while (true) {
+            u = parent(u);
+            v = parent(v);
+            if (u == v)
+                return false;
+            if (u < v)
+                swap(u, v);
+
+            int expected = u;
+            if (par[u].compare_exchange_strong(expected, v, memory_order_acq_rel))
+                return true;
+        }
+    }
+};
@@ -33,6 +33,7 @@
  */
 #pragma once
 #include <bits/stdc++.h>
+#include "misc/binary_search.hpp"
 using namespace std;
 // kx + b -> {k, b}
 struct fraction {
@@ -84,7 +85,7 @@ struct offline_convex_hull {
         lines.push_back(l);
     }
     long long get(long long x) {
-        int ind = lower_bound(inter.begin(), inter.end(), fraction(x, 1)) - inter.begin() - 1;
+        int ind = branchless_lower_bound(inter.begin(), inter.end(), fraction(x, 1)) - inter.begin() - 1;
         return lines[ind].get(x);
     }
 };
@@ -8,6 +8,8 @@
  * - split(x, cnt): split first `cnt` elements into `{left, right}`.
  * - pull(): recompute aggregates for a node (currently only size).
  * - push(): placeholder for lazy propagation (extend as needed).
+ * - node(priority): a node with a given priority; node() draws it from the
+ *   global rng, which is not thread-safe.
  *
  * Time: Expected O(log n) per operation
  * Space: O(n)
@@ -27,6 +29,7 @@
 
 #pragma once
 #include <bits/stdc++.h>
+#include "misc/perf_hooks.hpp"
 using namespace std;
 
 mt19937 rng(chrono::steady_clock::now().time_since_epoch().count());
@@ -49,9 +52,12 @@ struct node {
     value val;
     int s;
 
-    node() {
+    node() : node(int(rng())) {}
+
+    explicit node(int priority) {
+        CP_PERF_COUNT("treap node");
         l = nullptr, r = nullptr;
-        priority = rng();
+        this->priority = priority;
         val = value();
     }
 
@@ -79,7 +85,7 @@ node * merge(node *l, node *r) {
     r->push();
 
     if (l->priority < r->priority) {
-        l->l = merge(l->r, r);
+        l->r = merge(l->r, r);
         l->pull();
         return l;
     }
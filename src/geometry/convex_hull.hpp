@@ -0,0 +1,254 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Convex hull of large point sets: Akl-Toussaint pre-filter,
+ * radix sort and Andrew's monotone chain.
+ *
+ * Features:
+ * - convex_hull(points, threads): hull vertices in counter-clockwise order,
+ *   starting from the smallest point (by x, then y), without collinear
+ *   points. Accepts vector<Point<T>> or PointsSoA<T>.
+ * - Akl-Toussaint: one pass finds the extreme points in 8 directions; points
+ *   strictly inside that octagon cannot be hull vertices and are dropped by
+ *   an AVX2 kernel (4 doubles per step) before sorting. The kernel works on
+ *   coordinates translated to the octagon's centre and only drops points
+ *   beyond a margin far above the rounding error, so it never loses a hull
+ *   vertex; the chain itself uses exact Point<T>::W orientation tests.
+ * - The survivors are radix sorted by x; runs of equal x are then sorted by y.
+ * - threads > 1 (0 = all cores) parallelises the extreme pass, the filter
+ *   and the sort, and splits the sorted survivors into x-contiguous chunks
+ *   whose hulls are built in parallel; one final chain over the chunk hull
+ *   vertices merges them.
+ *
+ * Requirements: see geometry/point.hpp (integer |coordinates| < 2^62).
+ * Time: O(n) filter + O(k) radix sort / chain for k survivors
+ *       (k = O(sqrt n) expected for points uniform in a disk)
+ * Space: O(n)
+ *
+ * Usage:
+ *  vector<PointI> pts = ...;
+ *  auto hull = convex_hull(pts);       // CCW
+ *  auto fast = convex_hull(pts, 0);    // all cores
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "geometry/point.hpp"
+#include "misc/parallel.hpp"
+#include "misc/radix_sort.hpp"
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CP_HULL_X86 1
+#endif
+using namespace std;
+
+namespace hull_detail {
+
+// Strided view, so AoS points (S = 2) and SoA arrays (S = 1) share one implementation.
+template <typename T, size_t S>
+struct View {
+    const T* x;
+    const T* y;
+    size_t n;
+    Point<T> operator[](size_t i) const { return {x[i * S], y[i * S]}; }
+};
+
+// Filter polygon in translated double coordinates: point p is strictly inside
+// iff cross(a[k], p - e[k]) > margin for every edge k.
+struct Octagon {
+    int m = 0;
+    double ex[8], ey[8], ax[8], ay[8], margin = 0;
+};
+
+inline bool inside(const Octagon& o, double x, double y) {
+    bool in = true;
+    for (int k = 0; k < o.m; k++)
+        in &= o.ax[k] * (y - o.ey[k]) - o.ay[k] * (x - o.ex[k]) > o.margin;
+    return in;
+}
+
+// Bit i of the result (for i < 4): point i of x[0, 4), y[0, 4) is strictly inside.
+inline unsigned inside_mask4(const Octagon& o, const double* x, const double* y) {
+    unsigned mask = 0;
+    for (int i = 0; i < 4; i++)
+        mask |= unsigned(inside(o, x[i], y[i])) << i;
+    return mask;
+}
+
+#ifdef CP_HULL_X86
+__attribute__((target("avx2"))) inline void inside_masks_avx2(const Octagon& o, const double* x, const double* y,
+                                                              size_t n, uint8_t* masks) {
+    const __m256d margin = _mm256_set1_pd(o.margin);
+    for (size_t i = 0; i < n; i += 4) {
+        __m256d px = _mm256_loadu_pd(x + i), py = _mm256_loadu_pd(y + i);
+        __m256d in = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        for (int k = 0; k < o.m; k++) {
+            __m256d dx = _mm256_sub_pd(px, _mm256_set1_pd(o.ex[k]));
+            __m256d dy = _mm256_sub_pd(py, _mm256_set1_pd(o.ey[k]));
+            __m256d c = _mm256_sub_pd(_mm256_mul_pd(_mm256_set1_pd(o.ax[k]), dy),
+                                      _mm256_mul_pd(_mm256_set1_pd(o.ay[k]), dx));
+            in = _mm256_and_pd(in, _mm256_cmp_pd(c, margin, _CMP_GT_OQ));
+        }
+        masks[i / 4] = uint8_t(_mm256_movemask_pd(in));
+    }
+}
+
+inline const bool hull_use_avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+// masks[i / 4] = inside_mask4 of points i .. i + 3; n is a multiple of 4.
+inline void inside_masks(const Octagon& o, const double* x, const double* y, size_t n, uint8_t* masks) {
+#ifdef CP_HULL_X86
+    if (hull_use_avx2)
+        return inside_masks_avx2(o, x, y, n, masks);
+#endif
+    for (size_t i = 0; i < n; i += 4)
+        masks[i / 4] = uint8_t(inside_mask4(o, x + i, y + i));
+}
+
+// Andrew's monotone chain over sorted, possibly repeated points.
+template <typename T>
+vector<Point<T>> monotone_chain(const Point<T>* p, size_t n) {
+    if (n <= 1)
+        return vector<Point<T>>(p, p + n);
+    vector<Point<T>> h(n + 1);
+    size_t s = 0, t = 0;
+    for (int pass = 0; pass < 2; pass++, s = --t) {
+        for (size_t j = 0; j < n; j++) {
+            const Point<T>& q = pass == 0 ? p[j] : p[n - 1 - j];
+            while (t >= s + 2 && cross(h[t - 2], h[t - 1], q) <= 0)
+                t--;
+            h[t++] = q;
+        }
+    }
+    h.resize(t - (t == 2 && h[0] == h[1]));
+    return h;
+}
+
+template <typename T, size_t S>
+vector<Point<T>> hull(View<T, S> v, int threads) {
+    using W = typename Point<T>::W;
+    const size_t n = v.n;
+    threads = resolve_threads(threads);
+    if (n < (1 << 16))
+        threads = 1;
+
+    // Support points in directions 0, 45, ..., 315 degrees (counter-clockwise):
+    // maxima of x, x + y, y, y - x, -x, -x - y, -y, x - y.
+    auto scores = [](const Point<T>& p) {
+        W x = p.x, y = p.y;
+        return array<W, 8>{x, x + y, y, y - x, -x, -x - y, -y, x - y};
+    };
+    vector<array<size_t, 8>> best(threads);
+    parallel_for(n, threads, [&](long long b, long long e, int tid) {
+        auto top = scores(v[b]);
+        auto& bt = best[tid];
+        bt.fill(b);
+        for (long long i = b + 1; i < e; i++) {
+            auto sc = scores(v[i]);
+            for (int d = 0; d < 8; d++)
+                if (sc[d] > top[d])
+                    top[d] = sc[d], bt[d] = i;
+        }
+    });
+    vector<Point<T>> cand;
+    array<size_t, 8> sup{};
+    if (n > 0) {
+        sup = best[0];
+        for (int t = 1; t < threads; t++)
+            for (int d = 0; d < 8; d++)
+                if (scores(v[best[t][d]])[d] > scores(v[sup[d]])[d])
+                    sup[d] = best[t][d];
+    }
+
+    Octagon o;
+    vector<Point<T>> poly;
+    for (int d = 0; d < 8; d++)
+        if (n > 0 && (poly.empty() || (v[sup[d]] != poly.back() && v[sup[d]] != poly[0])))
+            poly.push_back(v[sup[d]]);
+    const T rx = v.n ? v[sup[4]].x + (v[sup[0]].x - v[sup[4]].x) / 2 : T(0);
+    const T ry = v.n ? v[sup[6]].y + (v[sup[2]].y - v[sup[6]].y) / 2 : T(0);
+    if (n >= 64 && poly.size() >= 3) {
+        o.m = poly.size();
+        double range = 0;
+        for (int k = 0; k < o.m; k++) {
+            o.ex[k] = double(poly[k].x - rx), o.ey[k] = double(poly[k].y - ry);
+            range = max({range, abs(o.ex[k]), abs(o.ey[k])});
+        }
+        for (int k = 0; k < o.m; k++)
+            o.ax[k] = o.ex[(k + 1) % o.m] - o.ex[k], o.ay[k] = o.ey[(k + 1) % o.m] - o.ey[k];
+        // Rounding error of the double cross products is below 1e-15 * range^2.
+        o.margin = 1e-9 * range * range;
+    }
+
+    if (o.m == 0) {
+        cand.resize(n);
+        for (size_t i = 0; i < n; i++)
+            cand[i] = v[i];
+    } else {
+        vector<vector<Point<T>>> kept(threads);
+        parallel_for(n, threads, [&](long long b, long long e, int tid) {
+            constexpr size_t BLOCK = 512;
+            double bx[BLOCK], by[BLOCK];
+            uint8_t masks[BLOCK / 4];
+            for (long long s = b; s < e; s += BLOCK) {
+                size_t len = min<long long>(BLOCK, e - s), padded = (len + 3) & ~size_t(3);
+                const T* px = v.x + s * S;
+                const T* py = v.y + s * S;
+                for (size_t i = 0; i < len; i++)
+                    bx[i] = double(px[i * S] - rx), by[i] = double(py[i * S] - ry);
+                for (size_t i = len; i < padded; i++)
+                    bx[i] = by[i] = 0;
+                inside_masks(o, bx, by, padded, masks);
+                // Walk the outside points 64 at a time by bit scans.
+                for (size_t w = 0; w < padded; w += 64) {
+                    uint64_t out = 0;
+                    for (size_t j = 0; j < 16 && w + 4 * j < padded; j++)
+                        out |= uint64_t(~masks[w / 4 + j] & 15) << (4 * j);
+                    if (len - w < 64)
+                        out &= (uint64_t(1) << (len - w)) - 1;
+                    for (; out; out &= out - 1)
+                        kept[tid].push_back(v[s + w + __builtin_ctzll(out)]);
+                }
+            }
+        });
+        for (auto& k : kept)
+            cand.insert(cand.end(), k.begin(), k.end());
+    }
+
+    // Sort by x, then fix the (usually short) runs of equal x by y.
+    radix_sort(cand, [](const Point<T>& p) { return radix_key(p.x); }, threads);
+    for (size_t i = 0, j; i < cand.size(); i = j) {
+        for (j = i + 1; j < cand.size() && cand[j].x == cand[i].x;)
+            j++;
+        if (j - i > 1)
+            sort(cand.begin() + i, cand.begin() + j);
+    }
+
+    const size_t k = cand.size();
+    if (threads == 1 || k < (1 << 16))
+        return monotone_chain(cand.data(), k);
+    vector<vector<Point<T>>> part(threads);
+    parallel_for(k, threads, [&](long long b, long long e, int tid) { part[tid] = monotone_chain(cand.data() + b, e - b); });
+    vector<Point<T>> merged;
+    for (auto& h : part)
+        merged.insert(merged.end(), h.begin(), h.end());
+    sort(merged.begin(), merged.end());
+    return monotone_chain(merged.data(), merged.size());
+}
+
+}  // namespace hull_detail
+
+template <typename T>
+vector<Point<T>> convex_hull(const vector<Point<T>>& pts, int threads = 1) {
+    static_assert(sizeof(Point<T>) == 2 * sizeof(T));
+    if (pts.empty())
+        return {};
+    return hull_detail::hull(hull_detail::View<T, 2>{&pts[0].x, &pts[0].y, pts.size()}, threads);
+}
+
+template <typename T>
+vector<Point<T>> convex_hull(const PointsSoA<T>& pts, int threads = 1) {
+    if (pts.size() == 0)
+        return {};
+    return hull_detail::hull(hull_detail::View<T, 1>{pts.x.data(), pts.y.data(), pts.size()}, threads);
+}
@@ -0,0 +1,120 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Intersection of half-planes by angular sort and a deque sweep.
+ *
+ * Features:
+ * - HalfPlane<T>(a, b): the points on or to the left of the directed line
+ *   a -> b (a != b).
+ * - half_plane_intersection(hs): vertices of the intersection in
+ *   counter-clockwise order, or empty if it has zero area. The region must
+ *   be bounded; add the four sides of a bounding box if unsure.
+ * - Integer input is exact: the sort compares directions by cross products,
+ *   and line intersections are kept as rational points (x / den, y / den)
+ *   in __int128, so deciding whether a vertex survives a half-plane never
+ *   rounds. Only the returned vertices are converted to double.
+ *
+ * Requirements: integer |coordinates| <= 2^29 (the 128-bit predicate is
+ * degree 4 in the coordinates); floating point T is evaluated in T.
+ * Time: O(n log n)
+ * Space: O(n)
+ *
+ * Usage:
+ *  vector<HalfPlane<long long>> hs = {{{0, 0}, {4, 0}}, {{4, 0}, {0, 4}}, {{0, 4}, {0, 0}}};
+ *  auto poly = half_plane_intersection(hs);   // the triangle
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "geometry/point.hpp"
+using namespace std;
+
+template <typename T>
+struct HalfPlane {
+    Point<T> p, d;   // line p + t d, region on its left
+
+    HalfPlane() = default;
+    HalfPlane(const Point<T>& a, const Point<T>& b) : p(a), d(b - a) {}
+};
+
+namespace hpi_detail {
+
+template <typename T>
+using E = conditional_t<is_integral_v<T>, __int128, T>;
+
+// Intersection point (x / den, y / den) of two non-parallel lines, den > 0.
+template <typename T>
+struct Meet {
+    E<T> x, y, den;
+};
+
+template <typename T>
+Meet<T> meet(const HalfPlane<T>& g, const HalfPlane<T>& h) {
+    E<T> den = E<T>(g.d.x) * h.d.y - E<T>(g.d.y) * h.d.x;
+    E<T> t = E<T>(h.p.x - g.p.x) * h.d.y - E<T>(h.p.y - g.p.y) * h.d.x;
+    Meet<T> m{E<T>(g.p.x) * den + E<T>(g.d.x) * t, E<T>(g.p.y) * den + E<T>(g.d.y) * t, den};
+    if (m.den < 0)
+        m = {-m.x, -m.y, -m.den};
+    return m;
+}
+
+// m is not strictly inside h.
+template <typename T>
+bool outside(const HalfPlane<T>& h, const Meet<T>& m) {
+    E<T> dx = m.x - E<T>(h.p.x) * m.den, dy = m.y - E<T>(h.p.y) * m.den;
+    return E<T>(h.d.x) * dy - E<T>(h.d.y) * dx <= 0;
+}
+
+template <typename T>
+bool upper(const Point<T>& d) {
+    return d.y > 0 || (d.y == 0 && d.x > 0);
+}
+
+}  // namespace hpi_detail
+
+template <typename T>
+vector<PointD> half_plane_intersection(vector<HalfPlane<T>> hs) {
+    using namespace hpi_detail;
+    // By direction angle in [0, 2 pi); among parallel ones the innermost first.
+    sort(hs.begin(), hs.end(), [](const HalfPlane<T>& a, const HalfPlane<T>& b) {
+        if (upper(a.d) != upper(b.d))
+            return upper(a.d);
+        auto c = a.d.cross(b.d);
+        if (c != 0)
+            return c > 0;
+        return b.d.cross(a.p - b.p) > 0;
+    });
+    hs.erase(unique(hs.begin(), hs.end(),
+                    [](const HalfPlane<T>& a, const HalfPlane<T>& b) {
+                        return upper(a.d) == upper(b.d) && a.d.cross(b.d) == 0;
+                    }),
+             hs.end());
+
+    const int n = hs.size();
+    vector<int> dq(n);
+    int lo = 0, hi = 0;   // deque = dq[lo, hi)
+    auto corner = [&](int i, int j) { return meet(hs[dq[i]], hs[dq[j]]); };
+    for (int k = 0; k < n; k++) {
+        while (hi - lo >= 2 && outside(hs[k], corner(hi - 2, hi - 1)))
+            hi--;
+        while (hi - lo >= 2 && outside(hs[k], corner(lo, lo + 1)))
+            lo++;
+        // Only opposite directions remain parallel after the dedup: the
+        // strip between them has no inner corner left, so the region is empty.
+        if (hi > lo && hs[k].d.cross(hs[dq[hi - 1]].d) == 0)
+            return {};
+        dq[hi++] = k;
+    }
+    while (hi - lo >= 3 && outside(hs[dq[lo]], corner(hi - 2, hi - 1)))
+        hi--;
+    while (hi - lo >= 3 && outside(hs[dq[hi - 1]], corner(lo, lo + 1)))
+        lo++;
+    if (hi - lo < 3)
+        return {};
+
+    vector<PointD> res;
+    for (int i = lo; i < hi; i++) {
+        Meet<T> m = corner(i, i + 1 < hi ? i + 1 : lo);
+        res.push_back({double((long double)m.x / (long double)m.den), double((long double)m.y / (long double)m.den)});
+    }
+    return res;
+}
@@ -0,0 +1,73 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Minkowski sum of convex polygons and the collision test built
+ * on it.
+ *
+ * Features:
+ * - minkowski_sum(P, Q): {p + q}, as a convex polygon in the same format as
+ *   convex_hull (counter-clockwise from the smallest point, no collinear
+ *   vertices). Both edge sequences are already sorted by angle once each
+ *   polygon starts at its lowest point, so they are merged like two sorted
+ *   lists; parallel edges are merged into one.
+ * - convex_intersect(P, Q): whether the polygons share a point (touching
+ *   counts), i.e. whether the origin lies in P + (-Q).
+ *
+ * Requirements: P and Q strictly convex, counter-clockwise, no repeated
+ * points (single points and segments allowed). Sums of coordinates must fit
+ * in T.
+ * Time: O(n + m) for the sum, O(n + m) for the intersection test
+ * Space: O(n + m)
+ *
+ * Usage:
+ *  auto s = minkowski_sum(convex_hull(a), convex_hull(b));
+ *  bool hit = convex_intersect(ship, rock);
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "geometry/point.hpp"
+#include "geometry/polygon.hpp"
+using namespace std;
+
+namespace minkowski_detail {
+
+// Rotates p to start at its lowest (by y, then x) vertex.
+template <typename T>
+void from_lowest(vector<Point<T>>& p) {
+    auto low = min_element(p.begin(), p.end(), [](const Point<T>& a, const Point<T>& b) {
+        return a.y < b.y || (a.y == b.y && a.x < b.x);
+    });
+    rotate(p.begin(), low, p.end());
+}
+
+}  // namespace minkowski_detail
+
+template <typename T>
+vector<Point<T>> minkowski_sum(vector<Point<T>> P, vector<Point<T>> Q) {
+    using minkowski_detail::from_lowest;
+    if (P.empty() || Q.empty())
+        return {};
+    from_lowest(P);
+    from_lowest(Q);
+    const size_t n = P.size(), m = Q.size();
+    P.push_back(P[0]), P.push_back(P[1 % n]);
+    Q.push_back(Q[0]), Q.push_back(Q[1 % m]);
+    vector<Point<T>> res;
+    res.reserve(n + m);
+    for (size_t i = 0, j = 0; i < n || j < m;) {
+        res.push_back(P[i] + Q[j]);
+        auto c = (P[i + 1] - P[i]).cross(Q[j + 1] - Q[j]);
+        // Take the edge with the smaller angle, or both when parallel.
+        bool step_p = c >= 0 && i < n, step_q = c <= 0 && j < m;
+        i += step_p, j += step_q;
+    }
+    rotate(res.begin(), min_element(res.begin(), res.end()), res.end());
+    return res;
+}
+
+template <typename T>
+bool convex_intersect(const vector<Point<T>>& P, vector<Point<T>> Q) {
+    for (auto& q : Q)
+        q = -q;
+    return ConvexPolygon<T>(minkowski_sum(P, std::move(Q))).locate({0, 0}) != Location::outside;
+}
@@ -0,0 +1,95 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: 2-D point / vector with exact integer predicates, plus a
+ * structure-of-arrays container for bulk point sets.
+ *
+ * Features:
+ * - Point<T>: +, -, scalar *, ==, < (by x, then y), dot, cross, norm2.
+ *   dot / cross / norm2 return Point<T>::W: long long for 32-bit integer
+ *   coordinates, __int128 for 64-bit ones, T itself for floating point, so
+ *   integer predicates never overflow.
+ * - cross(a, b, c) / orientation(a, b, c): twice the signed area of abc and
+ *   its sign (+1 = counter-clockwise, -1 = clockwise, 0 = collinear).
+ * - PointsSoA<T>: separate x[] and y[] arrays; bulk kernels (hull
+ *   pre-filter, containment) stream these with vector loads.
+ *
+ * Requirements: integer coordinates satisfy |x|, |y| < 2^62, so every
+ * difference of two points fits in T.
+ * Time: O(1) per operation
+ *
+ * Usage:
+ *  using P = Point<long long>;
+ *  P a{0, 0}, b{4, 0}, c{1, 3};
+ *  int o = orientation(a, b, c);     // 1
+ *  __int128 area2 = cross(a, b, c);  // 12
+ *  PointsSoA<long long> soa(vector<P>{a, b, c});
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+template <typename T>
+struct Point {
+    using W = conditional_t<is_integral_v<T>, conditional_t<(sizeof(T) <= 4), long long, __int128>, T>;
+
+    T x = 0, y = 0;
+
+    Point operator+(const Point& o) const { return {x + o.x, y + o.y}; }
+    Point operator-(const Point& o) const { return {x - o.x, y - o.y}; }
+    Point operator-() const { return {-x, -y}; }
+    Point operator*(T k) const { return {x * k, y * k}; }
+    bool operator==(const Point& o) const { return x == o.x && y == o.y; }
+    bool operator!=(const Point& o) const { return !(*this == o); }
+    bool operator<(const Point& o) const { return x < o.x || (x == o.x && y < o.y); }
+
+    W dot(const Point& o) const { return W(x) * o.x + W(y) * o.y; }
+    W cross(const Point& o) const { return W(x) * o.y - W(y) * o.x; }
+    W norm2() const { return dot(*this); }
+    double length() const { return hypot(double(x), double(y)); }
+
+    friend ostream& operator<<(ostream& os, const Point& p) { return os << '(' << p.x << ", " << p.y << ')'; }
+};
+
+using PointI = Point<long long>;
+using PointD = Point<double>;
+
+// Twice the signed area of triangle abc.
+template <typename T>
+typename Point<T>::W cross(const Point<T>& a, const Point<T>& b, const Point<T>& c) {
+    return (b - a).cross(c - a);
+}
+
+template <typename T>
+int orientation(const Point<T>& a, const Point<T>& b, const Point<T>& c) {
+    auto v = cross(a, b, c);
+    return (v > 0) - (v < 0);
+}
+
+template <typename T>
+struct PointsSoA {
+    vector<T> x, y;
+
+    PointsSoA() = default;
+
+    explicit PointsSoA(const vector<Point<T>>& pts) : x(pts.size()), y(pts.size()) {
+        for (size_t i = 0; i < pts.size(); i++)
+            x[i] = pts[i].x, y[i] = pts[i].y;
+    }
+
+    size_t size() const { return x.size(); }
+
+    void push_back(const Point<T>& p) {
+        x.push_back(p.x);
+        y.push_back(p.y);
+    }
+
+    Point<T> operator[](size_t i) const { return {x[i], y[i]}; }
+
+    vector<Point<T>> to_points() const {
+        vector<Point<T>> pts(size());
+        for (size_t i = 0; i < size(); i++)
+            pts[i] = {x[i], y[i]};
+        return pts;
+    }
+};
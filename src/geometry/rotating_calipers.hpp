@@ -0,0 +1,70 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Rotating calipers over a convex polygon (e.g. convex_hull
+ * output): diameter and width in linear time.
+ *
+ * Features:
+ * - hull_diameter(h): farthest pair of vertices; dist2 is exact
+ *   (Point<T>::W). Both calipers only move forward, so O(n) in total.
+ * - hull_width(h): smallest distance between two parallel lines enclosing
+ *   the polygon. The antipodal vertex of every edge comes from the same
+ *   forward-only caliper; the per-edge heights are exact cross products, only
+ *   the final division by the edge length is in floating point.
+ *
+ * Requirements: h strictly convex, counter-clockwise, no repeated points
+ * (1 and 2 vertices allowed). See geometry/point.hpp.
+ * Time: O(n)
+ * Space: O(1)
+ *
+ * Usage:
+ *  auto h = convex_hull(pts);
+ *  auto d = hull_diameter(h);   // d.dist2, d.a, d.b
+ *  double w = hull_width(h);
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "geometry/point.hpp"
+using namespace std;
+
+template <typename T>
+struct HullDiameter {
+    typename Point<T>::W dist2 = 0;
+    Point<T> a, b;
+};
+
+template <typename T>
+HullDiameter<T> hull_diameter(const vector<Point<T>>& h) {
+    const int n = h.size();
+    HullDiameter<T> res;
+    if (n == 0)
+        return res;
+    res.a = res.b = h[0];
+    for (int i = 0, j = n < 2 ? 0 : 1; i < j; i++)
+        for (;; j = (j + 1) % n) {
+            auto d2 = (h[i] - h[j]).norm2();
+            if (d2 > res.dist2)
+                res = {d2, h[i], h[j]};
+            // Stop once the edge after j turns away from edge i.
+            if ((h[(j + 1) % n] - h[j]).cross(h[i + 1] - h[i]) >= 0)
+                break;
+        }
+    return res;
+}
+
+template <typename T>
+double hull_width(const vector<Point<T>>& h) {
+    const int n = h.size();
+    if (n < 3)
+        return 0;
+    long double best = numeric_limits<long double>::infinity();
+    for (int i = 0, j = 1; i < n; i++) {
+        const Point<T>& a = h[i];
+        const Point<T>& b = h[(i + 1) % n];
+        // Heights above edge ab rise and then fall around the polygon.
+        while (cross(a, b, h[(j + 1) % n]) >= cross(a, b, h[j]))
+            j = (j + 1) % n;
+        best = min(best, (long double)cross(a, b, h[j]) / sqrtl((long double)(b - a).norm2()));
+    }
+    return double(best);
+}
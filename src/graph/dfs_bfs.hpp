@@ -0,0 +1,356 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Cache-friendly traversal kernels over CSR graphs.
+ *
+ * Features:
+ * - CSRGraph: compressed adjacency (offsets + flat neighbor array), with the
+ *   original edge index of every arc so multi-edges stay distinguishable.
+ * - dfs_order: iterative DFS (explicit stack), pre/post order and parents.
+ * - low_link: iterative bridges and articulation points (undirected).
+ * - strongly_connected_components: iterative Tarjan, components numbered in
+ *   topological order of the condensation.
+ * - bfs: plain top-down BFS.
+ * - bfs_direction_optimizing: Beamer's top-down/bottom-up BFS with a bitmap
+ *   frontier, optionally multi-threaded. Bottom-up steps scan in-neighbors,
+ *   so directed graphs need the transpose (undirected: pass g twice).
+ * No recursion anywhere: safe on 10^7-vertex paths.
+ *
+ * Time: O(n + m) for every kernel
+ * Space: O(n + m)
+ *
+ * Usage:
+ *  vector<pair<int, int>> edges = {{0, 1}, {1, 2}};
+ *  CSRGraph g(n, edges, true);                          // undirected
+ *  auto order = dfs_order(g);                           // order.pre, order.post, order.parent
+ *  auto ll = low_link(g);                               // ll.bridges (edge ids), ll.articulation_points
+ *  CSRGraph d(n, edges), dt = d.transpose();
+ *  auto [cnt, comp] = strongly_connected_components(d);
+ *  vector<int> dist = bfs_direction_optimizing(d, dt, 0, 0);   // -1 = unreachable
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "misc/parallel.hpp"
+using namespace std;
+
+struct CSRGraph {
+    int n = 0;
+    vector<int> start;   // arcs of v are adj[start[v] .. start[v + 1])
+    vector<int> adj;
+    vector<int> eid;     // original edge index of each arc
+
+    CSRGraph() {}
+    CSRGraph(int n, const vector<pair<int, int>>& edges, bool undirected = false) : n(n), start(n + 1, 0) {
+        long long arcs = (long long)edges.size() * (undirected ? 2 : 1);
+        assert(arcs < INT_MAX);
+        for (auto [u, v] : edges) {
+            start[u + 1]++;
+            if (undirected)
+                start[v + 1]++;
+        }
+        for (int v = 0; v < n; v++)
+            start[v + 1] += start[v];
+        adj.resize(arcs);
+        eid.resize(arcs);
+        vector<int> slot(start.begin(), start.end() - 1);
+        for (int i = 0; i < int(edges.size()); i++) {
+            auto [u, v] = edges[i];
+            adj[slot[u]] = v;
+            eid[slot[u]++] = i;
+            if (undirected) {
+                adj[slot[v]] = u;
+                eid[slot[v]++] = i;
+            }
+        }
+    }
+
+    int degree(int v) const { return start[v + 1] - start[v]; }
+    int num_arcs() const { return adj.size(); }
+    span<const int> neighbors(int v) const { return {adj.data() + start[v], adj.data() + start[v + 1]}; }
+
+    CSRGraph transpose() const {
+        vector<pair<int, int>> edges(adj.size());
+        for (int v = 0; v < n; v++)
+            for (int i = start[v]; i < start[v + 1]; i++)
+                edges[eid[i]] = {adj[i], v};
+        return CSRGraph(n, edges);
+    }
+};
+
+struct DFSOrder {
+    vector<int> pre, post;   // vertices in visiting / finishing order
+    vector<int> parent;      // -1 for roots and unvisited vertices
+};
+
+// Iterative DFS from `root`, or from every unvisited vertex when root == -1.
+inline DFSOrder dfs_order(const CSRGraph& g, int root = -1) {
+    DFSOrder res;
+    res.parent.assign(g.n, -1);
+    res.pre.reserve(g.n);
+    res.post.reserve(g.n);
+    vector<char> seen(g.n, 0);
+    vector<pair<int, int>> st;   // (vertex, next arc)
+
+    auto run = [&](int r) {
+        seen[r] = 1;
+        res.pre.push_back(r);
+        st.push_back({r, g.start[r]});
+        while (!st.empty()) {
+            auto& [v, it] = st.back();
+            if (it < g.start[v + 1]) {
+                int to = g.adj[it++];
+                if (!seen[to]) {
+                    seen[to] = 1;
+                    res.parent[to] = v;
+                    res.pre.push_back(to);
+                    st.push_back({to, g.start[to]});
+                }
+            } else {
+                res.post.push_back(v);
+                st.pop_back();
+            }
+        }
+    };
+    if (root != -1)
+        run(root);
+    else
+        for (int v = 0; v < g.n; v++)
+            if (!seen[v])
+                run(v);
+    return res;
+}
+
+struct LowLink {
+    vector<int> tin, low;
+    vector<int> bridges;               // edge indices, ascending
+    vector<int> articulation_points;   // ascending
+};
+
+// Bridges and articulation points of an undirected CSRGraph.
+inline LowLink low_link(const CSRGraph& g) {
+    LowLink res;
+    res.tin.assign(g.n, -1);
+    res.low.assign(g.n, -1);
+    vector<char> is_cut(g.n, 0);
+    struct Frame {
+        int v, parent_edge, it;
+    };
+    vector<Frame> st;
+    int timer = 0;
+
+    for (int r = 0; r < g.n; r++) {
+        if (res.tin[r] != -1)
+            continue;
+        int root_children = 0;
+        res.tin[r] = res.low[r] = timer++;
+        st.push_back({r, -1, g.start[r]});
+        while (!st.empty()) {
+            auto& f = st.back();
+            int v = f.v;
+            if (f.it < g.start[v + 1]) {
+                int i = f.it++;
+                int to = g.adj[i];
+                if (g.eid[i] == f.parent_edge)
+                    continue;
+                if (res.tin[to] != -1) {
+                    res.low[v] = min(res.low[v], res.tin[to]);
+                } else {
+                    res.tin[to] = res.low[to] = timer++;
+                    st.push_back({to, g.eid[i], g.start[to]});
+                }
+                continue;
+            }
+            int pe = f.parent_edge;
+            st.pop_back();
+            if (st.empty())
+                break;
+            int p = st.back().v;
+            res.low[p] = min(res.low[p], res.low[v]);
+            if (res.low[v] > res.tin[p])
+                res.bridges.push_back(pe);
+            if (p == r)
+                root_children++;
+            else if (res.low[v] >= res.tin[p])
+                is_cut[p] = 1;
+        }
+        if (root_children > 1)
+            is_cut[r] = 1;
+    }
+    sort(res.bridges.begin(), res.bridges.end());
+    for (int v = 0; v < g.n; v++)
+        if (is_cut[v])
+            res.articulation_points.push_back(v);
+    return res;
+}
+
+// Iterative Tarjan. Returns {count, comp}; every arc u -> v has comp[u] <= comp[v].
+inline pair<int, vector<int>> strongly_connected_components(const CSRGraph& g) {
+    vector<int> idx(g.n, -1), low(g.n), comp(g.n, -1), st;
+    vector<pair<int, int>> call;   // (vertex, next arc)
+    int timer = 0, cnt = 0;
+    st.reserve(g.n);
+
+    for (int s = 0; s < g.n; s++) {
+        if (idx[s] != -1)
+            continue;
+        idx[s] = low[s] = timer++;
+        st.push_back(s);
+        call.push_back({s, g.start[s]});
+        while (!call.empty()) {
+            auto& [v, it] = call.back();
+            if (it < g.start[v + 1]) {
+                int w = g.adj[it++];
+                if (idx[w] == -1) {
+                    idx[w] = low[w] = timer++;
+                    st.push_back(w);
+                    call.push_back({w, g.start[w]});
+                } else if (comp[w] == -1) {
+                    low[v] = min(low[v], idx[w]);
+                }
+                continue;
+            }
+            int u = v;
+            call.pop_back();
+            if (low[u] == idx[u]) {
+                while (true) {
+                    int w = st.back();
+                    st.pop_back();
+                    comp[w] = cnt;
+                    if (w == u)
+                        break;
+                }
+                cnt++;
+            }
+            if (!call.empty()) {
+                int p = call.back().first;
+                low[p] = min(low[p], low[u]);
+            }
+        }
+    }
+    for (int& c : comp)
+        c = cnt - 1 - c;
+    return {cnt, comp};
+}
+
+// Top-down BFS. dist[v] = -1 if unreachable.
+inline vector<int> bfs(const CSRGraph& g, int src) {
+    vector<int> dist(g.n, -1), q(g.n);
+    int head = 0, tail = 0;
+    dist[src] = 0;
+    q[tail++] = src;
+    while (head < tail) {
+        int v = q[head++];
+        for (int i = g.start[v]; i < g.start[v + 1]; i++) {
+            int to = g.adj[i];
+            if (dist[to] == -1) {
+                dist[to] = dist[v] + 1;
+                q[tail++] = to;
+            }
+        }
+    }
+    return dist;
+}
+
+// Direction-optimizing BFS (Beamer et al.). `in` is the transpose of `g`.
+inline vector<int> bfs_direction_optimizing(const CSRGraph& g, const CSRGraph& in, int src, int threads = 1,
+                                     int alpha = 15, int beta = 18) {
+    threads = resolve_threads(threads);
+    int n = g.n;
+    int words = (n + 63) / 64;
+    vector<int> dist(n, -1);
+    vector<uint64_t> cur(words), next(words);
+    vector<int> frontier = {src};
+    vector<vector<int>> local(threads);
+    vector<long long> local_sum(threads);
+    dist[src] = 0;
+
+    auto claim = [&](int v, int d) {
+        if (threads == 1) {
+            if (dist[v] != -1)
+                return false;
+            dist[v] = d;
+            return true;
+        }
+        atomic_ref<int> ref(dist[v]);
+        int expected = -1;
+        return ref.load(memory_order_relaxed) == -1 &&
+               ref.compare_exchange_strong(expected, d, memory_order_relaxed);
+    };
+
+    long long edges_to_check = g.num_arcs();
+    long long scout = g.degree(src);
+    long long awake = 1;
+    bool bottom_up = false;
+    for (int level = 0; awake > 0; level++) {
+        if (!bottom_up && scout > edges_to_check / alpha) {
+            fill(cur.begin(), cur.end(), 0);
+            for (int v : frontier)
+                cur[v >> 6] |= 1ULL << (v & 63);
+            bottom_up = true;
+        }
+
+        if (bottom_up) {
+            fill(local_sum.begin(), local_sum.end(), 0);
+            parallel_for(words, threads, [&](long long b, long long e, int t) {
+                long long found = 0;
+                for (long long w = b; w < e; w++) {
+                    uint64_t bits = 0;
+                    int hi = min<long long>(n, (w + 1) * 64);
+                    for (int v = w * 64; v < hi; v++) {
+                        if (dist[v] != -1)
+                            continue;
+                        for (int i = in.start[v]; i < in.start[v + 1]; i++) {
+                            int u = in.adj[i];
+                            if (cur[u >> 6] >> (u & 63) & 1) {
+                                dist[v] = level + 1;
+                                bits |= 1ULL << (v & 63);
+                                found++;
+                                break;
+                            }
+                        }
+                    }
+                    next[w] = bits;
+                }
+                local_sum[t] = found;
+            });
+            long long prev_awake = awake;
+            awake = accumulate(local_sum.begin(), local_sum.end(), 0LL);
+            cur.swap(next);
+            if (awake < prev_awake && awake < n / beta) {
+                frontier.clear();
+                for (int w = 0; w < words; w++)
+                    for (uint64_t bits = cur[w]; bits; bits &= bits - 1)
+                        frontier.push_back(w * 64 + __builtin_ctzll(bits));
+                scout = 0;
+                for (int v : frontier)
+                    scout += g.degree(v);
+                bottom_up = false;
+            }
+        } else {
+            edges_to_check -= scout;
+            for (auto& l : local)
+                l.clear();
+            fill(local_sum.begin(), local_sum.end(), 0);
+            parallel_for(frontier.size(), threads, [&](long long b, long long e, int t) {
+                long long sum = 0;
+                for (long long k = b; k < e; k++) {
+                    int v = frontier[k];
+                    for (int i = g.start[v]; i < g.start[v + 1]; i++) {
+                        int to = g.adj[i];
+                        if (claim(to, level + 1)) {
+                            local[t].push_back(to);
+                            sum += g.degree(to);
+                        }
+                    }
+                }
+                local_sum[t] = sum;
+            });
+            frontier.clear();
+            for (auto& l : local)
+                frontier.insert(frontier.end(), l.begin(), l.end());
+            scout = accumulate(local_sum.begin(), local_sum.end(), 0LL);
+            awake = frontier.size();
+        }
+    }
+    return dist;
+}
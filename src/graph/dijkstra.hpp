@@ -0,0 +1,258 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Dijkstra shortest paths with pluggable priority queues.
+ *
+ * Provides three heaps sharing one interface (push(v, d), pop() -> {d, v},
+ * empty(), clear()) so that the same Dijkstra loop can be reused by other
+ * modules (e.g. min-cost flow in flow.hpp):
+ * - DaryHeap<D, K>: indexed K-ary heap with decrease-key, never holds stale
+ *   entries. Default choice.
+ * - RadixHeap<D>: monotone heap for non-negative integer keys, amortized
+ *   O(log C) per pop and very cheap pushes.
+ * - LazyBinaryHeap<D>: std::priority_queue with lazy deletion.
+ *
+ * Requirements:
+ * - Non-negative edge weights.
+ * - Keys pushed into RadixHeap must not be smaller than the last popped key.
+ *
+ * Time: O((V + E) log V) with DaryHeap/LazyBinaryHeap, O(V^2 + E) dense
+ * Space: O(V + E)
+ *
+ * Usage:
+ *  vector<vector<pair<int, long long>>> adj(n);
+ *  adj[u].push_back({v, w});
+ *  vector<long long> dist = dijkstra(adj, 0);                 // DaryHeap
+ *  auto d2 = dijkstra<long long, RadixHeap<long long>>(adj, 0);
+ *
+ *  vector<int> par;
+ *  auto d3 = dijkstra(adj, 0, &par);                          // par[v] = previous vertex or -1
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Indexed K-ary min-heap over vertices 0..n-1 with decrease-key.
+template <typename D, int K = 4>
+class DaryHeap {
+private:
+    vector<int> heap;
+    vector<int> pos;   // position in heap, -1 if absent
+    vector<D> key;
+
+    void sift_up(int i) {
+        int v = heap[i];
+        while (i > 0) {
+            int p = (i - 1) / K;
+            if (!(key[v] < key[heap[p]]))
+                break;
+            heap[i] = heap[p];
+            pos[heap[i]] = i;
+            i = p;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+
+    void sift_down(int i) {
+        int v = heap[i];
+        int sz = heap.size();
+        while (true) {
+            int c = i * K + 1;
+            if (c >= sz)
+                break;
+            int best = c;
+            int last = min(c + K, sz);
+            for (int j = c + 1; j < last; j++)
+                if (key[heap[j]] < key[heap[best]])
+                    best = j;
+            if (!(key[heap[best]] < key[v]))
+                break;
+            heap[i] = heap[best];
+            pos[heap[i]] = i;
+            i = best;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+
+public:
+    explicit DaryHeap(int n = 0) : pos(n, -1), key(n) {}
+
+    void reset(int n) {
+        heap.clear();
+        pos.assign(n, -1);
+        key.resize(n);
+    }
+
+    bool empty() const { return heap.empty(); }
+    int size() const { return heap.size(); }
+    bool contains(int v) const { return pos[v] != -1; }
+
+    // Insert v with key d, or decrease its key if it is already present.
+    void push(int v, D d) {
+        if (pos[v] == -1) {
+            key[v] = d;
+            heap.push_back(v);
+            sift_up(heap.size() - 1);
+        } else if (d < key[v]) {
+            key[v] = d;
+            sift_up(pos[v]);
+        }
+    }
+
+    pair<D, int> top() const {
+        assert(!heap.empty());
+        return {key[heap[0]], heap[0]};
+    }
+
+    pair<D, int> pop() {
+        assert(!heap.empty());
+        int v = heap[0];
+        pos[v] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            pos[last] = 0;
+            sift_down(0);
+        }
+        return {key[v], v};
+    }
+
+    // O(size), keeps the index arrays allocated.
+    void clear() {
+        for (int v : heap)
+            pos[v] = -1;
+        heap.clear();
+    }
+};
+
+// Monotone radix heap for non-negative integer keys.
+template <typename D>
+class RadixHeap {
+    static_assert(is_integral_v<D>, "RadixHeap requires integer keys");
+    using U = make_unsigned_t<D>;
+    static constexpr int B = numeric_limits<U>::digits + 1;
+
+private:
+    array<vector<pair<U, int>>, B> buckets;
+    U last = 0;
+    size_t sz = 0;
+
+    static int bucket_of(U x) { return bit_width(x); }
+
+public:
+    explicit RadixHeap(int = 0) {}
+
+    void reset(int) { clear(); }
+    bool empty() const { return sz == 0; }
+    int size() const { return sz; }
+
+    void push(int v, D d) {
+        assert(d >= 0 && U(d) >= last);
+        buckets[bucket_of(U(d) ^ last)].emplace_back(U(d), v);
+        sz++;
+    }
+
+    pair<D, int> pop() {
+        assert(sz > 0);
+        if (buckets[0].empty()) {
+            int i = 1;
+            while (buckets[i].empty())
+                i++;
+            last = numeric_limits<U>::max();
+            for (auto& [k, v] : buckets[i])
+                last = min(last, k);
+            for (auto& p : buckets[i])
+                buckets[bucket_of(p.first ^ last)].push_back(p);
+            buckets[i].clear();
+        }
+        auto [k, v] = buckets[0].back();
+        buckets[0].pop_back();
+        sz--;
+        return {D(k), v};
+    }
+
+    void clear() {
+        for (auto& b : buckets)
+            b.clear();
+        last = 0;
+        sz = 0;
+    }
+};
+
+// std::priority_queue with lazy deletion; stale entries are filtered by the caller.
+template <typename D>
+class LazyBinaryHeap {
+private:
+    priority_queue<pair<D, int>, vector<pair<D, int>>, greater<pair<D, int>>> pq;
+
+public:
+    explicit LazyBinaryHeap(int = 0) {}
+
+    void reset(int) { clear(); }
+    bool empty() const { return pq.empty(); }
+    int size() const { return pq.size(); }
+    void push(int v, D d) { pq.emplace(d, v); }
+
+    pair<D, int> pop() {
+        auto p = pq.top();
+        pq.pop();
+        return p;
+    }
+
+    void clear() { pq = {}; }
+};
+
+// Single-source shortest paths. Unreachable vertices get numeric_limits<D>::max().
+template <typename D, typename Heap = DaryHeap<D>>
+vector<D> dijkstra(const vector<vector<pair<int, D>>>& adj, int src, vector<int>* parent = nullptr) {
+    const D INF = numeric_limits<D>::max();
+    int n = adj.size();
+    vector<D> dist(n, INF);
+    if (parent)
+        parent->assign(n, -1);
+
+    Heap heap(n);
+    dist[src] = 0;
+    heap.push(src, D(0));
+    while (!heap.empty()) {
+        auto [d, u] = heap.pop();
+        if (d > dist[u])
+            continue;
+        for (auto [v, w] : adj[u]) {
+            if (d + w < dist[v]) {
+                dist[v] = d + w;
+                if (parent)
+                    (*parent)[v] = u;
+                heap.push(v, dist[v]);
+            }
+        }
+    }
+    return dist;
+}
+
+// O(V^2) Dijkstra on an adjacency matrix, preferable when E ~ V^2.
+// w[u][v] < 0 means "no edge".
+template <typename D>
+vector<D> dijkstra_dense(const vector<vector<D>>& w, int src) {
+    const D INF = numeric_limits<D>::max();
+    int n = w.size();
+    vector<D> dist(n, INF);
+    vector<char> done(n, 0);
+    dist[src] = 0;
+    for (int it = 0; it < n; it++) {
+        int u = -1;
+        for (int v = 0; v < n; v++)
+            if (!done[v] && dist[v] != INF && (u == -1 || dist[v] < dist[u]))
+                u = v;
+        if (u == -1)
+            break;
+        done[u] = 1;
+        for (int v = 0; v < n; v++)
+            if (w[u][v] >= 0 && dist[u] + w[u][v] < dist[v])
+                dist[v] = dist[u] + w[u][v];
+    }
+    return dist;
+}
@@ -0,0 +1,437 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Maximum flow (Dinic) and minimum-cost flow.
+ *
+ * Features:
+ * - MaxFlow<Cap>: Dinic's algorithm, min cut extraction.
+ * - MinCostFlow<Cap, Cost>: successive shortest paths with Johnson potentials,
+ *   so every augmentation runs Dijkstra instead of Bellman-Ford. The Dijkstra
+ *   engine reuses the heaps from dijkstra.hpp:
+ *     Strategy::DaryHeap  - indexed 4-ary heap (default, sparse graphs)
+ *     Strategy::RadixHeap - monotone radix heap (integer costs only)
+ *     Strategy::Dense     - O(V^2) array scan, for E ~ V^2
+ *   Negative edge costs are allowed (no negative cycles); potentials are then
+ *   initialised with one Bellman-Ford pass.
+ * - MinCostFlow::flow_cost_scaling: Goldberg-Tarjan cost-scaling push-relabel
+ *   for min-cost max-flow. Running time depends on log(V * C) rather than on
+ *   the flow value, which wins for large integer costs and large flows.
+ *
+ * Requirements:
+ * - Integer Cost for RadixHeap and cost scaling.
+ * - Cost scaling multiplies costs by (V + 1) internally; |cost| * 3 * (V + 1)^2
+ *   must fit in Cost.
+ *
+ * Time: MaxFlow O(V^2 E); SSP O(F * E log V); cost scaling O(V^2 E log(V C))
+ * Space: O(V + E)
+ *
+ * Usage:
+ *  MinCostFlow<int, long long> mcf(n);
+ *  int id = mcf.add_edge(u, v, cap, cost);
+ *  auto [f, c] = mcf.flow(s, t);                                     // max flow, min cost
+ *  auto [f2, c2] = mcf.flow(s, t, 5, MinCostFlow<int, long long>::Strategy::Dense);
+ *  auto [f3, c3] = mcf.flow_cost_scaling(s, t);                      // recomputed from scratch
+ *  auto e = mcf.get_edge(id);                                        // e.flow
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "graph/dijkstra.hpp"
+using namespace std;
+
+template <typename Cap = long long>
+class MaxFlow {
+public:
+    struct Edge {
+        int from, to;
+        Cap cap, flow;
+    };
+
+private:
+    struct Arc {
+        int to, rev;
+        Cap cap;
+    };
+
+    int n;
+    vector<vector<Arc>> g;
+    vector<pair<int, int>> pos;
+    vector<int> level, iter;
+
+    bool bfs(int s, int t) {
+        level.assign(n, -1);
+        queue<int> q;
+        level[s] = 0;
+        q.push(s);
+        while (!q.empty()) {
+            int v = q.front();
+            q.pop();
+            for (auto& a : g[v]) {
+                if (a.cap > 0 && level[a.to] < 0) {
+                    level[a.to] = level[v] + 1;
+                    q.push(a.to);
+                }
+            }
+        }
+        return level[t] >= 0;
+    }
+
+    Cap dfs(int v, int t, Cap up) {
+        if (v == t)
+            return up;
+        for (int& i = iter[v]; i < int(g[v].size()); i++) {
+            Arc& a = g[v][i];
+            if (a.cap > 0 && level[v] < level[a.to]) {
+                Cap d = dfs(a.to, t, min(up, a.cap));
+                if (d > 0) {
+                    a.cap -= d;
+                    g[a.to][a.rev].cap += d;
+                    return d;
+                }
+            }
+        }
+        return 0;
+    }
+
+public:
+    explicit MaxFlow(int n_ = 0) : n(n_), g(n_) {}
+
+    int add_edge(int from, int to, Cap cap) {
+        assert(0 <= from && from < n && 0 <= to && to < n && cap >= 0);
+        int from_id = g[from].size();
+        int to_id = g[to].size() + (from == to);
+        pos.push_back({from, from_id});
+        g[from].push_back({to, to_id, cap});
+        g[to].push_back({from, from_id, 0});
+        return pos.size() - 1;
+    }
+
+    Edge get_edge(int i) const {
+        auto& a = g[pos[i].first][pos[i].second];
+        auto& r = g[a.to][a.rev];
+        return {pos[i].first, a.to, a.cap + r.cap, r.cap};
+    }
+
+    Cap flow(int s, int t, Cap limit = numeric_limits<Cap>::max()) {
+        Cap total = 0;
+        while (total < limit && bfs(s, t)) {
+            iter.assign(n, 0);
+            Cap f;
+            while (total < limit && (f = dfs(s, t, limit - total)) > 0)
+                total += f;
+        }
+        return total;
+    }
+
+    // Vertices reachable from s in the residual graph (source side of a min cut).
+    vector<bool> min_cut(int s) const {
+        vector<bool> vis(n, false);
+        queue<int> q;
+        vis[s] = true;
+        q.push(s);
+        while (!q.empty()) {
+            int v = q.front();
+            q.pop();
+            for (auto& a : g[v]) {
+                if (a.cap > 0 && !vis[a.to]) {
+                    vis[a.to] = true;
+                    q.push(a.to);
+                }
+            }
+        }
+        return vis;
+    }
+};
+
+template <typename Cap = long long, typename Cost = long long>
+class MinCostFlow {
+public:
+    enum class Strategy { DaryHeap, RadixHeap, Dense };
+
+    struct Edge {
+        int from, to;
+        Cap cap, flow;
+        Cost cost;
+    };
+
+private:
+    // Residual arcs in CSR order; cap is the residual capacity.
+    struct Arc {
+        int to, rev;
+        Cap cap;
+        Cost cost;
+    };
+
+    int n;
+    vector<Edge> edges;
+    vector<int> start, fwd;
+    vector<Arc> arcs;
+    vector<Cost> dual, dist;
+    vector<int> prev_arc;
+    vector<char> vis;
+
+    void build() {
+        int m = edges.size();
+        start.assign(n + 1, 0);
+        for (auto& e : edges) {
+            start[e.from + 1]++;
+            start[e.to + 1]++;
+        }
+        for (int v = 0; v < n; v++)
+            start[v + 1] += start[v];
+        vector<int> slot(start.begin(), start.end() - 1);
+        arcs.resize(2 * m);
+        fwd.resize(m);
+        for (int i = 0; i < m; i++) {
+            auto& e = edges[i];
+            int a = slot[e.from]++;
+            int b = slot[e.to]++;
+            arcs[a] = {e.to, b, e.cap - e.flow, e.cost};
+            arcs[b] = {e.from, a, e.flow, -e.cost};
+            fwd[i] = a;
+        }
+    }
+
+    void store() {
+        for (int i = 0; i < int(edges.size()); i++)
+            edges[i].flow = arcs[arcs[fwd[i]].rev].cap;
+    }
+
+    bool potentials_valid() const {
+        for (int v = 0; v < n; v++)
+            for (int i = start[v]; i < start[v + 1]; i++)
+                if (arcs[i].cap > 0 && arcs[i].cost + dual[v] - dual[arcs[i].to] < 0)
+                    return false;
+        return true;
+    }
+
+    // Johnson: make every residual reduced cost non-negative.
+    void init_potentials() {
+        if (potentials_valid())
+            return;
+        dual.assign(n, 0);
+        vector<int> cnt(n, 0);
+        vector<char> in_queue(n, 1);
+        deque<int> q(n);
+        iota(q.begin(), q.end(), 0);
+        while (!q.empty()) {
+            int v = q.front();
+            q.pop_front();
+            in_queue[v] = 0;
+            for (int i = start[v]; i < start[v + 1]; i++) {
+                auto& a = arcs[i];
+                if (a.cap > 0 && dual[v] + a.cost < dual[a.to]) {
+                    dual[a.to] = dual[v] + a.cost;
+                    if (!in_queue[a.to]) {
+                        cnt[a.to]++;
+                        assert(cnt[a.to] <= n && "negative cycle");
+                        in_queue[a.to] = 1;
+                        q.push_back(a.to);
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename OnImprove>
+    void relax(int v, OnImprove&& on_improve) {
+        Cost dv = dist[v] + dual[v];
+        for (int i = start[v]; i < start[v + 1]; i++) {
+            auto& a = arcs[i];
+            if (a.cap == 0)
+                continue;
+            Cost nd = dv + a.cost - dual[a.to];
+            if (nd < dist[a.to]) {
+                dist[a.to] = nd;
+                prev_arc[a.to] = i;
+                on_improve(a.to, nd);
+            }
+        }
+    }
+
+    template <typename Heap>
+    bool shortest_path_heap(int s, int t, Heap& heap) {
+        heap.push(s, Cost(0));
+        while (!heap.empty()) {
+            auto [d, v] = heap.pop();
+            if (vis[v] || d > dist[v])
+                continue;
+            vis[v] = 1;
+            if (v == t)
+                break;
+            relax(v, [&](int w, Cost nd) { heap.push(w, nd); });
+        }
+        heap.clear();
+        return vis[t];
+    }
+
+    bool shortest_path_dense(int t) {
+        const Cost INF = numeric_limits<Cost>::max();
+        while (true) {
+            int u = -1;
+            Cost best = INF;
+            for (int v = 0; v < n; v++)
+                if (!vis[v] && dist[v] < best)
+                    best = dist[v], u = v;
+            if (u == -1)
+                break;
+            vis[u] = 1;
+            if (u == t)
+                break;
+            relax(u, [](int, Cost) {});
+        }
+        return vis[t];
+    }
+
+    void refine(Cost eps, vector<Cap>& excess, vector<Cost>& p) {
+        for (int v = 0; v < n; v++) {
+            for (int i = start[v]; i < start[v + 1]; i++) {
+                auto& a = arcs[i];
+                if (a.cap > 0 && a.cost + p[v] - p[a.to] < 0) {
+                    excess[v] -= a.cap;
+                    excess[a.to] += a.cap;
+                    arcs[a.rev].cap += a.cap;
+                    a.cap = 0;
+                }
+            }
+        }
+
+        vector<int> cur(start.begin(), start.end() - 1);
+        deque<int> active;
+        for (int v = 0; v < n; v++)
+            if (excess[v] > 0)
+                active.push_back(v);
+
+        while (!active.empty()) {
+            int v = active.front();
+            active.pop_front();
+            while (excess[v] > 0) {
+                if (cur[v] == start[v + 1]) {
+                    // relabel: make the cheapest residual arc admissible
+                    Cost best = numeric_limits<Cost>::min();
+                    for (int i = start[v]; i < start[v + 1]; i++)
+                        if (arcs[i].cap > 0)
+                            best = max(best, p[arcs[i].to] - arcs[i].cost);
+                    assert(best != numeric_limits<Cost>::min());
+                    p[v] = best - eps;
+                    cur[v] = start[v];
+                    continue;
+                }
+                auto& a = arcs[cur[v]];
+                if (a.cap > 0 && a.cost + p[v] - p[a.to] < 0) {
+                    Cap d = min(excess[v], a.cap);
+                    bool was_active = excess[a.to] > 0;
+                    a.cap -= d;
+                    arcs[a.rev].cap += d;
+                    excess[v] -= d;
+                    excess[a.to] += d;
+                    if (!was_active && excess[a.to] > 0)
+                        active.push_back(a.to);
+                } else {
+                    cur[v]++;
+                }
+            }
+        }
+    }
+
+public:
+    explicit MinCostFlow(int n_ = 0) : n(n_), dual(n_, 0) {}
+
+    int add_edge(int from, int to, Cap cap, Cost cost) {
+        assert(0 <= from && from < n && 0 <= to && to < n && cap >= 0);
+        edges.push_back({from, to, cap, 0, cost});
+        return edges.size() - 1;
+    }
+
+    Edge get_edge(int i) const { return edges[i]; }
+    const vector<Edge>& get_edges() const { return edges; }
+
+    // Augments along shortest paths until `limit` units are sent or t becomes
+    // unreachable. Continues from the current flow on repeated calls.
+    pair<Cap, Cost> flow(int s, int t, Cap limit = numeric_limits<Cap>::max(),
+                         Strategy strategy = Strategy::DaryHeap) {
+        assert(s != t);
+        const Cost INF = numeric_limits<Cost>::max();
+        build();
+        init_potentials();
+        dist.assign(n, INF);
+        vis.assign(n, 0);
+        prev_arc.assign(n, -1);
+
+        DaryHeap<Cost> dheap(strategy == Strategy::DaryHeap ? n : 0);
+        conditional_t<is_integral_v<Cost>, RadixHeap<Cost>, LazyBinaryHeap<Cost>> rheap;
+
+        Cap flow = 0;
+        Cost cost = 0;
+        while (flow < limit) {
+            dist[s] = 0;
+            bool found;
+            if (strategy == Strategy::Dense)
+                found = shortest_path_dense(t);
+            else if (strategy == Strategy::RadixHeap)
+                found = shortest_path_heap(s, t, rheap);
+            else
+                found = shortest_path_heap(s, t, dheap);
+
+            if (found) {
+                for (int v = 0; v < n; v++)
+                    if (vis[v])
+                        dual[v] += dist[v] - dist[t];
+            }
+            fill(vis.begin(), vis.end(), 0);
+            fill(dist.begin(), dist.end(), INF);
+            if (!found)
+                break;
+
+            Cap c = limit - flow;
+            for (int v = t; v != s; v = arcs[arcs[prev_arc[v]].rev].to)
+                c = min(c, arcs[prev_arc[v]].cap);
+            Cost path_cost = 0;
+            for (int v = t; v != s; v = arcs[arcs[prev_arc[v]].rev].to) {
+                auto& a = arcs[prev_arc[v]];
+                a.cap -= c;
+                arcs[a.rev].cap += c;
+                path_cost += a.cost;
+            }
+            flow += c;
+            cost += Cost(c) * path_cost;
+        }
+        store();
+        return {flow, cost};
+    }
+
+    // Min-cost maximum flow by cost scaling. Discards any previous flow.
+    pair<Cap, Cost> flow_cost_scaling(int s, int t, Cost alpha = 16) {
+        static_assert(is_integral_v<Cost>, "cost scaling requires integer costs");
+        assert(s != t && alpha >= 2);
+
+        MaxFlow<Cap> mf(n);
+        for (auto& e : edges)
+            mf.add_edge(e.from, e.to, e.cap);
+        Cap total = mf.flow(s, t);
+
+        for (auto& e : edges)
+            e.flow = 0;
+        build();
+
+        Cost eps = 0;
+        for (auto& a : arcs) {
+            a.cost *= Cost(n + 1);
+            eps = max(eps, a.cost);
+        }
+
+        vector<Cap> excess(n, 0);
+        vector<Cost> p(n, 0);
+        excess[s] = total;
+        excess[t] = -total;
+        do {
+            eps = max<Cost>(1, eps / alpha);
+            refine(eps, excess, p);
+        } while (eps > 1);
+
+        store();
+        Cost cost = 0;
+        for (auto& e : edges)
+            cost += Cost(e.flow) * e.cost;
+        return {total, cost};
+    }
+};
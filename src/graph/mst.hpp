@@ -0,0 +1,182 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Minimum spanning forest: Kruskal, Filter-Kruskal and Boruvka.
+ *
+ * Features:
+ * - kruskal_mst: edges ordered by a (parallel) LSD radix sort, then DSU.
+ * - filter_kruskal_mst: quicksort-style partition around a pivot; the heavy
+ *   half is filtered (edges already inside one component are dropped) before
+ *   it is ever sorted. Good when m >> n.
+ * - boruvka_mst: multi-threaded Boruvka rounds on ConcurrentDSU; every
+ *   component picks its lightest outgoing edge with a CAS-min.
+ * - Ties are broken by edge index, i.e. edges are totally ordered by
+ *   (w, index). The spanning forest is then unique, so all three algorithms
+ *   return identical results.
+ *
+ * Time: Kruskal O(m * passes + m a(n)); Filter-Kruskal expected
+ *       O(m + n log n log(m / n)); Boruvka O(m log n / threads)
+ * Space: O(n + m)
+ *
+ * Usage:
+ *  vector<WeightedEdge<long long>> edges = {{0, 1, 5}, {1, 2, 3}, {0, 2, 4}};
+ *  auto f1 = kruskal_mst(3, edges);          // f1.weight == 7, f1.edges == {1, 2}
+ *  auto f2 = filter_kruskal_mst(3, edges);
+ *  auto f3 = boruvka_mst(3, edges, 0);       // 0 = all cores
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "data-structures/disjoint_set.hpp"
+#include "misc/parallel.hpp"
+#include "misc/radix_sort.hpp"
+using namespace std;
+
+template <typename W>
+struct WeightedEdge {
+    int u, v;
+    W w;
+};
+
+template <typename W>
+struct SpanningForest {
+    W weight = 0;
+    vector<int> edges;   // edge indices, ascending
+};
+
+template <typename W>
+bool mst_edge_less(const vector<WeightedEdge<W>>& edges, int a, int b) {
+    if (edges[a].w != edges[b].w)
+        return edges[a].w < edges[b].w;
+    return a < b;
+}
+
+template <typename W>
+SpanningForest<W> make_spanning_forest(const vector<WeightedEdge<W>>& edges, vector<int> ids) {
+    SpanningForest<W> res;
+    sort(ids.begin(), ids.end());
+    for (int id : ids)
+        res.weight += edges[id].w;
+    res.edges = std::move(ids);
+    return res;
+}
+
+template <typename W>
+SpanningForest<W> kruskal_mst(int n, const vector<WeightedEdge<W>>& edges, int threads = 1) {
+    using K = decltype(radix_key(W()));
+    struct Item {
+        K key;
+        int id;
+    };
+    int m = edges.size();
+    vector<Item> order(m);
+    parallel_for(m, threads, [&](long long b, long long e, int) {
+        for (long long i = b; i < e; i++)
+            order[i] = {radix_key(edges[i].w), int(i)};
+    });
+    radix_sort(order, [](const Item& it) { return it.key; }, threads);
+
+    DSU dsu(n);
+    vector<int> taken;
+    for (int i = 0; i < m && int(taken.size()) < n - 1; i++) {
+        auto& e = edges[order[i].id];
+        if (dsu.unite(e.u, e.v))
+            taken.push_back(order[i].id);
+    }
+    return make_spanning_forest(edges, std::move(taken));
+}
+
+template <typename W>
+SpanningForest<W> filter_kruskal_mst(int n, const vector<WeightedEdge<W>>& edges) {
+    static const int BASE = 256;
+    int m = edges.size();
+    vector<int> ids(m);
+    iota(ids.begin(), ids.end(), 0);
+    DSU dsu(n);
+    vector<int> taken;
+    mt19937 gen(20240601);
+    auto less = [&](int a, int b) { return mst_edge_less(edges, a, b); };
+
+    auto rec = [&](auto&& self, int l, int r) -> void {
+        if (l >= r || int(taken.size()) == n - 1)
+            return;
+        if (r - l <= BASE) {
+            sort(ids.begin() + l, ids.begin() + r, less);
+            for (int i = l; i < r && int(taken.size()) < n - 1; i++)
+                if (dsu.unite(edges[ids[i]].u, edges[ids[i]].v))
+                    taken.push_back(ids[i]);
+            return;
+        }
+        int pivot = ids[l + gen() % (r - l)];
+        int mid = partition(ids.begin() + l, ids.begin() + r,
+                            [&](int id) { return !less(pivot, id); }) - ids.begin();
+        self(self, l, mid);
+        int kept = partition(ids.begin() + mid, ids.begin() + r, [&](int id) {
+            return !dsu.sameComponent(edges[id].u, edges[id].v);
+        }) - ids.begin();
+        self(self, mid, kept);
+    };
+    rec(rec, 0, m);
+    return make_spanning_forest(edges, std::move(taken));
+}
+
+template <typename W>
+SpanningForest<W> boruvka_mst(int n, const vector<WeightedEdge<W>>& edges, int threads = 1) {
+    threads = resolve_threads(threads);
+    int m = edges.size();
+    ConcurrentDSU dsu(n);
+    vector<atomic<int>> best(n);
+    for (auto& b : best)
+        b.store(-1, memory_order_relaxed);
+    vector<atomic<bool>> chosen(m);
+
+    auto offer = [&](int c, int id) {
+        int cur = best[c].load(memory_order_relaxed);
+        while ((cur == -1 || mst_edge_less(edges, id, cur)) &&
+               !best[c].compare_exchange_weak(cur, id, memory_order_relaxed)) {}
+    };
+
+    vector<int> alive(m);
+    iota(alive.begin(), alive.end(), 0);
+    vector<int> taken;
+    vector<vector<int>> local(threads);
+    while (!alive.empty()) {
+        // 1) lightest outgoing edge per component; drop internal edges
+        for (auto& l : local)
+            l.clear();
+        parallel_for(alive.size(), threads, [&](long long b, long long e, int t) {
+            for (long long i = b; i < e; i++) {
+                int id = alive[i];
+                int cu = dsu.parent(edges[id].u), cv = dsu.parent(edges[id].v);
+                if (cu == cv)
+                    continue;
+                local[t].push_back(id);
+                offer(cu, id);
+                offer(cv, id);
+            }
+        });
+        alive.clear();
+        for (auto& l : local)
+            alive.insert(alive.end(), l.begin(), l.end());
+        if (alive.empty())
+            break;
+
+        // 2) hook components along their chosen edges
+        for (auto& l : local)
+            l.clear();
+        parallel_for(n, threads, [&](long long b, long long e, int t) {
+            for (long long v = b; v < e; v++) {
+                int id = best[v].load(memory_order_relaxed);
+                if (id == -1)
+                    continue;
+                best[v].store(-1, memory_order_relaxed);
+                if (!chosen[id].exchange(true)) {
+                    local[t].push_back(id);
+                    dsu.unite(edges[id].u, edges[id].v);
+                }
+            }
+        });
+        for (auto& l : local)
+            taken.insert(taken.end(), l.begin(), l.end());
+    }
+    return make_spanning_forest(edges, std::move(taken));
+}
@@ -0,0 +1,189 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Binomial coefficients and friends over a modint type.
+ *
+ * Features:
+ * - Combinatorics<mint>: factorial / inverse factorial / inverse tables shared
+ *   by every caller of the same mint type. They grow geometrically on demand,
+ *   each growth filled in O(new entries) with a single modular inversion.
+ *   C, P, multichoose, catalan, factorial, inverse: O(1) after growth.
+ * - binomials(queries): batch API; grows the tables once, then a tight loop.
+ * - stirling1_row(n) (unsigned, first kind) and stirling2_row(n) (second
+ *   kind): the whole row k = 0..n through convolution (NTT for NTT-friendly
+ *   moduli, three-prime CRT otherwise).
+ * - LucasBinomial(p): C(n, k) mod a small prime p for n, k up to 10^18.
+ *
+ * Requirements:
+ * - Prime modulus; table indices must stay below the modulus.
+ * - Not thread-safe while tables grow: call reserve(n) before sharing.
+ * - dynamic_modint: call reset() after set_mod().
+ *
+ * Time: O(1) per query after O(n) table growth; Stirling rows O(n log^2 n)
+ *       and O(n log n); Lucas O(p) build, O(log_p n) per query
+ * Space: O(max n)
+ *
+ * Usage:
+ *  using comb = Combinatorics<modint998244353>;
+ *  auto c = comb::C(10, 3);                   // 120
+ *  auto s = comb::stirling2_row(5);           // {0, 1, 15, 25, 10, 1}
+ *  auto v = comb::binomials({{5, 2}, {6, 3}});   // {10, 20}
+ *  LucasBinomial lucas(7);
+ *  int r = lucas.C(1000000000000LL, 12345);
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "math/modular.hpp"
+#include "math/ntt.hpp"
+using namespace std;
+
+template <typename mint>
+struct combinatorics_ntt_friendly : false_type {};
+template <uint32_t MOD>
+struct combinatorics_ntt_friendly<static_modint<MOD>>
+    : bool_constant<(MOD % 2 == 1 && MOD > 1 && (MOD - 1) % (1u << 20) == 0)> {};
+
+template <typename mint>
+struct Combinatorics {
+    static inline vector<mint> fact{1}, inv_fact{1}, inv{0};
+
+    static void reset() {
+        fact = {1};
+        inv_fact = {1};
+        inv = {0};
+    }
+
+    // Ensures tables cover [0, n].
+    static void reserve(long long n) {
+        int old = fact.size();
+        if (n < old)
+            return;
+        assert(uint64_t(n) < uint64_t(mint::mod()));
+        int sz = int(min<long long>(max<long long>(n + 1, 2LL * old), (long long)mint::mod()));
+        fact.resize(sz);
+        inv_fact.resize(sz);
+        inv.resize(sz);
+        for (int i = old; i < sz; i++)
+            fact[i] = fact[i - 1] * mint(i);
+        inv_fact[sz - 1] = fact[sz - 1].inv();
+        for (int i = sz - 1; i > old; i--)
+            inv_fact[i - 1] = inv_fact[i] * mint(i);
+        for (int i = max(old, 1); i < sz; i++)
+            inv[i] = inv_fact[i] * fact[i - 1];
+    }
+
+    static mint factorial(int n) {
+        reserve(n);
+        return fact[n];
+    }
+    static mint inv_factorial(int n) {
+        reserve(n);
+        return inv_fact[n];
+    }
+    static mint inverse(int n) {
+        assert(n >= 1);
+        reserve(n);
+        return inv[n];
+    }
+
+    static mint C(long long n, long long k) {
+        if (k < 0 || k > n || n < 0)
+            return 0;
+        reserve(n);
+        return fact[n] * inv_fact[k] * inv_fact[n - k];
+    }
+    static mint P(long long n, long long k) {
+        if (k < 0 || k > n || n < 0)
+            return 0;
+        reserve(n);
+        return fact[n] * inv_fact[n - k];
+    }
+    // Multisets of size k from n kinds.
+    static mint multichoose(long long n, long long k) {
+        if (n == 0)
+            return mint(k == 0 ? 1 : 0);
+        return C(n + k - 1, k);
+    }
+    static mint catalan(long long n) {
+        if (n < 0)
+            return 0;
+        reserve(2 * n + 1);
+        return fact[2 * n] * inv_fact[n] * inv_fact[n + 1];
+    }
+
+    static vector<mint> binomials(const vector<pair<long long, long long>>& queries) {
+        long long mx = 0;
+        for (auto [n, k] : queries)
+            mx = max(mx, n);
+        reserve(mx);
+        vector<mint> res(queries.size());
+        const mint* f = fact.data();
+        const mint* fi = inv_fact.data();
+        for (size_t i = 0; i < queries.size(); i++) {
+            auto [n, k] = queries[i];
+            res[i] = k < 0 || k > n || n < 0 ? mint(0) : f[n] * fi[k] * fi[n - k];
+        }
+        return res;
+    }
+
+    static vector<mint> multiply(const vector<mint>& a, const vector<mint>& b) {
+        if constexpr (combinatorics_ntt_friendly<mint>::value)
+            return convolution(a, b);
+        else
+            return convolution_arbitrary(a, b);
+    }
+
+    // c(n, k) for k = 0..n: coefficients of x (x + 1) ... (x + n - 1).
+    static vector<mint> stirling1_row(int n) {
+        auto rec = [&](auto&& self, int l, int r) -> vector<mint> {
+            if (r - l == 1)
+                return {mint(l), mint(1)};
+            int mid = (l + r) / 2;
+            return multiply(self(self, l, mid), self(self, mid, r));
+        };
+        if (n == 0)
+            return {1};
+        return rec(rec, 0, n);
+    }
+
+    // S(n, k) for k = 0..n: S(n, k) = sum_i (-1)^(k-i) i^n / (i! (k-i)!).
+    static vector<mint> stirling2_row(int n) {
+        reserve(n);
+        vector<mint> a(n + 1), b(n + 1);
+        for (int i = 0; i <= n; i++) {
+            a[i] = mint(i).pow(n) * inv_fact[i];
+            b[i] = i & 1 ? -inv_fact[i] : inv_fact[i];
+        }
+        auto c = multiply(a, b);
+        c.resize(n + 1);
+        return c;
+    }
+};
+
+// C(n, k) mod a small prime p via Lucas' theorem.
+struct LucasBinomial {
+    int p;
+    vector<int> fact, inv_fact;
+
+    LucasBinomial(int p) : p(p), fact(p), inv_fact(p) {
+        fact[0] = 1;
+        for (int i = 1; i < p; i++)
+            fact[i] = 1LL * fact[i - 1] * i % p;
+        inv_fact[p - 1] = mod_inverse(fact[p - 1], p);
+        for (int i = p - 1; i > 0; i--)
+            inv_fact[i - 1] = 1LL * inv_fact[i] * i % p;
+    }
+
+    int C(long long n, long long k) const {
+        if (k < 0 || k > n)
+            return 0;
+        long long res = 1;
+        for (; k > 0 && res; n /= p, k /= p) {
+            int ni = n % p, ki = k % p;
+            if (ki > ni)
+                return 0;
+            res = res * fact[ni] % p * inv_fact[ki] % p * inv_fact[ni - ki] % p;
+        }
+        return res;
+    }
+};
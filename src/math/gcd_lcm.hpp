@@ -0,0 +1,256 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Binary GCD, extended GCD, safe LCM and 64-bit factorization.
+ *
+ * Features:
+ * - binary_gcd(a, b): Stein's algorithm on countr_zero, no divisions. Signed
+ *   inputs use their absolute values. BinaryGcd is the same as a functor, e.g.
+ *   the combine function of RMQ / LazySegmentTreeRangeMax for range gcd.
+ * - gcd_all(v) stops early once the gcd reaches 1; lcm_all(v, cap) saturates.
+ * - ext_gcd(a, b) -> {g, x, y} with a x + b y = g.
+ * - checked_lcm(a, b): nullopt on overflow; capped_lcm(a, b, cap) = min(lcm, cap).
+ * - miller_rabin(n): deterministic for all n < 2^64 (7 bases), Montgomery64
+ *   arithmetic (plain __int128 % for n >= 2^63).
+ * - pollard_rho(n) (Brent's cycle detection, gcds batched over 128 steps),
+ *   prime_factors(n) (sorted, with multiplicity) and prime_factorize(n)
+ *   ({prime, exponent} pairs), for n >= 1; both are empty for 0 and 1.
+ *
+ * Time: binary_gcd O(log max), miller_rabin O(7 log n), factorization
+ *       expected O(n^(1/4)) multiplications
+ * Space: O(1) (O(log n) for the factor lists)
+ *
+ * Usage:
+ *  binary_gcd(12, 18);                          // 6
+ *  auto [g, x, y] = ext_gcd(240LL, 46LL);       // 240 x + 46 y = 2
+ *  RMQ<int, BinaryGcd> st(a, BinaryGcd());      // range gcd
+ *  miller_rabin(1000000007);                    // true
+ *  prime_factorize(600851475143ULL);            // {{71, 1}, {839, 1}, {1471, 1}, {6857, 1}}
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "math/modular.hpp"
+using namespace std;
+
+template <typename T>
+T binary_gcd(T a, T b) {
+    using U = make_unsigned_t<T>;
+    U x = a < 0 ? U(0) - U(a) : U(a), y = b < 0 ? U(0) - U(b) : U(b);
+    if (x == 0)
+        return T(y);
+    if (y == 0)
+        return T(x);
+    int xz = countr_zero(x), yz = countr_zero(y);
+    int shift = min(xz, yz);
+    y >>= yz;
+    // Branch-free step: the shift for the next round comes from the wrapped
+    // difference, so ctz runs in parallel with min / abs. countr_zero is
+    // defined for d == 0, where x becomes 0 and the loop ends.
+    while (x != 0) {
+        x >>= xz;
+        U d = y - x;
+        xz = countr_zero(d);
+        U neg = U(0) - U(x > y);   // all ones when d wrapped
+        y = x + (d & neg);         // min(x, y)
+        x = (d ^ neg) - neg;       // |x - y|
+    }
+    return T(y << shift);
+}
+
+struct BinaryGcd {
+    template <typename T>
+    T operator()(T a, T b) const {
+        return binary_gcd(a, b);
+    }
+};
+
+template <typename T>
+T gcd_all(const vector<T>& v) {
+    T g = 0;
+    for (const T& x : v) {
+        g = binary_gcd(g, x);
+        if (g == 1)
+            break;
+    }
+    return g;
+}
+
+// a x + b y = g = gcd(a, b), |x| <= |b|, |y| <= |a|.
+template <typename T>
+tuple<T, T, T> ext_gcd(T a, T b) {
+    T x0 = 1, y0 = 0, x1 = 0, y1 = 1;
+    while (b != 0) {
+        T q = a / b;
+        tie(a, b) = make_pair(b, a - q * b);
+        tie(x0, x1) = make_pair(x1, x0 - q * x1);
+        tie(y0, y1) = make_pair(y1, y0 - q * y1);
+    }
+    if (a < 0)
+        a = -a, x0 = -x0, y0 = -y0;
+    return {a, x0, y0};
+}
+
+// lcm of non-negative a, b, or nullopt if it does not fit in T.
+template <typename T>
+optional<T> checked_lcm(T a, T b) {
+    if (a == 0 || b == 0)
+        return T(0);
+    T r;
+    if (__builtin_mul_overflow(a / binary_gcd(a, b), b, &r))
+        return nullopt;
+    return r;
+}
+
+template <typename T>
+T capped_lcm(T a, T b, T cap) {
+    auto r = checked_lcm(a, b);
+    return r && *r < cap ? *r : cap;
+}
+
+template <typename T>
+T lcm_all(const vector<T>& v, T cap = numeric_limits<T>::max()) {
+    T l = 1;
+    for (const T& x : v) {
+        l = capped_lcm(l, x, cap);
+        if (l == cap)
+            break;
+    }
+    return l;
+}
+
+namespace gcd_lcm_detail {
+
+// Same interface as Montgomery64 for moduli >= 2^63.
+struct PlainMod64 {
+    uint64_t mod;
+    uint64_t reduce(unsigned __int128 t) const { return uint64_t(t % mod); }
+    uint64_t mul(uint64_t a, uint64_t b) const { return reduce((unsigned __int128)a * b); }
+    uint64_t to(uint64_t x) const { return x % mod; }
+    uint64_t from(uint64_t x) const { return x; }
+    uint64_t one() const { return 1 % mod; }
+};
+
+template <typename R>
+bool miller_rabin_impl(uint64_t n) {
+    const R mg{n};
+    uint64_t d = n - 1;
+    int s = countr_zero(d);
+    d >>= s;
+    const uint64_t one = mg.one(), minus_one = mg.to(n - 1);
+    for (uint64_t a : {2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL}) {
+        a %= n;
+        if (a == 0)
+            continue;
+        uint64_t x = one, base = mg.to(a);
+        for (uint64_t e = d; e; e >>= 1, base = mg.mul(base, base))
+            if (e & 1)
+                x = mg.mul(x, base);
+        if (x == one || x == minus_one)
+            continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; r++) {
+            x = mg.mul(x, x);
+            composite = x != minus_one;
+        }
+        if (composite)
+            return false;
+    }
+    return true;
+}
+
+template <typename R>
+uint64_t pollard_brent(uint64_t n) {
+    const R mg{n};
+    static const int BATCH = 128;
+    for (uint64_t c0 = 1;; c0++) {
+        const uint64_t c = mg.to(c0);
+        auto f = [&](uint64_t x) {
+            x = mg.mul(x, x);
+            return x >= n - c ? x - (n - c) : x + c;   // no overflow for n >= 2^63
+        };
+        uint64_t y = mg.to(2), x = y, ys = y, q = mg.one(), g = 1;
+        for (uint64_t r = 1; g == 1; r <<= 1) {
+            x = y;
+            for (uint64_t i = 0; i < r; i++)
+                y = f(y);
+            for (uint64_t k = 0; k < r && g == 1; k += BATCH) {
+                ys = y;
+                for (uint64_t i = 0; i < min<uint64_t>(BATCH, r - k); i++) {
+                    y = f(y);
+                    q = mg.mul(q, x > y ? x - y : y - x);
+                }
+                g = binary_gcd(q, n);
+            }
+        }
+        if (g == n) {   // the batch overshot: replay it one step at a time
+            do {
+                ys = f(ys);
+                g = binary_gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+        if (g != n)
+            return g;
+    }
+}
+
+}  // namespace gcd_lcm_detail
+
+inline bool miller_rabin(uint64_t n) {
+    if (n < 2)
+        return false;
+    for (uint64_t p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+        if (n % p == 0)
+            return n == p;
+    if (n < 41 * 41)
+        return true;
+    if (n < (1ULL << 63))
+        return gcd_lcm_detail::miller_rabin_impl<Montgomery64>(n);
+    return gcd_lcm_detail::miller_rabin_impl<gcd_lcm_detail::PlainMod64>(n);
+}
+
+// A nontrivial factor of a composite n.
+inline uint64_t pollard_rho(uint64_t n) {
+    if (n % 2 == 0)
+        return 2;
+    if (n < (1ULL << 63))
+        return gcd_lcm_detail::pollard_brent<Montgomery64>(n);
+    return gcd_lcm_detail::pollard_brent<gcd_lcm_detail::PlainMod64>(n);
+}
+
+// Prime factors of n in increasing order, with multiplicity. n >= 1; 0 has
+// no factorization and gives an empty list.
+inline vector<uint64_t> prime_factors(uint64_t n) {
+    if (n <= 1)
+        return {};
+    vector<uint64_t> res;
+    for (uint64_t p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+        while (n % p == 0)
+            res.push_back(p), n /= p;
+    vector<uint64_t> st;
+    if (n > 1)
+        st.push_back(n);
+    while (!st.empty()) {
+        uint64_t x = st.back();
+        st.pop_back();
+        if (miller_rabin(x)) {
+            res.push_back(x);
+            continue;
+        }
+        uint64_t d = pollard_rho(x);
+        st.push_back(d);
+        st.push_back(x / d);
+    }
+    sort(res.begin(), res.end());
+    return res;
+}
+
+inline vector<pair<uint64_t, int>> prime_factorize(uint64_t n) {
+    vector<pair<uint64_t, int>> res;
+    for (uint64_t p : prime_factors(n)) {
+        if (!res.empty() && res.back().first == p)
+            res.back().second++;
+        else
+            res.push_back({p, 1});
+    }
+    return res;
+}
@@ -0,0 +1,113 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Berlekamp-Massey and Kitamasa for linear recurrences over a field.
+ *
+ * Features:
+ * - berlekamp_massey(s): shortest c with s[i] = sum_j c[j] * s[i - 1 - j]
+ *   for every i >= c.size(). Needs 2d terms to recover an order-d recurrence.
+ * - kitamasa(c, init, k): k-th term (0-indexed) of the recurrence c with
+ *   initial terms init[0..d), by computing x^k mod the characteristic
+ *   polynomial. O(d^2 log k), against O(d^3 log k) for the companion matrix.
+ * - linear_recurrence_nth(s, k): both combined: guess from a prefix, jump to k.
+ *
+ * Requirements:
+ * - mint is a prime-modulus modint (division by nonzero elements).
+ *
+ * Time: berlekamp_massey O(n^2), kitamasa O(d^2 log k)
+ * Space: O(n)
+ *
+ * Usage:
+ *  using mint = modint998244353;
+ *  vector<mint> fib = {0, 1, 1, 2, 3, 5, 8, 13};
+ *  auto c = berlekamp_massey(fib);                     // {1, 1}
+ *  mint f = kitamasa(c, {0, 1}, 1000000000000000000LL);
+ *  mint g = linear_recurrence_nth(fib, 100);           // F_100
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "math/modular.hpp"
+using namespace std;
+
+template <typename mint>
+vector<mint> berlekamp_massey(const vector<mint>& s) {
+    vector<mint> c, prev;   // current and last-failing connection polynomials (without the leading 1)
+    mint prev_d = 1;
+    int shift = 0;
+    for (int i = 0; i < int(s.size()); i++) {
+        shift++;
+        mint d = s[i];
+        for (int j = 0; j < int(c.size()); j++)
+            d -= c[j] * s[i - 1 - j];
+        if (d == mint(0))
+            continue;
+        mint coef = d / prev_d;
+        vector<mint> next = c;
+        if (next.size() < prev.size() + shift)
+            next.resize(prev.size() + shift);
+        next[shift - 1] += coef;
+        for (int j = 0; j < int(prev.size()); j++)
+            next[j + shift] -= coef * prev[j];
+        if (2 * int(c.size()) <= i) {
+            prev = c;
+            prev_d = d;
+            shift = 0;
+        }
+        c = std::move(next);
+    }
+    return c;
+}
+
+template <typename mint>
+mint kitamasa(const vector<mint>& c, const vector<mint>& init, unsigned long long k) {
+    int d = c.size();
+    assert(int(init.size()) >= d);
+    if (k < init.size())
+        return init[k];
+    if (d == 0)
+        return mint(0);
+
+    // polynomials mod x^d - sum c[j] x^(d-1-j), as coefficient vectors of length d
+    auto mul = [&](const vector<mint>& p, const vector<mint>& q) {
+        vector<mint> r(2 * d - 1);
+        for (int i = 0; i < d; i++) {
+            if (p[i] == mint(0))
+                continue;
+            for (int j = 0; j < d; j++)
+                r[i + j] += p[i] * q[j];
+        }
+        for (int i = 2 * d - 2; i >= d; i--) {
+            if (r[i] == mint(0))
+                continue;
+            for (int j = 0; j < d; j++)
+                r[i - 1 - j] += r[i] * c[j];
+        }
+        r.resize(d);
+        return r;
+    };
+
+    vector<mint> res(d), base(d);
+    res[0] = 1;
+    if (d == 1)
+        base[0] = c[0];
+    else
+        base[1] = 1;
+    for (; k; k >>= 1) {
+        if (k & 1)
+            res = mul(res, base);
+        if (k > 1)
+            base = mul(base, base);
+    }
+    mint ans = 0;
+    for (int i = 0; i < d; i++)
+        ans += res[i] * init[i];
+    return ans;
+}
+
+template <typename mint>
+mint linear_recurrence_nth(const vector<mint>& s, unsigned long long k) {
+    if (k < s.size())
+        return s[k];
+    auto c = berlekamp_massey(s);
+    return kitamasa(c, s, k);
+}
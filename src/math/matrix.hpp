@@ -0,0 +1,273 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Dense matrices over modints (or any ring type) with fast power.
+ *
+ * Features:
+ * - Matrix<T>: runtime-sized, row-major. Products multiply A by the transpose
+ *   of B in 16 x 16 tiles, so both operands are read along contiguous rows.
+ * - Delayed reduction for static_modint / dynamic_modint: raw 32-bit products
+ *   are summed in uint64 for as many terms as cannot overflow, folded into
+ *   32-bit halves, and reduced once per entry (one `%`, one Montgomery step).
+ *   On AVX2 machines (checked at runtime) 8 products are formed per step.
+ * - Matrix<T, N>: compile-time N x N (std::array storage, fully unrollable).
+ * - pow(e): binary exponentiation reusing three buffers (no allocation per
+ *   step). multiply_into(a, b, c) exposes the allocation-free product.
+ * - For pure linear recurrences see math/linear_recurrence.hpp, which is
+ *   O(d^2 log k) instead of O(d^3 log k).
+ *
+ * Time: product O(n m k), pow O(n^3 log e)
+ * Space: O(n m)
+ *
+ * Usage:
+ *  using mint = modint1000000007;
+ *  Matrix<mint> f(2, 2);
+ *  f[0][0] = f[0][1] = f[1][0] = 1;
+ *  mint fib = f.pow(1000000000000000000LL)[0][1];
+ *  Matrix<mint, 2> g = {{1, 1, 1, 0}};      // fixed size, row-major init
+ *  auto h = g.pow(10);                       // h[0][1] == 55
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CP_MATRIX_X86 1
+#endif
+#include "math/modular.hpp"
+using namespace std;
+
+namespace matrix_detail {
+
+// Longest run of products (each < mod^2) that fits in a uint64.
+constexpr int delayed_chunk(uint64_t mod) {
+    if (mod <= 1)
+        return 1 << 30;
+    uint64_t sq = (mod - 1) * (mod - 1);
+    return int(min<uint64_t>(~0ULL / sq, 1 << 30));
+}
+
+template <typename T>
+struct Dot {
+    static T run(const T* x, const T* y, int k) {
+        T s = T();
+        for (int t = 0; t < k; t++)
+            s += x[t] * y[t];
+        return s;
+    }
+};
+
+// Sum of x[t] * y[t] mod `mod` (mod < 2^31). Chunks of at most `chunk` products are
+// summed in a uint64 and folded into 32-bit halves, so there is a single `%` per call.
+inline uint64_t delayed_sum_scalar(const uint32_t* x, const uint32_t* y, int k, uint32_t mod, int chunk) {
+    uint64_t hi = 0, lo = 0;
+    for (int t0 = 0; t0 < k; t0 += chunk) {
+        int t1 = min(k, t0 + chunk);
+        uint64_t s = 0;
+        for (int t = t0; t < t1; t++)
+            s += uint64_t(x[t]) * y[t];
+        hi += s >> 32;
+        lo += uint32_t(s);
+    }
+    return ((hi % mod) * ((1ULL << 32) % mod) + lo % mod) % mod;
+}
+
+#ifdef CP_MATRIX_X86
+// 8 lanes per step: even and odd 32-bit lanes multiplied into 64-bit products
+// (two per lane, < 2^63), folded into 32-bit halves right away.
+__attribute__((target("avx2"))) inline uint64_t delayed_sum_avx2(const uint32_t* x, const uint32_t* y, int k,
+                                                                 uint32_t mod) {
+    const __m256i mask = _mm256_set1_epi64x(0xffffffffLL);
+    __m256i hi = _mm256_setzero_si256(), lo = _mm256_setzero_si256();
+    int t = 0;
+    for (; t + 8 <= k; t += 8) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + t));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + t));
+        __m256i s = _mm256_add_epi64(_mm256_mul_epu32(a, b),
+                                     _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)));
+        hi = _mm256_add_epi64(hi, _mm256_srli_epi64(s, 32));
+        lo = _mm256_add_epi64(lo, _mm256_and_si256(s, mask));
+    }
+    alignas(32) uint64_t h[4], l[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(h), hi);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(l), lo);
+    uint64_t hs = h[0] + h[1] + h[2] + h[3], ls = l[0] + l[1] + l[2] + l[3];
+    for (; t < k; t++) {
+        uint64_t s = uint64_t(x[t]) * y[t];
+        hs += s >> 32;
+        ls += uint32_t(s);
+    }
+    return ((hs % mod) * ((1ULL << 32) % mod) + ls % mod) % mod;
+}
+
+inline const bool matrix_use_avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+inline uint64_t delayed_sum(const uint32_t* x, const uint32_t* y, int k, uint32_t mod, int chunk) {
+#ifdef CP_MATRIX_X86
+    if (matrix_use_avx2 && k >= 16)
+        return delayed_sum_avx2(x, y, k, mod);
+#endif
+    return delayed_sum_scalar(x, y, k, mod, chunk);
+}
+
+template <uint32_t MOD>
+struct Dot<static_modint<MOD>> {
+    using mint = static_modint<MOD>;
+    static mint run(const mint* x, const mint* y, int k) {
+        static_assert(sizeof(mint) == sizeof(uint32_t));
+        uint64_t acc = delayed_sum(reinterpret_cast<const uint32_t*>(x), reinterpret_cast<const uint32_t*>(y), k,
+                                   MOD, delayed_chunk(MOD));
+        mint r;
+        // Montgomery: sum (xR)(yR) = xyR^2, one reduction gives xyR
+        r.v = mint::montgomery ? mint::mg.reduce(acc) : uint32_t(acc);
+        return r;
+    }
+};
+
+template <int Id>
+struct Dot<dynamic_modint<Id>> {
+    using mint = dynamic_modint<Id>;
+    static mint run(const mint* x, const mint* y, int k) {
+        static_assert(sizeof(mint) == sizeof(uint32_t));
+        const uint32_t mod = mint::mod();
+        mint r;
+        r.v = uint32_t(delayed_sum(reinterpret_cast<const uint32_t*>(x), reinterpret_cast<const uint32_t*>(y), k,
+                                   mod, delayed_chunk(mod)));
+        return r;
+    }
+};
+
+// C (n x m) = A (n x k) * B, given Bt = B^T (m x k). C must not alias A or Bt.
+template <typename T>
+void multiply_transposed(const T* A, const T* Bt, T* C, int n, int k, int m) {
+    static const int TILE = 16;
+    for (int i0 = 0; i0 < n; i0 += TILE)
+        for (int j0 = 0; j0 < m; j0 += TILE) {
+            int i1 = min(n, i0 + TILE), j1 = min(m, j0 + TILE);
+            for (int i = i0; i < i1; i++)
+                for (int j = j0; j < j1; j++)
+                    C[i * m + j] = Dot<T>::run(A + i * k, Bt + j * k, k);
+        }
+}
+
+}  // namespace matrix_detail
+
+// N > 0: compile-time N x N matrix; Matrix<T> (N == 0) is the runtime-sized one below.
+template <typename T, int N = 0>
+struct Matrix {
+    array<T, N * N> a{};
+
+    static Matrix identity() {
+        Matrix r;
+        for (int i = 0; i < N; i++)
+            r.a[i * N + i] = T(1);
+        return r;
+    }
+    T* operator[](int i) { return a.data() + i * N; }
+    const T* operator[](int i) const { return a.data() + i * N; }
+
+    friend Matrix operator*(const Matrix& x, const Matrix& y) {
+        Matrix yt, r;
+        for (int i = 0; i < N; i++)
+            for (int j = 0; j < N; j++)
+                yt.a[j * N + i] = y.a[i * N + j];
+        for (int i = 0; i < N; i++)
+            for (int j = 0; j < N; j++)
+                r.a[i * N + j] = matrix_detail::Dot<T>::run(&x.a[i * N], &yt.a[j * N], N);
+        return r;
+    }
+    friend Matrix operator+(Matrix x, const Matrix& y) {
+        for (int i = 0; i < N * N; i++)
+            x.a[i] += y.a[i];
+        return x;
+    }
+    friend bool operator==(const Matrix& x, const Matrix& y) { return x.a == y.a; }
+
+    Matrix pow(unsigned long long e) const {
+        Matrix r = identity(), b = *this;
+        for (; e; e >>= 1) {
+            if (e & 1)
+                r = r * b;
+            b = b * b;
+        }
+        return r;
+    }
+};
+
+template <typename T>
+struct Matrix<T, 0> {
+    int n = 0, m = 0;
+    vector<T> a;
+
+    Matrix() {}
+    Matrix(int n, int m, T fill = T()) : n(n), m(m), a(size_t(n) * m, fill) {}
+
+    static Matrix identity(int n) {
+        Matrix r(n, n);
+        for (int i = 0; i < n; i++)
+            r.a[size_t(i) * n + i] = T(1);
+        return r;
+    }
+
+    T* operator[](int i) { return a.data() + size_t(i) * m; }
+    const T* operator[](int i) const { return a.data() + size_t(i) * m; }
+
+    Matrix transpose() const {
+        Matrix t(m, n);
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j < m; j++)
+                t.a[size_t(j) * n + i] = a[size_t(i) * m + j];
+        return t;
+    }
+
+    // c = x * y without allocating once c and scratch have the right sizes.
+    // c must be a different object from x and y.
+    static void multiply_into(const Matrix& x, const Matrix& y, Matrix& c, vector<T>& scratch) {
+        assert(x.m == y.n && &c != &x && &c != &y);
+        scratch.resize(size_t(y.n) * y.m);
+        for (int i = 0; i < y.n; i++)
+            for (int j = 0; j < y.m; j++)
+                scratch[size_t(j) * y.n + i] = y.a[size_t(i) * y.m + j];
+        c.n = x.n, c.m = y.m;
+        c.a.resize(size_t(c.n) * c.m);
+        matrix_detail::multiply_transposed(x.a.data(), scratch.data(), c.a.data(), x.n, x.m, y.m);
+    }
+
+    friend Matrix operator*(const Matrix& x, const Matrix& y) {
+        Matrix c;
+        vector<T> scratch;
+        multiply_into(x, y, c, scratch);
+        return c;
+    }
+    vector<T> operator*(const vector<T>& v) const {
+        assert(int(v.size()) == m);
+        vector<T> r(n);
+        for (int i = 0; i < n; i++)
+            r[i] = matrix_detail::Dot<T>::run(a.data() + size_t(i) * m, v.data(), m);
+        return r;
+    }
+    friend Matrix operator+(Matrix x, const Matrix& y) {
+        assert(x.n == y.n && x.m == y.m);
+        for (size_t i = 0; i < x.a.size(); i++)
+            x.a[i] += y.a[i];
+        return x;
+    }
+    friend bool operator==(const Matrix& x, const Matrix& y) { return x.n == y.n && x.m == y.m && x.a == y.a; }
+
+    Matrix pow(unsigned long long e) const {
+        assert(n == m);
+        Matrix r = identity(n), b = *this, tmp(n, n);
+        vector<T> scratch;
+        for (; e; e >>= 1) {
+            if (e & 1) {
+                multiply_into(r, b, tmp, scratch);
+                swap(r, tmp);
+            }
+            if (e > 1) {
+                multiply_into(b, b, tmp, scratch);
+                swap(b, tmp);
+            }
+        }
+        return r;
+    }
+};
@@ -0,0 +1,359 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Modular integer types with Montgomery and Barrett reduction.
+ *
+ * Features:
+ * - static_modint<MOD>: compile-time modulus. Odd moduli are kept in
+ *   Montgomery form (one 32x32->64 multiply plus one reduction, no division);
+ *   even moduli fall back to plain `%`. Fully constexpr.
+ * - dynamic_modint<Id>: runtime modulus (< 2^31) with Barrett reduction.
+ *   Different Ids keep independent moduli.
+ * - dynamic_modint64<Id>: runtime odd 64-bit modulus (< 2^63) with Montgomery
+ *   reduction over unsigned __int128.
+ * - Montgomery32 / Montgomery64 / Barrett: the raw reducers, usable on their
+ *   own (e.g. Miller-Rabin in gcd_lcm.hpp).
+ * - pow, inv (extended Euclid, works for any invertible value), batch_inverse
+ *   (n inverses with a single modular inversion).
+ *
+ * Requirements:
+ * - static_modint: 1 <= MOD < 2^31. dynamic_modint: 1 <= mod < 2^31.
+ * - dynamic_modint64: odd mod < 2^63.
+ *
+ * Time: O(1) per +, -, *; O(log MOD) per inv/pow; batch_inverse O(n + log MOD)
+ * Space: O(1)
+ *
+ * Usage:
+ *  using mint = modint998244353;
+ *  constexpr mint a = mint(3).pow(100);      // compile time
+ *  mint b = a * 5 - 1, c = b / 7;
+ *  cout << c << "\n";                        // prints c.val()
+ *
+ *  dynamic_modint<0>::set_mod(1000003);
+ *  dynamic_modint<0> d = 12345;
+ *
+ *  vector<mint> xs = {1, 2, 3};
+ *  batch_inverse(xs);                        // xs = {1, 1/2, 1/3}
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Montgomery reduction for odd moduli below 2^31, R = 2^32.
+struct Montgomery32 {
+    uint32_t mod, r, n2;   // r = -mod^-1 mod 2^32, n2 = 2^64 mod mod
+
+    constexpr Montgomery32(uint32_t m = 1) : mod(m), r(0), n2(0) {
+        uint32_t x = m;
+        for (int i = 0; i < 4; i++)
+            x *= 2 - m * x;
+        r = -x;
+        n2 = uint32_t(-uint64_t(m) % m);
+    }
+
+    // t < mod * 2^32  ->  t * 2^-32 mod mod
+    constexpr uint32_t reduce(uint64_t t) const {
+        uint32_t q = uint32_t(t) * r;
+        uint32_t res = (t + uint64_t(q) * mod) >> 32;
+        return res >= mod ? res - mod : res;
+    }
+    constexpr uint32_t mul(uint32_t a, uint32_t b) const { return reduce(uint64_t(a) * b); }
+    constexpr uint32_t to(uint32_t x) const { return mul(x % mod, n2); }
+    constexpr uint32_t from(uint32_t x) const { return reduce(x); }
+};
+
+// Montgomery reduction for odd moduli below 2^63, R = 2^64.
+struct Montgomery64 {
+    using u128 = unsigned __int128;
+    uint64_t mod, r, n2;
+
+    constexpr Montgomery64(uint64_t m = 1) : mod(m), r(0), n2(0) {
+        uint64_t x = m;
+        for (int i = 0; i < 5; i++)
+            x *= 2 - m * x;
+        r = -x;
+        n2 = uint64_t(-u128(m) % m);
+    }
+
+    constexpr uint64_t reduce(u128 t) const {
+        uint64_t q = uint64_t(t) * r;
+        uint64_t res = (t + u128(q) * mod) >> 64;
+        return res >= mod ? res - mod : res;
+    }
+    constexpr uint64_t mul(uint64_t a, uint64_t b) const { return reduce(u128(a) * b); }
+    constexpr uint64_t to(uint64_t x) const { return mul(x % mod, n2); }
+    constexpr uint64_t from(uint64_t x) const { return reduce(x); }
+    constexpr uint64_t one() const { return to(1); }
+};
+
+// Barrett reduction for moduli below 2^31.
+struct Barrett {
+    uint32_t mod;
+    uint64_t im;   // ceil(2^64 / mod)
+
+    constexpr Barrett(uint32_t m = 1) : mod(m), im(~0ULL / m + 1) {}
+
+    constexpr uint32_t reduce(uint64_t z) const {
+        uint64_t x = uint64_t((unsigned __int128)z * im >> 64);
+        uint64_t y = x * mod;
+        return uint32_t(z - y + (z < y ? mod : 0));
+    }
+    constexpr uint32_t mul(uint32_t a, uint32_t b) const { return reduce(uint64_t(a) * b); }
+};
+
+// x^-1 mod m by extended Euclid; requires gcd(x, m) == 1.
+constexpr long long mod_inverse(long long x, long long m) {
+    long long a = x % m, b = m, u = 1, v = 0;
+    if (a < 0)
+        a += m;
+    while (b) {
+        long long t = a / b;
+        a -= t * b, swap(a, b);
+        u -= t * v, swap(u, v);
+    }
+    assert(a == 1 && "value is not invertible");
+    return u < 0 ? u + m : u;
+}
+
+template <uint32_t MOD>
+struct static_modint {
+    static_assert(1 <= MOD && MOD < (1u << 31));
+    static constexpr bool montgomery = MOD % 2 == 1 && MOD > 1;
+    static constexpr Montgomery32 mg{montgomery ? MOD : 1};
+
+    uint32_t v;   // Montgomery form when `montgomery`
+
+    constexpr static_modint() : v(0) {}
+    template <typename T, enable_if_t<is_integral_v<T>, int> = 0>
+    constexpr static_modint(T x) : v(0) {
+        long long y;
+        if constexpr (is_signed_v<T>)
+            y = (long long)(x % (long long)MOD), y += y < 0 ? MOD : 0;
+        else
+            y = (long long)(x % MOD);
+        v = montgomery ? mg.to(uint32_t(y)) : uint32_t(y);
+    }
+
+    static constexpr uint32_t mod() { return MOD; }
+    constexpr uint32_t val() const { return montgomery ? mg.from(v) : v; }
+
+    constexpr static_modint& operator+=(const static_modint& o) {
+        v += o.v;
+        if (v >= MOD)
+            v -= MOD;
+        return *this;
+    }
+    constexpr static_modint& operator-=(const static_modint& o) {
+        v += MOD - o.v;
+        if (v >= MOD)
+            v -= MOD;
+        return *this;
+    }
+    constexpr static_modint& operator*=(const static_modint& o) {
+        if constexpr (montgomery)
+            v = mg.mul(v, o.v);
+        else
+            v = uint32_t(uint64_t(v) * o.v % MOD);
+        return *this;
+    }
+    constexpr static_modint& operator/=(const static_modint& o) { return *this *= o.inv(); }
+
+    constexpr static_modint operator-() const { return static_modint() - *this; }
+    friend constexpr static_modint operator+(static_modint a, const static_modint& b) { return a += b; }
+    friend constexpr static_modint operator-(static_modint a, const static_modint& b) { return a -= b; }
+    friend constexpr static_modint operator*(static_modint a, const static_modint& b) { return a *= b; }
+    friend constexpr static_modint operator/(static_modint a, const static_modint& b) { return a /= b; }
+    friend constexpr bool operator==(const static_modint& a, const static_modint& b) { return a.v == b.v; }
+    friend constexpr bool operator!=(const static_modint& a, const static_modint& b) { return a.v != b.v; }
+
+    constexpr static_modint pow(unsigned long long e) const {
+        static_modint base = *this, res = 1;
+        for (; e; e >>= 1, base *= base)
+            if (e & 1)
+                res *= base;
+        return res;
+    }
+    constexpr static_modint inv() const { return static_modint(mod_inverse(val(), MOD)); }
+
+    friend ostream& operator<<(ostream& os, const static_modint& x) { return os << x.val(); }
+    friend istream& operator>>(istream& is, static_modint& x) {
+        long long y;
+        is >> y;
+        x = static_modint(y);
+        return is;
+    }
+};
+
+template <int Id = -1>
+struct dynamic_modint {
+    uint32_t v;
+
+    static Barrett& bt() {
+        static Barrett b(998244353);
+        return b;
+    }
+    static void set_mod(uint32_t m) {
+        assert(1 <= m && m < (1u << 31));
+        bt() = Barrett(m);
+    }
+    static uint32_t mod() { return bt().mod; }
+
+    dynamic_modint() : v(0) {}
+    template <typename T, enable_if_t<is_integral_v<T>, int> = 0>
+    dynamic_modint(T x) {
+        long long y;
+        if constexpr (is_signed_v<T>)
+            y = (long long)(x % (long long)mod()), y += y < 0 ? mod() : 0;
+        else
+            y = (long long)(x % mod());
+        v = uint32_t(y);
+    }
+
+    uint32_t val() const { return v; }
+
+    dynamic_modint& operator+=(const dynamic_modint& o) {
+        v += o.v;
+        if (v >= mod())
+            v -= mod();
+        return *this;
+    }
+    dynamic_modint& operator-=(const dynamic_modint& o) {
+        v += mod() - o.v;
+        if (v >= mod())
+            v -= mod();
+        return *this;
+    }
+    dynamic_modint& operator*=(const dynamic_modint& o) {
+        v = bt().mul(v, o.v);
+        return *this;
+    }
+    dynamic_modint& operator/=(const dynamic_modint& o) { return *this *= o.inv(); }
+
+    dynamic_modint operator-() const { return dynamic_modint() - *this; }
+    friend dynamic_modint operator+(dynamic_modint a, const dynamic_modint& b) { return a += b; }
+    friend dynamic_modint operator-(dynamic_modint a, const dynamic_modint& b) { return a -= b; }
+    friend dynamic_modint operator*(dynamic_modint a, const dynamic_modint& b) { return a *= b; }
+    friend dynamic_modint operator/(dynamic_modint a, const dynamic_modint& b) { return a /= b; }
+    friend bool operator==(const dynamic_modint& a, const dynamic_modint& b) { return a.v == b.v; }
+    friend bool operator!=(const dynamic_modint& a, const dynamic_modint& b) { return a.v != b.v; }
+
+    dynamic_modint pow(unsigned long long e) const {
+        dynamic_modint base = *this, res = 1;
+        for (; e; e >>= 1, base *= base)
+            if (e & 1)
+                res *= base;
+        return res;
+    }
+    dynamic_modint inv() const { return dynamic_modint(mod_inverse(v, mod())); }
+
+    friend ostream& operator<<(ostream& os, const dynamic_modint& x) { return os << x.val(); }
+    friend istream& operator>>(istream& is, dynamic_modint& x) {
+        long long y;
+        is >> y;
+        x = dynamic_modint(y);
+        return is;
+    }
+};
+
+template <int Id = -1>
+struct dynamic_modint64 {
+    uint64_t v;   // Montgomery form
+
+    static Montgomery64& mg() {
+        static Montgomery64 m((1ULL << 61) - 1);
+        return m;
+    }
+    static void set_mod(uint64_t m) {
+        assert(m % 2 == 1 && m < (1ULL << 63));
+        mg() = Montgomery64(m);
+    }
+    static uint64_t mod() { return mg().mod; }
+
+    dynamic_modint64() : v(0) {}
+    template <typename T, enable_if_t<is_integral_v<T>, int> = 0>
+    dynamic_modint64(T x) {
+        uint64_t y;
+        if constexpr (is_signed_v<T>) {
+            long long r = (long long)x % (long long)mod();
+            y = r < 0 ? uint64_t(r + (long long)mod()) : uint64_t(r);
+        } else {
+            y = uint64_t(x % mod());
+        }
+        v = mg().to(y);
+    }
+
+    uint64_t val() const { return mg().from(v); }
+
+    dynamic_modint64& operator+=(const dynamic_modint64& o) {
+        v += o.v;
+        if (v >= mod())
+            v -= mod();
+        return *this;
+    }
+    dynamic_modint64& operator-=(const dynamic_modint64& o) {
+        v += mod() - o.v;
+        if (v >= mod())
+            v -= mod();
+        return *this;
+    }
+    dynamic_modint64& operator*=(const dynamic_modint64& o) {
+        v = mg().mul(v, o.v);
+        return *this;
+    }
+    dynamic_modint64& operator/=(const dynamic_modint64& o) { return *this *= o.inv(); }
+
+    dynamic_modint64 operator-() const { return dynamic_modint64() - *this; }
+    friend dynamic_modint64 operator+(dynamic_modint64 a, const dynamic_modint64& b) { return a += b; }
+    friend dynamic_modint64 operator-(dynamic_modint64 a, const dynamic_modint64& b) { return a -= b; }
+    friend dynamic_modint64 operator*(dynamic_modint64 a, const dynamic_modint64& b) { return a *= b; }
+    friend dynamic_modint64 operator/(dynamic_modint64 a, const dynamic_modint64& b) { return a /= b; }
+    friend bool operator==(const dynamic_modint64& a, const dynamic_modint64& b) { return a.v == b.v; }
+    friend bool operator!=(const dynamic_modint64& a, const dynamic_modint64& b) { return a.v != b.v; }
+
+    dynamic_modint64 pow(unsigned long long e) const {
+        dynamic_modint64 base = *this, res = 1;
+        for (; e; e >>= 1, base *= base)
+            if (e & 1)
+                res *= base;
+        return res;
+    }
+    dynamic_modint64 inv() const {
+        // extended Euclid on 128-bit to avoid overflow for moduli near 2^63
+        __int128 a = val(), b = mod(), u = 1, w = 0;
+        while (b) {
+            __int128 t = a / b;
+            a -= t * b, swap(a, b);
+            u -= t * w, swap(u, w);
+        }
+        assert(a == 1 && "value is not invertible");
+        if (u < 0)
+            u += mod();
+        return dynamic_modint64(uint64_t(u));
+    }
+
+    friend ostream& operator<<(ostream& os, const dynamic_modint64& x) { return os << x.val(); }
+};
+
+// Replaces every element by its inverse using one modular inversion.
+template <typename Mint>
+void batch_inverse(vector<Mint>& a) {
+    int n = a.size();
+    if (n == 0)
+        return;
+    vector<Mint> pre(n);
+    Mint acc = 1;
+    for (int i = 0; i < n; i++) {
+        assert(a[i] != Mint(0));
+        pre[i] = acc;
+        acc *= a[i];
+    }
+    Mint inv = acc.inv();
+    for (int i = n - 1; i >= 0; i--) {
+        Mint ai = a[i];
+        a[i] = inv * pre[i];
+        inv *= ai;
+    }
+}
+
+using modint998244353 = static_modint<998244353>;
+using modint1000000007 = static_modint<1000000007>;
@@ -0,0 +1,349 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Number theoretic transform and convolution over static_modint.
+ *
+ * Features:
+ * - NTT<mint>: forward DIF / inverse DIT transforms without bit reversal
+ *   (pointwise products happen in bit-reversed order), radix-4 butterflies
+ *   with a single radix-2 level when log2(n) is odd.
+ * - Twiddles are stored per level contiguously (table[h + j] = w_{2h}^j), so
+ *   every butterfly pass streams through memory sequentially.
+ * - AVX2 path: 8 Montgomery lanes per butterfly (values stay in the Montgomery
+ *   form used by static_modint). Selected at runtime via __builtin_cpu_supports;
+ *   NTT<mint>::use_avx2 can be cleared to force the scalar path.
+ * - convolution(a, b): naive below a small size, NTT otherwise.
+ * - convolution_arbitrary(a, b): any modulus (static or dynamic modint) by three
+ *   NTT primes and Garner CRT.
+ *
+ * Requirements:
+ * - mint = static_modint<P> with P an odd prime, and result length <= 2^k where
+ *   2^k | P - 1 (998244353: 2^23; arbitrary mode: 2^24).
+ *
+ * Time: O(n log n)
+ * Space: O(n)
+ *
+ * Usage:
+ *  using mint = modint998244353;
+ *  vector<mint> a = {1, 2, 3}, b = {4, 5};
+ *  auto c = convolution(a, b);                       // {4, 13, 22, 15}
+ *
+ *  using mint7 = modint1000000007;
+ *  auto d = convolution_arbitrary(vector<mint7>{1, 2}, vector<mint7>{3, 4});
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CP_NTT_X86 1
+#endif
+#include "math/modular.hpp"
+using namespace std;
+
+constexpr uint32_t primitive_root(uint32_t p) {
+    if (p == 2)
+        return 1;
+    uint32_t factors[32] = {};
+    int cnt = 0;
+    uint32_t x = p - 1;
+    for (uint32_t d = 2; uint64_t(d) * d <= x; d++) {
+        if (x % d == 0) {
+            factors[cnt++] = d;
+            while (x % d == 0)
+                x /= d;
+        }
+    }
+    if (x > 1)
+        factors[cnt++] = x;
+    for (uint32_t g = 2;; g++) {
+        bool ok = true;
+        for (int i = 0; i < cnt && ok; i++) {
+            uint64_t e = (p - 1) / factors[i], base = g, r = 1;
+            for (; e; e >>= 1, base = base * base % p)
+                if (e & 1)
+                    r = r * base % p;
+            ok = r != 1;
+        }
+        if (ok)
+            return g;
+    }
+}
+
+inline bool ntt_cpu_has_avx2() {
+#ifdef CP_NTT_X86
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+template <typename mint>
+struct NTT {
+    static constexpr uint32_t MOD = mint::mod();
+    static_assert(mint::montgomery, "NTT needs an odd prime modulus");
+    static constexpr uint32_t G = primitive_root(MOD);
+    static constexpr int RANK = countr_zero(MOD - 1);
+
+    static inline bool use_avx2 = ntt_cpu_has_avx2();
+
+    // rt[h + j] = w_{2h}^j, rt3[q + j] = w_{4q}^{3j}; irt / irt3 use inverse roots.
+    static inline vector<mint> rt, rt3, irt, irt3;
+
+    static void prepare(int n) {
+        assert(n <= (1 << RANK));
+        if (int(rt.size()) >= n)
+            return;
+        int old = max<int>(rt.size(), 1);
+        rt.resize(n);
+        irt.resize(n);
+        rt3.resize(n);
+        irt3.resize(n);
+        for (int h = old; h < n; h *= 2) {
+            mint w = mint(G).pow((MOD - 1) / (2 * h)), iw = w.inv();
+            mint cur = 1, icur = 1;
+            for (int j = 0; j < h; j++) {
+                rt[h + j] = cur;
+                irt[h + j] = icur;
+                cur *= w;
+                icur *= iw;
+            }
+            // radix-4 stage with quarter q = h / 2 uses w_{4q}^{3j} = w_{2h}^{3j}
+            // (n = 2^k needs quarters up to n / 4, all covered by h < n)
+            for (int q = h / 2, j = 0; j < q; j++) {
+                rt3[q + j] = rt[h + j] * rt[h + j] * rt[h + j];
+                irt3[q + j] = irt[h + j] * irt[h + j] * irt[h + j];
+            }
+        }
+    }
+
+#ifdef CP_NTT_X86
+    __attribute__((target("avx2"))) static inline __m256i v_add(__m256i a, __m256i b, __m256i m) {
+        __m256i s = _mm256_add_epi32(a, b);
+        return _mm256_min_epu32(s, _mm256_sub_epi32(s, m));
+    }
+    __attribute__((target("avx2"))) static inline __m256i v_sub(__m256i a, __m256i b, __m256i m) {
+        __m256i d = _mm256_add_epi32(_mm256_sub_epi32(a, b), m);
+        return _mm256_min_epu32(d, _mm256_sub_epi32(d, m));
+    }
+    __attribute__((target("avx2"))) static inline __m256i v_mul(__m256i a, __m256i b, __m256i m, __m256i r) {
+        __m256i pe = _mm256_mul_epu32(a, b);
+        __m256i po = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+        __m256i te = _mm256_add_epi64(pe, _mm256_mul_epu32(_mm256_mul_epu32(pe, r), m));
+        __m256i to = _mm256_add_epi64(po, _mm256_mul_epu32(_mm256_mul_epu32(po, r), m));
+        __m256i res = _mm256_blend_epi32(_mm256_srli_epi64(te, 32), to, 0b10101010);
+        return _mm256_min_epu32(res, _mm256_sub_epi32(res, m));
+    }
+    static __m256i* vp(mint* p) { return reinterpret_cast<__m256i*>(p); }
+
+    __attribute__((target("avx2"))) static void radix4_forward_avx2(mint* a, int q) {
+        const __m256i m = _mm256_set1_epi32(MOD), r = _mm256_set1_epi32(mint::mg.r);
+        const __m256i im = _mm256_set1_epi32(rt[3].v);
+        for (int j = 0; j < q; j += 8) {
+            __m256i a0 = _mm256_loadu_si256(vp(a + j)), a1 = _mm256_loadu_si256(vp(a + j + q));
+            __m256i a2 = _mm256_loadu_si256(vp(a + j + 2 * q)), a3 = _mm256_loadu_si256(vp(a + j + 3 * q));
+            __m256i w1 = _mm256_loadu_si256(vp(&rt[2 * q + j])), w2 = _mm256_loadu_si256(vp(&rt[q + j]));
+            __m256i w3 = _mm256_loadu_si256(vp(&rt3[q + j]));
+            __m256i s02 = v_add(a0, a2, m), d02 = v_sub(a0, a2, m);
+            __m256i s13 = v_add(a1, a3, m), d13 = v_mul(v_sub(a1, a3, m), im, m, r);
+            _mm256_storeu_si256(vp(a + j), v_add(s02, s13, m));
+            _mm256_storeu_si256(vp(a + j + q), v_mul(v_sub(s02, s13, m), w2, m, r));
+            _mm256_storeu_si256(vp(a + j + 2 * q), v_mul(v_add(d02, d13, m), w1, m, r));
+            _mm256_storeu_si256(vp(a + j + 3 * q), v_mul(v_sub(d02, d13, m), w3, m, r));
+        }
+    }
+
+    __attribute__((target("avx2"))) static void radix4_inverse_avx2(mint* a, int q) {
+        const __m256i m = _mm256_set1_epi32(MOD), r = _mm256_set1_epi32(mint::mg.r);
+        const __m256i iim = _mm256_set1_epi32(irt[3].v);
+        for (int j = 0; j < q; j += 8) {
+            __m256i c0 = _mm256_loadu_si256(vp(a + j)), c1 = _mm256_loadu_si256(vp(a + j + q));
+            __m256i c2 = _mm256_loadu_si256(vp(a + j + 2 * q)), c3 = _mm256_loadu_si256(vp(a + j + 3 * q));
+            __m256i v1 = _mm256_loadu_si256(vp(&irt[2 * q + j])), v2 = _mm256_loadu_si256(vp(&irt[q + j]));
+            __m256i v3 = _mm256_loadu_si256(vp(&irt3[q + j]));
+            c1 = v_mul(c1, v2, m, r);
+            __m256i s = v_mul(c2, v1, m, r), t = v_mul(c3, v3, m, r);
+            __m256i b0 = v_add(c0, c1, m), b1 = v_sub(c0, c1, m);
+            __m256i u = v_add(s, t, m), w = v_mul(v_sub(s, t, m), iim, m, r);
+            _mm256_storeu_si256(vp(a + j), v_add(b0, u, m));
+            _mm256_storeu_si256(vp(a + j + 2 * q), v_sub(b0, u, m));
+            _mm256_storeu_si256(vp(a + j + q), v_add(b1, w, m));
+            _mm256_storeu_si256(vp(a + j + 3 * q), v_sub(b1, w, m));
+        }
+    }
+
+    __attribute__((target("avx2"))) static void radix2_avx2(mint* a, int h, bool inverse) {
+        const __m256i m = _mm256_set1_epi32(MOD), r = _mm256_set1_epi32(mint::mg.r);
+        const mint* tw = inverse ? &irt[h] : &rt[h];
+        for (int j = 0; j < h; j += 8) {
+            __m256i u = _mm256_loadu_si256(vp(a + j)), v = _mm256_loadu_si256(vp(a + j + h));
+            __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tw + j));
+            if (inverse) {
+                v = v_mul(v, w, m, r);
+                _mm256_storeu_si256(vp(a + j), v_add(u, v, m));
+                _mm256_storeu_si256(vp(a + j + h), v_sub(u, v, m));
+            } else {
+                _mm256_storeu_si256(vp(a + j), v_add(u, v, m));
+                _mm256_storeu_si256(vp(a + j + h), v_mul(v_sub(u, v, m), w, m, r));
+            }
+        }
+    }
+#endif
+
+    static void radix4_forward(mint* a, int q) {
+#ifdef CP_NTT_X86
+        if (use_avx2 && q >= 8)
+            return radix4_forward_avx2(a, q);
+#endif
+        const mint im = rt[3];
+        for (int j = 0; j < q; j++) {
+            mint a0 = a[j], a1 = a[j + q], a2 = a[j + 2 * q], a3 = a[j + 3 * q];
+            mint s02 = a0 + a2, d02 = a0 - a2, s13 = a1 + a3, d13 = (a1 - a3) * im;
+            a[j] = s02 + s13;
+            a[j + q] = (s02 - s13) * rt[q + j];
+            a[j + 2 * q] = (d02 + d13) * rt[2 * q + j];
+            a[j + 3 * q] = (d02 - d13) * rt3[q + j];
+        }
+    }
+
+    static void radix4_inverse(mint* a, int q) {
+#ifdef CP_NTT_X86
+        if (use_avx2 && q >= 8)
+            return radix4_inverse_avx2(a, q);
+#endif
+        const mint iim = irt[3];
+        for (int j = 0; j < q; j++) {
+            mint c0 = a[j], c1 = a[j + q] * irt[q + j];
+            mint s = a[j + 2 * q] * irt[2 * q + j], t = a[j + 3 * q] * irt3[q + j];
+            mint b0 = c0 + c1, b1 = c0 - c1, u = s + t, w = (s - t) * iim;
+            a[j] = b0 + u;
+            a[j + 2 * q] = b0 - u;
+            a[j + q] = b1 + w;
+            a[j + 3 * q] = b1 - w;
+        }
+    }
+
+    static void radix2(mint* a, int h, bool inverse) {
+#ifdef CP_NTT_X86
+        if (use_avx2 && h >= 8)
+            return radix2_avx2(a, h, inverse);
+#endif
+        for (int j = 0; j < h; j++) {
+            mint u = a[j], v = a[j + h];
+            if (inverse) {
+                v *= irt[h + j];
+                a[j] = u + v;
+                a[j + h] = u - v;
+            } else {
+                a[j] = u + v;
+                a[j + h] = (u - v) * rt[h + j];
+            }
+        }
+    }
+
+    // Natural order in, bit-reversed order out.
+    static void forward(mint* a, int n) {
+        assert(has_single_bit(unsigned(n)));
+        if (n == 1)
+            return;
+        prepare(max(n, 4));
+        int len = n;
+        if (countr_zero(unsigned(n)) & 1) {
+            radix2(a, n / 2, false);
+            len = n / 2;
+        }
+        for (; len >= 4; len /= 4)
+            for (int i = 0; i < n; i += len)
+                radix4_forward(a + i, len / 4);
+    }
+
+    // Bit-reversed order in, natural order out, scaled by 1 / n.
+    static void inverse(mint* a, int n) {
+        assert(has_single_bit(unsigned(n)));
+        if (n == 1)
+            return;
+        prepare(max(n, 4));
+        bool odd = countr_zero(unsigned(n)) & 1;
+        int top = odd ? n / 2 : n;
+        for (int len = 4; len <= top; len *= 4)
+            for (int i = 0; i < n; i += len)
+                radix4_inverse(a + i, len / 4);
+        if (odd)
+            radix2(a, n / 2, true);
+        mint inv_n = mint(n).inv();
+        for (int i = 0; i < n; i++)
+            a[i] *= inv_n;
+    }
+
+    static void forward(vector<mint>& a) { forward(a.data(), a.size()); }
+    static void inverse(vector<mint>& a) { inverse(a.data(), a.size()); }
+};
+
+template <typename mint>
+vector<mint> convolution_naive(const vector<mint>& a, const vector<mint>& b) {
+    if (a.empty() || b.empty())
+        return {};
+    vector<mint> c(a.size() + b.size() - 1);
+    for (int i = 0; i < int(a.size()); i++)
+        for (int j = 0; j < int(b.size()); j++)
+            c[i + j] += a[i] * b[j];
+    return c;
+}
+
+template <typename mint>
+vector<mint> convolution(const vector<mint>& a, const vector<mint>& b) {
+    if (a.empty() || b.empty())
+        return {};
+    if (min(a.size(), b.size()) <= 40)
+        return convolution_naive(a, b);
+    int n = a.size() + b.size() - 1;
+    int sz = bit_ceil(unsigned(n));
+    vector<mint> fa(a), fb;
+    fa.resize(sz);
+    NTT<mint>::forward(fa);
+    if (&a == &b) {
+        for (auto& x : fa)
+            x *= x;
+    } else {
+        fb = b;
+        fb.resize(sz);
+        NTT<mint>::forward(fb);
+        for (int i = 0; i < sz; i++)
+            fa[i] *= fb[i];
+    }
+    NTT<mint>::inverse(fa);
+    fa.resize(n);
+    return fa;
+}
+
+// Convolution under any modulus via three NTT primes and Garner's algorithm.
+template <typename Mint>
+vector<Mint> convolution_arbitrary(const vector<Mint>& a, const vector<Mint>& b) {
+    if (a.empty() || b.empty())
+        return {};
+    using m1 = static_modint<754974721>;
+    using m2 = static_modint<167772161>;
+    using m3 = static_modint<469762049>;
+    auto run = [&](auto tag) {
+        using M = decltype(tag);
+        vector<M> x(a.size()), y(b.size());
+        for (int i = 0; i < int(a.size()); i++)
+            x[i] = M(a[i].val());
+        for (int i = 0; i < int(b.size()); i++)
+            y[i] = M(b[i].val());
+        return convolution(x, y);
+    };
+    auto c1 = run(m1()), c2 = run(m2()), c3 = run(m3());
+
+    constexpr m2 inv1_2 = m2(m1::mod()).inv();
+    constexpr m3 inv12_3 = (m3(m1::mod()) * m3(m2::mod())).inv();
+    const uint64_t M = Mint::mod();
+    const Mint p1 = Mint(m1::mod()), p12 = Mint(uint64_t(m1::mod()) * m2::mod() % M);
+    vector<Mint> c(c1.size());
+    for (int i = 0; i < int(c.size()); i++) {
+        uint64_t x1 = c1[i].val();
+        uint64_t x2 = ((c2[i] - m2(x1)) * inv1_2).val();
+        uint64_t x3 = ((c3[i] - m3(x1) - m3(x2) * m3(m1::mod())) * inv12_3).val();
+        c[i] = Mint(x1) + p1 * Mint(x2) + p12 * Mint(x3);
+    }
+    return c;
+}
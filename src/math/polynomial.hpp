@@ -0,0 +1,172 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Formal power series and polynomial operations on top of NTT.
+ *
+ * Features:
+ * - poly_inv(f, n): 1 / f mod x^n by Newton iteration, 5 NTTs of size 2m
+ *   per doubling (the transform of g is used twice).
+ * - poly_log(f, n), poly_exp(f, n): f[0] must be 1 (log) or 0 (exp).
+ * - poly_divmod(a, b): quotient and remainder through reversed inverses.
+ * - multipoint_eval(f, xs): subproduct tree, remainders pushed down the tree,
+ *   Horner on small leaves.
+ * - Polynomials are vector<mint>, coefficient i of x^i, trailing zeros allowed.
+ *
+ * Requirements:
+ * - mint is an NTT-friendly static_modint (see math/ntt.hpp).
+ *
+ * Time: inv / log / exp / divmod O(n log n), multipoint_eval O(n log^2 n)
+ * Space: O(n) (multipoint_eval O(n log n))
+ *
+ * Usage:
+ *  using mint = modint998244353;
+ *  vector<mint> f = {1, 1};                 // 1 + x
+ *  auto g = poly_inv(f, 4);                 // {1, -1, 1, -1}
+ *  auto l = poly_log(f, 4), e = poly_exp(l, 4);   // e == {1, 1, 0, 0}
+ *  auto ys = multipoint_eval(f, {0, 1, 2}); // {1, 2, 3}
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "math/ntt.hpp"
+using namespace std;
+
+template <typename mint>
+vector<mint> poly_inv(const vector<mint>& f, int n) {
+    assert(!f.empty() && f[0] != mint(0));
+    vector<mint> g = {f[0].inv()};
+    g.reserve(n);
+    for (int m = 1; m < n; m *= 2) {
+        vector<mint> fa(2 * m), ga(g);
+        copy(f.begin(), f.begin() + min<int>(f.size(), 2 * m), fa.begin());
+        ga.resize(2 * m);
+        NTT<mint>::forward(fa);
+        NTT<mint>::forward(ga);
+        for (int i = 0; i < 2 * m; i++)
+            fa[i] *= ga[i];
+        NTT<mint>::inverse(fa);
+        // f * g == 1 mod x^m; the wrapped part of the cyclic product lands in [0, m)
+        fill(fa.begin(), fa.begin() + m, mint(0));
+        NTT<mint>::forward(fa);
+        for (int i = 0; i < 2 * m; i++)
+            fa[i] *= ga[i];
+        NTT<mint>::inverse(fa);
+        g.resize(2 * m);
+        for (int i = m; i < 2 * m; i++)
+            g[i] = -fa[i];
+    }
+    g.resize(n);
+    return g;
+}
+
+template <typename mint>
+vector<mint> poly_derivative(const vector<mint>& f) {
+    vector<mint> d(max<int>(f.size() - 1, 0));
+    for (int i = 1; i < int(f.size()); i++)
+        d[i - 1] = f[i] * mint(i);
+    return d;
+}
+
+template <typename mint>
+vector<mint> poly_integral(const vector<mint>& f) {
+    int n = f.size();
+    vector<mint> inv(n + 1), r(n + 1);
+    if (n >= 1)
+        inv[1] = 1;
+    for (int i = 2; i <= n; i++)
+        inv[i] = -inv[mint::mod() % i] * mint(mint::mod() / i);
+    for (int i = 0; i < n; i++)
+        r[i + 1] = f[i] * inv[i + 1];
+    return r;
+}
+
+template <typename mint>
+vector<mint> poly_log(const vector<mint>& f, int n) {
+    assert(!f.empty() && f[0] == mint(1));
+    vector<mint> fn(f.begin(), f.begin() + min<int>(f.size(), n));
+    auto q = convolution(poly_derivative(fn), poly_inv(fn, n));
+    q.resize(max(n - 1, 0));
+    auto r = poly_integral(q);
+    r.resize(n);
+    return r;
+}
+
+template <typename mint>
+vector<mint> poly_exp(const vector<mint>& f, int n) {
+    assert(f.empty() || f[0] == mint(0));
+    vector<mint> g = {1};
+    for (int m = 1; m < n; m *= 2) {
+        // g <- g * (1 - log g + f) mod x^{2m}
+        auto l = poly_log(g, 2 * m);
+        for (int i = 0; i < 2 * m; i++)
+            l[i] = (i < int(f.size()) ? f[i] : mint(0)) - l[i];
+        l[0] += 1;
+        g = convolution(g, l);
+        g.resize(2 * m);
+    }
+    g.resize(n);
+    return g;
+}
+
+// {q, r} with a = q * b + r, deg r < deg b. b must have a nonzero leading coefficient.
+template <typename mint>
+pair<vector<mint>, vector<mint>> poly_divmod(const vector<mint>& a, const vector<mint>& b) {
+    assert(!b.empty() && b.back() != mint(0));
+    int n = a.size(), m = b.size();
+    if (n < m)
+        return {{}, a};
+    int k = n - m + 1;
+    vector<mint> ra(a.rbegin(), a.rbegin() + k), rb(b.rbegin(), b.rend());
+    auto q = convolution(ra, poly_inv(rb, k));
+    q.resize(k);
+    reverse(q.begin(), q.end());
+    auto qb = convolution(q, b);
+    vector<mint> r(m - 1);
+    for (int i = 0; i < m - 1; i++)
+        r[i] = a[i] - qb[i];
+    return {q, r};
+}
+
+template <typename mint>
+vector<mint> multipoint_eval(const vector<mint>& f, const vector<mint>& xs) {
+    static const int LEAF = 32;
+    int m = xs.size();
+    vector<mint> res(m);
+    auto horner = [&](const vector<mint>& p, int l, int r) {
+        for (int i = l; i < r; i++) {
+            mint y = 0;
+            for (int j = int(p.size()) - 1; j >= 0; j--)
+                y = y * xs[i] + p[j];
+            res[i] = y;
+        }
+    };
+    if (m <= LEAF || f.size() <= LEAF) {
+        horner(f, 0, m);
+        return res;
+    }
+
+    // tree[v] = prod (x - xs[i]) over the node's range
+    vector<vector<mint>> tree(4 * m);
+    auto build = [&](auto&& self, int v, int l, int r) -> void {
+        if (r - l == 1) {
+            tree[v] = {-xs[l], 1};
+            return;
+        }
+        int mid = (l + r) / 2;
+        self(self, 2 * v, l, mid);
+        self(self, 2 * v + 1, mid, r);
+        tree[v] = convolution(tree[2 * v], tree[2 * v + 1]);
+    };
+    build(build, 1, 0, m);
+
+    auto down = [&](auto&& self, int v, int l, int r, vector<mint> p) -> void {
+        if (r - l <= LEAF) {
+            horner(p, l, r);
+            return;
+        }
+        int mid = (l + r) / 2;
+        self(self, 2 * v, l, mid, poly_divmod(p, tree[2 * v]).second);
+        self(self, 2 * v + 1, mid, r, poly_divmod(p, tree[2 * v + 1]).second);
+    };
+    down(down, 1, 0, m, poly_divmod(f, tree[1]).second);
+    return res;
+}
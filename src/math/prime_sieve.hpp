@@ -0,0 +1,236 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Prime generation: segmented Eratosthenes, linear sieve, prime counting.
+ *
+ * Features:
+ * - for_each_prime(lo, hi, f, threads): segmented sieve of Eratosthenes over
+ *   [lo, hi]. Odd numbers only, one bit each; segments are 32 KiB (L1 sized);
+ *   multiples of 3, 5, 7 are removed by copying a 105-word wheel pattern
+ *   instead of being crossed off. Segments are split over threads; primes are
+ *   streamed to f and never stored.
+ *   f(p) or f(p, thread_id). With threads > 1, f runs concurrently and primes
+ *   arrive in increasing order within each thread's block of segments only.
+ * - count_primes(lo, hi, threads): same sieve, popcount per segment.
+ * - primes_up_to(n): convenience vector for small n.
+ * - prime_pi(n): Lucy_Hedgehog prime counting, n up to ~9 * 10^15.
+ * - LinearSieve(n): smallest prime factor table (Euler's sieve) with O(log x)
+ *   factorization.
+ *
+ * Time: segmented sieve O(n log log n); prime_pi O(n^(3/4)); LinearSieve O(n)
+ * Space: segmented sieve O(sqrt(hi) + threads * 32 KiB); prime_pi O(sqrt n);
+ *        LinearSieve O(n)
+ *
+ * Usage:
+ *  uint64_t sum = 0;
+ *  for_each_prime(1, 1000000, [&](uint64_t p) { sum += p; });
+ *  uint64_t c = count_primes(1, 10000000000ULL, 0);   // 455052511, all cores
+ *  uint64_t pi = prime_pi(1000000000000ULL);          // 37607912018
+ *  LinearSieve ls(1000000);
+ *  auto f = ls.factorize(360);                        // {{2, 3}, {3, 2}, {5, 1}}
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "misc/parallel.hpp"
+using namespace std;
+
+namespace prime_sieve_detail {
+
+constexpr int SEGMENT_WORDS = 4096;   // 32 KiB of bits = 2^19 numbers
+constexpr int WHEEL_WORDS = 105;      // odd numbers repeat mod 3 * 5 * 7 every 105 bits
+
+// bit b of word g is the odd number 2 * (64g + b) + 1; set = not divisible by 3, 5, 7
+inline const array<uint64_t, WHEEL_WORDS>& wheel_pattern() {
+    static const array<uint64_t, WHEEL_WORDS> pattern = []() {
+        array<uint64_t, WHEEL_WORDS> w{};
+        for (int i = 0; i < 64 * WHEEL_WORDS; i++) {
+            int v = 2 * i + 1;
+            if (v % 3 && v % 5 && v % 7)
+                w[i / 64] |= 1ULL << (i % 64);
+        }
+        return w;
+    }();
+    return pattern;
+}
+
+// Odd primes in [11, n] (3, 5, 7 are handled by the wheel).
+inline vector<uint32_t> sieving_primes(uint32_t n) {
+    vector<char> comp(n + 1, 0);
+    vector<uint32_t> res;
+    for (uint64_t i = 3; i <= n; i += 2) {
+        if (comp[i])
+            continue;
+        if (i >= 11)
+            res.push_back(i);
+        for (uint64_t j = i * i; j <= n; j += 2 * i)
+            comp[j] = 1;
+    }
+    return res;
+}
+
+inline uint64_t isqrt(uint64_t n) {
+    uint64_t r = sqrtl((long double)n);
+    while (r * r > n)
+        r--;
+    while ((r + 1) * (r + 1) <= n)
+        r++;
+    return r;
+}
+
+// Calls visit(first_word, bits, words, thread_id) for every sieved segment of odd
+// indices [idx_lo, idx_hi); bits outside the range are cleared.
+template <typename Visit>
+void sieve_odd_segments(uint64_t idx_lo, uint64_t idx_hi, uint64_t hi, int threads, Visit&& visit) {
+    if (idx_lo >= idx_hi)
+        return;
+    const auto& wheel = wheel_pattern();
+    const vector<uint32_t> base = sieving_primes(isqrt(hi));
+    const uint64_t word_lo = idx_lo / 64, word_hi = (idx_hi + 63) / 64;
+    const uint64_t segments = (word_hi - word_lo + SEGMENT_WORDS - 1) / SEGMENT_WORDS;
+
+    parallel_for(segments, threads, [&](long long sb, long long se, int tid) {
+        vector<uint64_t> bits(SEGMENT_WORDS);
+        vector<uint64_t> next(base.size());   // next odd index to cross off, per prime
+        uint64_t start_idx = (word_lo + sb * SEGMENT_WORDS) * 64;
+        for (size_t k = 0; k < base.size(); k++) {
+            uint64_t p = base[k], v = 2 * start_idx + 1;
+            uint64_t m = (v + p - 1) / p * p;
+            if (m % 2 == 0)
+                m += p;
+            next[k] = (max(m, p * p) - 1) / 2;
+        }
+        for (long long s = sb; s < se; s++) {
+            uint64_t w0 = word_lo + s * SEGMENT_WORDS;
+            int words = int(min<uint64_t>(SEGMENT_WORDS, word_hi - w0));
+            uint64_t seg_lo = w0 * 64, seg_hi = seg_lo + uint64_t(words) * 64;
+            for (int w = 0, r = w0 % WHEEL_WORDS; w < words; w++, r = r + 1 == WHEEL_WORDS ? 0 : r + 1)
+                bits[w] = wheel[r];
+            if (w0 == 0)
+                bits[0] = (bits[0] & ~1ULL) | 0b1110;   // 1 is not prime, 3, 5, 7 are
+            for (size_t k = 0; k < base.size(); k++) {
+                uint64_t j = next[k];
+                if (j >= seg_hi)
+                    continue;
+                const uint32_t p = base[k];
+                uint64_t* b = bits.data();
+                uint64_t rel = j - seg_lo, lim = seg_hi - seg_lo;
+                for (; rel < lim; rel += p)
+                    b[rel >> 6] &= ~(1ULL << (rel & 63));
+                next[k] = seg_lo + rel;
+            }
+            if (idx_lo > seg_lo)
+                bits[0] &= ~0ULL << (idx_lo - seg_lo);   // idx_lo lies in the first word
+            if (idx_hi < seg_hi) {
+                uint64_t rel = idx_hi - seg_lo;
+                bits[rel / 64] &= (1ULL << (rel % 64)) - 1;
+                for (int w = rel / 64 + 1; w < words; w++)
+                    bits[w] = 0;
+            }
+            visit(w0, bits.data(), words, tid);
+        }
+    });
+}
+
+}  // namespace prime_sieve_detail
+
+template <typename F>
+void for_each_prime(uint64_t lo, uint64_t hi, F&& f, int threads = 1) {
+    auto emit = [&](uint64_t p, int tid) {
+        if constexpr (is_invocable_v<F, uint64_t, int>)
+            f(p, tid);
+        else
+            f(p);
+    };
+    if (hi < 2 || lo > hi)
+        return;
+    if (lo <= 2)
+        emit(2, 0);
+    prime_sieve_detail::sieve_odd_segments(
+        max<uint64_t>(lo, 3) / 2, (hi + 1) / 2, hi, threads,
+        [&](uint64_t w0, const uint64_t* bits, int words, int tid) {
+            for (int w = 0; w < words; w++)
+                for (uint64_t x = bits[w]; x; x &= x - 1)
+                    emit(2 * ((w0 + w) * 64 + __builtin_ctzll(x)) + 1, tid);
+        });
+}
+
+inline uint64_t count_primes(uint64_t lo, uint64_t hi, int threads = 1) {
+    if (hi < 2 || lo > hi)
+        return 0;
+    vector<uint64_t> partial(resolve_threads(threads), 0);
+    prime_sieve_detail::sieve_odd_segments(max<uint64_t>(lo, 3) / 2, (hi + 1) / 2, hi, threads,
+                                           [&](uint64_t, const uint64_t* bits, int words, int tid) {
+                                               uint64_t c = 0;
+                                               for (int w = 0; w < words; w++)
+                                                   c += __builtin_popcountll(bits[w]);
+                                               partial[tid] += c;
+                                           });
+    return accumulate(partial.begin(), partial.end(), uint64_t(lo <= 2));
+}
+
+inline vector<uint64_t> primes_up_to(uint64_t n) {
+    vector<uint64_t> res;
+    for_each_prime(2, n, [&](uint64_t p) { res.push_back(p); });
+    return res;
+}
+
+// Number of primes <= n (Lucy_Hedgehog). Quotients use double division, exact for n < 2^53.
+inline uint64_t prime_pi(uint64_t n) {
+    if (n < 2)
+        return 0;
+    assert(n < (1ULL << 53));
+    const uint64_t v = prime_sieve_detail::isqrt(n);
+    const double nd = n;
+    // small[i] = #{primes <= i} candidates, large[i] = same for n / i
+    vector<uint64_t> small(v + 1), large(v + 1);
+    for (uint64_t i = 1; i <= v; i++) {
+        small[i] = i - 1;
+        large[i] = uint64_t(nd / i) - 1;
+    }
+    for (uint64_t p = 2; p <= v; p++) {
+        if (small[p] == small[p - 1])
+            continue;
+        const uint64_t pc = small[p - 1], q = p * p;
+        const uint64_t end = min<uint64_t>(v, n / q);
+        for (uint64_t i = 1; i <= end; i++) {
+            uint64_t d = i * p;
+            large[i] -= (d <= v ? large[d] : small[uint64_t(nd / d)]) - pc;
+        }
+        for (uint64_t i = v; i >= q; i--)
+            small[i] -= small[i / p] - pc;
+    }
+    return large[1];
+}
+
+struct LinearSieve {
+    vector<int> spf;      // smallest prime factor, spf[0] = spf[1] = 0
+    vector<int> primes;
+
+    LinearSieve(int n) : spf(n + 1, 0) {
+        for (int i = 2; i <= n; i++) {
+            if (spf[i] == 0) {
+                spf[i] = i;
+                primes.push_back(i);
+            }
+            for (int p : primes) {
+                if (p > spf[i] || 1LL * i * p > n)
+                    break;
+                spf[i * p] = p;
+            }
+        }
+    }
+
+    bool is_prime(int x) const { return x >= 2 && spf[x] == x; }
+
+    // {prime, exponent} in increasing prime order
+    vector<pair<int, int>> factorize(int x) const {
+        vector<pair<int, int>> res;
+        while (x > 1) {
+            int p = spf[x], e = 0;
+            while (x % p == 0)
+                x /= p, e++;
+            res.push_back({p, e});
+        }
+        return res;
+    }
+};
@@ -0,0 +1,268 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Cache-friendly static searches and binary search on the answer.
+ *
+ * Features:
+ * - branchless_lower_bound(first, last, x[, comp]): drop-in for
+ *   std::lower_bound on random access ranges; the loop body is a conditional
+ *   move, so there are no mispredictions on random queries, and both
+ *   candidates for the next probe are prefetched.
+ * - Eytzinger<T>(sorted): keys in BFS order of a perfect search tree
+ *   (padded with max()). lower_bound(x) returns the index into `sorted`;
+ *   each step prefetches the cache line holding the node's descendants a few
+ *   levels below, which hides most of the DRAM latency on large arrays.
+ * - STree<T>(sorted): static B+ tree with one cache line (64 / sizeof(T)
+ *   keys) per node; layer 0 is the padded sorted array itself, followed by
+ *   the upper layers. A node is searched by counting keys < x; for signed
+ *   32/64-bit integers this is two AVX2 compares and a popcount when the CPU
+ *   supports it.
+ * - first_true(lo, hi, pred): smallest x in [lo, hi) with pred(x), hi if
+ *   none; pred must be monotone (false...false true...true).
+ * - first_true_parallel(lo, hi, pred, threads): the same, but every round
+ *   evaluates pred at `threads` points at once and keeps one of threads + 1
+ *   pieces; for expensive predicates.
+ * - bisect_real(lo, hi, pred): first_true over doubles. It bisects the
+ *   ordered bit patterns, so it ends on two adjacent doubles after at most
+ *   64 evaluations, whatever the magnitudes of lo and hi.
+ *
+ * Requirements: Eytzinger / STree need an arithmetic T (max() is the pad);
+ * first_true_parallel calls pred on several threads at once, so pred must be
+ * thread-safe and free of side effects.
+ * Time: O(log n) per query; first_true_parallel does
+ *       O(log n / log(threads + 1)) rounds
+ * Space: O(n) (Eytzinger), O(n (1 + 1 / B)) (STree)
+ *
+ * Usage:
+ *  vector<int> a = ...;   // sorted
+ *  STree<int> st(a);
+ *  int i = st.lower_bound(x);   // == lower_bound(a.begin(), a.end(), x) - a.begin()
+ *  long long k = first_true(0LL, 1LL << 40, [&](long long m) { return f(m) >= target; });
+ *  double r = bisect_real(0, 2, [](double x) { return x * x >= 2; });
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "misc/parallel.hpp"
+#include "misc/radix_sort.hpp"
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CP_SEARCH_X86 1
+#endif
+using namespace std;
+
+template <typename It, typename T, typename Compare = less<>>
+It branchless_lower_bound(It first, It last, const T& x, Compare comp = Compare()) {
+    auto len = last - first;
+    if (len == 0)
+        return first;
+    while (len > 1) {
+        auto half = len / 2;
+        // both possible next probes, so DRAM-sized arrays overlap two misses
+        __builtin_prefetch(&*(first + (len - half) / 2));
+        __builtin_prefetch(&*(first + half + (len - half) / 2));
+        It mid = first + half;   // select between two iterators: a cmov, not a branch
+        first = comp(mid[-1], x) ? mid : first;
+        len -= half;
+    }
+    return first + comp(*first, x);
+}
+
+namespace search_detail {
+
+// Allocations start on a cache line, so node i of a layout occupies line i.
+template <typename T>
+struct CacheAligned {
+    using value_type = T;
+    CacheAligned() = default;
+    template <typename U>
+    CacheAligned(const CacheAligned<U>&) {}
+    T* allocate(size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), align_val_t(64))); }
+    void deallocate(T* p, size_t) { ::operator delete(p, align_val_t(64)); }
+    friend bool operator==(const CacheAligned&, const CacheAligned&) { return true; }
+};
+
+template <typename T>
+using aligned_vector = vector<T, CacheAligned<T>>;
+
+template <typename T>
+constexpr int node_keys = max<int>(1, 64 / sizeof(T));
+
+// Keys < x in one node.
+template <typename T>
+inline int count_less(const T* node, T x) {
+    int c = 0;
+    for (int j = 0; j < node_keys<T>; j++)
+        c += node[j] < x;
+    return c;
+}
+
+template <typename T>
+int stree_search(const T* buf, const vector<size_t>& off, size_t n, T x) {
+    constexpr int B = node_keys<T>;
+    size_t k = 0;
+    for (int l = int(off.size()) - 1; l > 0; l--)
+        k = k * (B + 1) + count_less(buf + off[l] + k * B, x);
+    return int(min(k * B + count_less(buf + k * B, x), n));
+}
+
+#ifdef CP_SEARCH_X86
+template <typename T>
+constexpr bool avx2_keys = is_integral_v<T> && is_signed_v<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename T>
+__attribute__((target("avx2"))) inline int count_less_avx2(const T* node, T x) {
+    const __m256i* p = reinterpret_cast<const __m256i*>(node);
+    __m256i a = _mm256_load_si256(p), b = _mm256_load_si256(p + 1), y;
+    if constexpr (sizeof(T) == 4) {
+        y = _mm256_set1_epi32(x);
+        a = _mm256_cmpgt_epi32(y, a);
+        b = _mm256_cmpgt_epi32(y, b);
+    } else {
+        y = _mm256_set1_epi64x(x);
+        a = _mm256_cmpgt_epi64(y, a);
+        b = _mm256_cmpgt_epi64(y, b);
+    }
+    uint64_t mask = uint32_t(_mm256_movemask_epi8(a)) | uint64_t(uint32_t(_mm256_movemask_epi8(b))) << 32;
+    return __builtin_popcountll(mask) / int(sizeof(T));
+}
+
+template <typename T>
+__attribute__((target("avx2"))) int stree_search_avx2(const T* buf, const vector<size_t>& off, size_t n, T x) {
+    constexpr int B = node_keys<T>;
+    size_t k = 0;
+    for (int l = int(off.size()) - 1; l > 0; l--)
+        k = k * (B + 1) + count_less_avx2(buf + off[l] + k * B, x);
+    return int(min(k * B + count_less_avx2(buf + k * B, x), n));
+}
+
+inline const bool search_use_avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+}  // namespace search_detail
+
+template <typename T>
+struct Eytzinger {
+    static_assert(is_arithmetic_v<T>, "Eytzinger pads with numeric_limits<T>::max()");
+
+    search_detail::aligned_vector<T> tree;   // tree[1..]: BFS order, leaves = tree.size()
+    size_t n = 0;
+
+    Eytzinger() = default;
+
+    explicit Eytzinger(const vector<T>& sorted) : tree(bit_ceil(sorted.size() + 1)), n(sorted.size()) {
+        size_t i = 0;
+        fill(sorted, i, 1);
+    }
+
+    int lower_bound(T x) const {
+        constexpr size_t B = search_detail::node_keys<T>;
+        size_t k = 1, leaves = tree.size();
+        while (k < leaves) {
+            __builtin_prefetch(tree.data() + k * B);
+            k = 2 * k + (tree[k] < x);
+        }
+        // The tree is perfect, so the leaf reached counts the keys below x.
+        return int(min(k - leaves, n));
+    }
+
+private:
+    // In-order walk of the implicit tree hands out keys in sorted order.
+    void fill(const vector<T>& sorted, size_t& i, size_t k) {
+        if (k >= tree.size())
+            return;
+        fill(sorted, i, 2 * k);
+        tree[k] = i < n ? sorted[i] : numeric_limits<T>::max();
+        i++;
+        fill(sorted, i, 2 * k + 1);
+    }
+};
+
+template <typename T>
+struct STree {
+    static_assert(is_arithmetic_v<T>, "STree pads with numeric_limits<T>::max()");
+    static constexpr int B = search_detail::node_keys<T>;
+
+    // Layer 0 = the padded sorted keys; layer l + 1 node k has children
+    // k * (B + 1) + j in layer l, and key j = smallest key under child j + 1.
+    search_detail::aligned_vector<T> buf;
+    vector<size_t> off;   // off[l] = first element of layer l
+    size_t n = 0;
+
+    STree() = default;
+
+    explicit STree(const vector<T>& sorted) : n(sorted.size()) {
+        vector<size_t> nodes = {max<size_t>(1, (n + B - 1) / B)};
+        while (nodes.back() > 1)
+            nodes.push_back((nodes.back() + B) / (B + 1));
+        int h = nodes.size();
+        off.assign(h, 0);
+        size_t total = nodes[0] * B;
+        for (int l = h - 1; l > 0; l--)
+            off[l] = total, total += nodes[l] * B;
+        buf.assign(total, numeric_limits<T>::max());
+        copy(sorted.begin(), sorted.end(), buf.begin());
+
+        size_t span = 1;   // leaves under one node of layer l - 1
+        for (int l = 1; l < h; l++, span *= B + 1)
+            for (size_t k = 0; k < nodes[l]; k++)
+                for (int j = 0; j < B; j++) {
+                    size_t leaf = (k * (B + 1) + j + 1) * span;
+                    if (leaf < nodes[0])
+                        buf[off[l] + k * B + j] = buf[leaf * B];
+                }
+    }
+
+    int lower_bound(T x) const {
+#ifdef CP_SEARCH_X86
+        if constexpr (search_detail::avx2_keys<T>)
+            if (search_detail::search_use_avx2)
+                return search_detail::stree_search_avx2(buf.data(), off, n, x);
+#endif
+        return search_detail::stree_search(buf.data(), off, n, x);
+    }
+};
+
+template <typename I, typename Pred>
+I first_true(I lo, I hi, Pred pred) {
+    while (lo < hi) {
+        I mid = lo + (hi - lo) / 2;
+        if (pred(mid))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+template <typename I, typename Pred>
+I first_true_parallel(I lo, I hi, Pred pred, int threads = 0) {
+    threads = resolve_threads(threads);
+    vector<char> res(threads);
+    vector<I> at(threads);
+    while (hi - lo > threads) {
+        // `threads` probes split [lo, hi) into threads + 1 pieces.
+        for (int t = 0; t < threads; t++)
+            at[t] = lo + I((__int128(hi - lo) * (t + 1)) / (threads + 1));
+        parallel_for(threads, threads, [&](long long b, long long e, int) {
+            for (long long t = b; t < e; t++)
+                res[t] = pred(at[t]);
+        });
+        int t = 0;
+        while (t < threads && !res[t])
+            t++;
+        if (t > 0)
+            lo = at[t - 1] + 1;
+        if (t < threads)
+            hi = at[t];
+    }
+    return first_true(lo, hi, pred);
+}
+
+template <typename Pred>
+double bisect_real(double lo, double hi, Pred pred) {
+    // radix_key maps doubles to integers in the same order; search those.
+    auto key = [](double x) { return radix_key(x); };
+    auto from = [](uint64_t k) { return bit_cast<double>(k >> 63 ? k ^ (1ULL << 63) : ~k); };
+    uint64_t k = first_true(key(lo), key(hi), [&](uint64_t m) { return pred(from(m)); });
+    return from(k);
+}
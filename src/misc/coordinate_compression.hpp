@@ -0,0 +1,102 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Coordinate compression of integer keys via LSD radix sort.
+ *
+ * Features:
+ * - CoordinateCompression<T>(a, threads): one radix sort of (key, index)
+ *   pairs yields both the sorted distinct keys and rank[i] = position of a[i]
+ *   among them. threads = 0 uses all cores (see radix_sort / parallel_for).
+ * - lower_bound(x): number of keys < x; find(x): rank of x or -1.
+ *   Lookups go through an Eytzinger copy of the keys (misc/binary_search.hpp)
+ *   instead of binary searching `keys`.
+ * - ranks(queries, threads): lower_bound for a batch of values.
+ *
+ * Requirements: T is an integer type.
+ * Time: O((n + 256 * threads) * key bytes) build, O(log m) per lookup
+ * Space: O(n + m)
+ *
+ * Usage:
+ *  vector<long long> xs = ...;
+ *  CoordinateCompression cc(xs);
+ *  FenwickTree<long long> fw(cc.size());
+ *  fw.add(cc.rank[i], 1);
+ *  int r = cc.lower_bound(x);   // first key >= x
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "misc/binary_search.hpp"
+#include "misc/parallel.hpp"
+#include "misc/radix_sort.hpp"
+using namespace std;
+
+template <typename T>
+struct CoordinateCompression {
+    static_assert(is_integral_v<T>, "coordinate compression needs integer keys");
+    using K = decltype(radix_key(T()));
+
+    vector<T> keys;      // sorted distinct keys
+    vector<int> rank;    // rank[i] = index of a[i] in keys
+    Eytzinger<T> index;  // lookups by value
+
+    CoordinateCompression() = default;
+
+    explicit CoordinateCompression(const vector<T>& a, int threads = 1) : rank(a.size()) {
+        long long n = a.size();
+        threads = resolve_threads(threads);
+        if (n < (1 << 16))
+            threads = 1;
+        struct Item {
+            K key;
+            uint32_t idx;
+        };
+        vector<Item> items(n);
+        parallel_for(n, threads, [&](long long b, long long e, int) {
+            for (long long i = b; i < e; i++)
+                items[i] = {radix_key(a[i]), uint32_t(i)};
+        });
+        radix_sort(items, [](const Item& it) { return it.key; }, threads);
+
+        // Distinct keys per chunk, then a prefix sum gives each chunk its first rank.
+        threads = int(min<long long>(threads, max(n, 1LL)));
+        auto starts = [&](long long i) { return i == 0 || items[i].key != items[i - 1].key; };
+        vector<int> base(threads + 1, 0);
+        parallel_for(n, threads, [&](long long b, long long e, int t) {
+            int c = 0;
+            for (long long i = b; i < e; i++)
+                c += starts(i);
+            base[t + 1] = c;
+        });
+        partial_sum(base.begin(), base.end(), base.begin());
+        keys.resize(base[threads]);
+        parallel_for(n, threads, [&](long long b, long long e, int t) {
+            int r = base[t] - 1;
+            for (long long i = b; i < e; i++) {
+                if (starts(i))
+                    keys[++r] = a[items[i].idx];
+                rank[items[i].idx] = r;
+            }
+        });
+        index = Eytzinger<T>(keys);
+    }
+
+    int size() const { return keys.size(); }
+
+    const T& operator[](int i) const { return keys[i]; }
+
+    int lower_bound(T x) const { return index.lower_bound(x); }
+
+    int find(T x) const {
+        int r = lower_bound(x);
+        return r < size() && keys[r] == x ? r : -1;
+    }
+
+    vector<int> ranks(const vector<T>& xs, int threads = 1) const {
+        vector<int> res(xs.size());
+        parallel_for(xs.size(), xs.size() < (1 << 16) ? 1 : threads, [&](long long b, long long e, int) {
+            for (long long i = b; i < e; i++)
+                res[i] = lower_bound(xs[i]);
+        });
+        return res;
+    }
+};
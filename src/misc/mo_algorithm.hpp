@@ -0,0 +1,211 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Mo's algorithm (Hilbert or block order), Mo with updates and Mo on trees.
+ *
+ * Features:
+ * - mo(n, queries, add, remove, answer, order): offline queries on half-open
+ *   ranges [l, r) of an array of size n. add(i) / remove(i) move one endpoint,
+ *   answer(q) is called once the window equals query q. The callbacks are
+ *   template parameters, so they inline into the pointer-moving loops.
+ * - MoOrder::hilbert (default) sorts queries along a Hilbert curve over
+ *   (l, r), which keeps consecutive windows close in both coordinates;
+ *   MoOrder::block is the classic l / B, r (alternating direction) order.
+ *   On uniform random queries the two do about the same number of moves;
+ *   Hilbert needs no block size, so it degrades less on skewed query sets.
+ *   Sort keys are 64-bit integers, sorted with radix_sort.
+ * - mo_with_updates(n, queries, updates, add, remove, apply, answer): queries
+ *   {l, r, t} see the first t point updates. apply(t, l, r) toggles update t
+ *   (it must undo itself when called twice) given the current window [l, r).
+ *   Order (l / B, r / B, t) with B ~ n^(2/3); the packed sort key holds t
+ *   in 24 bits, so num_updates < 2^24.
+ * - mo_on_tree(tree, root, queries, add, remove, answer): queries on the
+ *   vertex sets of paths u - v of a tree (CSRGraph, undirected). Runs on the
+ *   entry/exit Euler tour; vertices seen twice in the window cancel out, and
+ *   the LCA (from an RMQ over the DFS order) is added around answer().
+ *
+ * Time: O((n + q) sqrt(n)) range moves (O(n^(5/3)) with updates)
+ * Space: O(n + q)
+ *
+ * Usage:
+ *  vector<int> cnt(maxv), a = ...; int distinct = 0;
+ *  vector<pair<int, int>> qs = {{0, 5}, {2, 9}};
+ *  vector<int> ans(qs.size());
+ *  mo(a.size(), qs,
+ *     [&](int i) { distinct += cnt[a[i]]++ == 0; },
+ *     [&](int i) { distinct -= --cnt[a[i]] == 0; },
+ *     [&](int q) { ans[q] = distinct; });
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "data-structures/sparse_table.hpp"
+#include "graph/dfs_bfs.hpp"
+#include "misc/radix_sort.hpp"
+using namespace std;
+
+enum class MoOrder { hilbert, block };
+
+// Position of (x, y) along the Hilbert curve filling [0, 2^lg)^2.
+inline uint64_t hilbert_order(uint32_t x, uint32_t y, int lg) {
+    uint64_t d = 0;
+    for (uint32_t s = lg ? 1u << (lg - 1) : 0; s; s >>= 1) {
+        bool rx = x & s, ry = y & s;
+        d = d << 2 | ((3 * rx) ^ ry);
+        if (!ry) {
+            if (rx)
+                x = ~x, y = ~y;
+            swap(x, y);
+        }
+    }
+    return d;
+}
+
+namespace mo_detail {
+
+// Query indices sorted by a 64-bit key.
+template <typename KeyF>
+vector<int> sorted_by(int q, KeyF key) {
+    vector<pair<uint64_t, int>> items(q);
+    for (int i = 0; i < q; i++)
+        items[i] = {key(i), i};
+    radix_sort(items, [](const pair<uint64_t, int>& p) { return p.first; });
+    vector<int> order(q);
+    for (int i = 0; i < q; i++)
+        order[i] = items[i].second;
+    return order;
+}
+
+inline vector<int> range_order(int n, const vector<pair<int, int>>& qs, MoOrder mode) {
+    int q = qs.size();
+    if (mode == MoOrder::hilbert) {
+        int lg = bit_width(unsigned(max(n, 1)));
+        return sorted_by(q, [&](int i) { return hilbert_order(qs[i].first, qs[i].second, lg); });
+    }
+    uint64_t block = max(1, int(n / sqrt(max(q, 1))));
+    return sorted_by(q, [&](int i) {
+        uint64_t b = qs[i].first / block, r = qs[i].second;
+        return b << 32 | (b & 1 ? ~r & 0xffffffffULL : r);
+    });
+}
+
+}  // namespace mo_detail
+
+template <typename Add, typename Remove, typename Answer>
+void mo(int n, const vector<pair<int, int>>& queries, Add add, Remove remove, Answer answer,
+        MoOrder mode = MoOrder::hilbert) {
+    int l = 0, r = 0;
+    for (int qi : mo_detail::range_order(n, queries, mode)) {
+        auto [ql, qr] = queries[qi];
+        while (l > ql)
+            add(--l);
+        while (r < qr)
+            add(r++);
+        while (l < ql)
+            remove(l++);
+        while (r > qr)
+            remove(--r);
+        answer(qi);
+    }
+}
+
+// queries[i] = {l, r, t}: range [l, r) after the first t of num_updates updates.
+template <typename Add, typename Remove, typename Apply, typename Answer>
+void mo_with_updates(int n, const vector<array<int, 3>>& queries, int num_updates, Add add, Remove remove,
+                     Apply apply, Answer answer) {
+    assert(num_updates < (1 << 24));   // t fills the low 24 bits of the sort key
+    int q = queries.size();
+    uint64_t block = max(1, int(cbrt(double(n) * n * max(num_updates, 1) / max(q, 1))));
+    block = max<uint64_t>(block, uint64_t(sqrt(max(n, 1))));
+    auto order = mo_detail::sorted_by(q, [&](int i) {
+        auto [ql, qr, t] = queries[i];
+        uint64_t bl = ql / block, br = qr / block;
+        if (bl & 1)
+            br = 0xfffff - br;
+        uint64_t tt = br & 1 ? num_updates - t : t;
+        return bl << 44 | br << 24 | tt;
+    });
+    int l = 0, r = 0, t = 0;
+    for (int qi : order) {
+        auto [ql, qr, qt] = queries[qi];
+        while (l > ql)
+            add(--l);
+        while (r < qr)
+            add(r++);
+        while (l < ql)
+            remove(l++);
+        while (r > qr)
+            remove(--r);
+        while (t < qt)
+            apply(t++, l, r);
+        while (t > qt)
+            apply(--t, l, r);
+        answer(qi);
+    }
+}
+
+// queries[i] = {u, v}: the vertices of the tree path between u and v.
+template <typename Add, typename Remove, typename Answer>
+void mo_on_tree(const CSRGraph& tree, int root, const vector<pair<int, int>>& queries, Add add, Remove remove,
+                Answer answer, MoOrder mode = MoOrder::hilbert) {
+    const int n = tree.n;
+    auto dfs = dfs_order(tree, root);
+    vector<int> pos(n), depth(n, 0), sz(n, 1);
+    for (int i = 0; i < n; i++) {
+        int v = dfs.pre[i];
+        pos[v] = i;
+        if (dfs.parent[v] >= 0)
+            depth[v] = depth[dfs.parent[v]] + 1;
+    }
+    for (int i = n - 1; i > 0; i--)
+        sz[dfs.parent[dfs.pre[i]]] += sz[dfs.pre[i]];
+
+    // Entry/exit tour: when v is entered, pos[v] vertices were entered and all of
+    // them but the depth[v] ancestors have been left.
+    vector<int> tin(n), tout(n), at(2 * n);
+    for (int v = 0; v < n; v++) {
+        tin[v] = 2 * pos[v] - depth[v];
+        tout[v] = tin[v] + 2 * sz[v] - 1;
+        at[tin[v]] = at[tout[v]] = v;
+    }
+
+    // LCA: for pos[u] < pos[v], the parent of the shallowest vertex in DFS order (pos[u], pos[v]].
+    vector<pair<int, int>> key(n);
+    for (int i = 0; i < n; i++)
+        key[i] = {depth[dfs.pre[i]], dfs.parent[dfs.pre[i]]};
+    auto pmin = [](const pair<int, int>& a, const pair<int, int>& b) { return min(a, b); };
+    RMQ<pair<int, int>, decltype(pmin)> rmq(key, pmin);
+
+    int q = queries.size();
+    vector<pair<int, int>> ranges(q);
+    vector<int> extra(q, -1);
+    for (int i = 0; i < q; i++) {
+        auto [u, v] = queries[i];
+        if (tin[u] > tin[v])
+            swap(u, v);
+        int lca = u == v ? u : rmq.get(pos[u] + 1, pos[v]).second;
+        if (lca == u) {
+            ranges[i] = {tin[u], tin[v] + 1};
+        } else {
+            ranges[i] = {tout[u], tin[v] + 1};
+            extra[i] = lca;
+        }
+    }
+
+    vector<char> in(n, 0);
+    auto toggle = [&](int i) {
+        int v = at[i];
+        if ((in[v] ^= 1))
+            add(v);
+        else
+            remove(v);
+    };
+    mo(2 * n, ranges, toggle, toggle,
+       [&](int qi) {
+           if (extra[qi] >= 0)
+               add(extra[qi]);
+           answer(qi);
+           if (extra[qi] >= 0)
+               remove(extra[qi]);
+       },
+       mode);
+}
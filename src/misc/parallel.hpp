@@ -0,0 +1,45 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Minimal fork-join helpers on top of std::thread.
+ *
+ * Features:
+ * - resolve_threads(t): t if positive, otherwise the hardware concurrency.
+ * - parallel_for(n, t, f): splits [0, n) into t contiguous chunks and calls
+ *   f(begin, end, thread_id) for each chunk; chunk 0 runs on the caller.
+ *   Chunks are ordered by thread_id, so per-thread results concatenated in
+ *   thread_id order preserve the sequential order.
+ *
+ * Usage:
+ *  vector<long long> partial(resolve_threads(0));
+ *  parallel_for(n, 0, [&](long long b, long long e, int tid) {
+ *      for (long long i = b; i < e; i++) partial[tid] += a[i];
+ *  });
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+inline int resolve_threads(int threads) {
+    if (threads > 0)
+        return threads;
+    return max(1u, thread::hardware_concurrency());
+}
+
+template <typename F>
+void parallel_for(long long n, int threads, F&& f) {
+    if (n <= 0)
+        return;
+    threads = int(min<long long>(resolve_threads(threads), n));
+    if (threads == 1) {
+        f(0LL, n, 0);
+        return;
+    }
+    vector<thread> pool;
+    pool.reserve(threads - 1);
+    for (int t = 1; t < threads; t++)
+        pool.emplace_back([&f, n, threads, t]() { f(n * t / threads, n * (t + 1) / threads, t); });
+    f(0LL, n / threads, 0);
+    for (auto& th : pool)
+        th.join();
+}
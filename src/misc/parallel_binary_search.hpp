@@ -0,0 +1,71 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Offline parallel binary search over a timeline of updates.
+ *
+ * Features:
+ * - parallel_binary_search(q, num_updates, make, apply, check, threads):
+ *   for every query i, the smallest t in [0, num_updates] such that
+ *   check(s, i) holds once updates 0 .. t - 1 are applied to s, or
+ *   num_updates + 1 if it never holds. check must be monotone in t.
+ * - make() returns an empty structure (FenwickTree, LazyRangeSum, ...),
+ *   apply(s, t) applies update t, check(s, i) tests query i. Each round
+ *   buckets the unresolved queries by their midpoint (counting sort) and
+ *   replays the timeline once into one structure, evaluating queries as
+ *   their midpoint is reached.
+ * - threads > 1 (0 = all cores) splits the midpoint-sorted queries into
+ *   contiguous chunks; each thread replays into its own structure up to its
+ *   last midpoint. Replay work grows with the thread count, so this pays
+ *   off when check dominates (e.g. a query touching many positions).
+ *
+ * Time: O(log T * (make + T * apply + q * check)), T = num_updates
+ * Space: O(q + T) plus one structure per thread
+ *
+ * Usage:
+ *  // first time prefix_sum(pos[i]) >= need[i], updates = point adds
+ *  auto ans = parallel_binary_search(q, upd.size(),
+ *      [&]() { return FenwickTree<long long>(n); },
+ *      [&](FenwickTree<long long>& f, int t) { f.add(upd[t].first, upd[t].second); },
+ *      [&](FenwickTree<long long>& f, int i) { return f.prefix_sum(pos[i]) >= need[i]; });
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "misc/parallel.hpp"
+using namespace std;
+
+template <typename Make, typename Apply, typename Check>
+vector<int> parallel_binary_search(int q, int num_updates, Make make, Apply apply, Check check, int threads = 1) {
+    const int T = num_updates;
+    vector<int> lo(q, 0), hi(q, T + 1);   // answer in [lo, hi]
+    vector<int> order(q), start(T + 2);
+    threads = resolve_threads(threads);
+    while (true) {
+        // Counting sort of the unresolved queries by midpoint.
+        fill(start.begin(), start.end(), 0);
+        int active = 0;
+        for (int i = 0; i < q; i++)
+            if (lo[i] < hi[i])
+                start[(lo[i] + hi[i]) / 2 + 1]++, active++;
+        if (active == 0)
+            break;
+        partial_sum(start.begin(), start.end(), start.begin());
+        for (int i = 0; i < q; i++)
+            if (lo[i] < hi[i])
+                order[start[(lo[i] + hi[i]) / 2]++] = i;
+
+        parallel_for(active, min(threads, active), [&](long long b, long long e, int) {
+            auto s = make();
+            int t = 0;
+            for (long long j = b; j < e; j++) {
+                int i = order[j], mid = (lo[i] + hi[i]) / 2;
+                while (t < mid)
+                    apply(s, t++);
+                if (check(s, i))
+                    hi[i] = mid;
+                else
+                    lo[i] = mid + 1;
+            }
+        });
+    }
+    return lo;
+}
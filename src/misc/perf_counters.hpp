@@ -0,0 +1,229 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Hardware performance counters for code scopes (Linux
+ * perf_event_open) and named event counters for data-structure hot paths.
+ *
+ * Features:
+ * - PerfCounters: the calling thread's task clock, cycles, instructions,
+ *   L1d read misses, LLC misses and branch misses. Each event is opened
+ *   on its own, so those the kernel refuses (VMs, perf_event_paranoid > 2)
+ *   are just missing. read() returns running totals, scaled when the
+ *   kernel multiplexed the event.
+ * - PerfScope s("name") / CP_PERF_SCOPE("name"): adds the counts for its
+ *   lifetime to the totals of "name", reported by perf_report(out).
+ * - CP_PERF_COUNT("LazyRangeMax push"): bumps a named event counter, to
+ *   attribute cost to pushes, node visits, allocations, ...
+ *   perf_event_counts() snapshots all of them.
+ * - CP_PERF_SCOPE and CP_PERF_COUNT compile to nothing unless CP_PERF is
+ *   defined (cmake -DCP_PERF=ON). Instrumented headers include only
+ *   misc/perf_hooks.hpp, which pulls in this file under CP_PERF alone. With
+ *   CP_PERF the test and benchmark runners print the counters and event
+ *   deltas of every test / benchmark.
+ *
+ * Requirements: Linux; counts only the calling thread.
+ * Time: a few syscalls per scope; CP_PERF_COUNT is one relaxed atomic add.
+ *
+ * Usage:
+ *  PerfCounters pc;
+ *  PerfSample a = pc.read();
+ *  work();
+ *  cout << perf_format(pc.read() - a, ops) << "\n";
+ *
+ *  void push(int node) { CP_PERF_COUNT("MyTree push"); ... }
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+using namespace std;
+
+enum PerfEvent { PERF_TASK_CLOCK, PERF_CYCLES, PERF_INSTRUCTIONS, PERF_L1D_MISSES, PERF_LLC_MISSES, PERF_BRANCH_MISSES, PERF_EVENTS };
+
+struct PerfSample {
+    array<double, PERF_EVENTS> value{};
+    array<bool, PERF_EVENTS> valid{};
+
+    bool has(PerfEvent e) const { return valid[e]; }
+    double operator[](PerfEvent e) const { return value[e]; }
+
+    PerfSample operator-(const PerfSample& o) const {
+        PerfSample d;
+        for (int e = 0; e < PERF_EVENTS; e++)
+            d.value[e] = value[e] - o.value[e], d.valid[e] = valid[e] && o.valid[e];
+        return d;
+    }
+    PerfSample& operator+=(const PerfSample& o) {
+        for (int e = 0; e < PERF_EVENTS; e++)
+            value[e] += o.value[e], valid[e] = valid[e] || o.valid[e];
+        return *this;
+    }
+};
+
+class PerfCounters {
+public:
+    PerfCounters() {
+        const uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                                       PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+        const pair<uint32_t, uint64_t> events[PERF_EVENTS] = {
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK}, {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS}, {PERF_TYPE_HW_CACHE, l1d_read_miss},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}, {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+        for (int e = 0; e < PERF_EVENTS; e++) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = events[e].first;
+            attr.config = events[e].second;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fd[e] = int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+    }
+    ~PerfCounters() {
+        for (int f : fd)
+            if (f >= 0) close(f);
+    }
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available(PerfEvent e) const { return fd[e] >= 0; }
+
+    PerfSample read() const {
+        PerfSample s;
+        for (int e = 0; e < PERF_EVENTS; e++) {
+            uint64_t buf[3];   // value, time enabled, time running
+            if (fd[e] < 0 || ::read(fd[e], buf, sizeof(buf)) != sizeof(buf)) continue;
+            s.value[e] = buf[2] > 0 && buf[2] < buf[1] ? double(buf[0]) * buf[1] / buf[2] : double(buf[0]);
+            s.valid[e] = true;
+        }
+        return s;
+    }
+
+    // The calling thread's counters, opened on first use.
+    static const PerfCounters& thread_local_instance() {
+        static thread_local PerfCounters counters;
+        return counters;
+    }
+
+private:
+    int fd[PERF_EVENTS];
+};
+
+namespace perf_detail {
+
+struct Registry {
+    mutex m;
+    map<string, pair<PerfSample, long long>> scopes;   // totals and number of scopes
+    map<string, atomic<long long>> events;
+};
+
+inline Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+inline string human(double v) {
+    const char* unit[] = {"", " k", " M", " G", " T"};
+    int k = 0;
+    while (abs(v) >= 1000 && k < 4) v /= 1000, k++;
+    ostringstream os;
+    os << fixed << setprecision(k == 0 && v == llround(v) ? 0 : 2) << v << unit[k];
+    return os.str();
+}
+
+}  // namespace perf_detail
+
+// "cycles 1.20 G, IPC 2.31, L1d miss 3.10 M, ..." for the counters present;
+// with ops > 0 the counts are per operation.
+inline string perf_format(const PerfSample& s, long long ops = 0) {
+    static const char* name[PERF_EVENTS] = {"cpu ns", "cycles", "instr", "L1d miss", "LLC miss", "br miss"};
+    double per = ops > 0 ? double(ops) : 1.0;
+    ostringstream os;
+    for (int e = 0; e < PERF_EVENTS; e++) {
+        if (!s.valid[e]) continue;
+        if (os.tellp() > 0) os << ", ";
+        if (e == PERF_TASK_CLOCK && ops == 0) os << "cpu ms " << fixed << setprecision(1) << s.value[e] / 1e6 << defaultfloat;
+        else os << name[e] << " " << perf_detail::human(s.value[e] / per);
+        if (e == PERF_INSTRUCTIONS && s.has(PERF_CYCLES) && s[PERF_CYCLES] > 0)
+            os << ", IPC " << fixed << setprecision(2) << s[PERF_INSTRUCTIONS] / s[PERF_CYCLES] << defaultfloat;
+    }
+    if (os.tellp() == 0) return "perf counters unavailable";
+    return ops > 0 ? os.str() + " (per op)" : os.str();
+}
+
+inline atomic<long long>& perf_event_counter(const string& name) {
+    auto& r = perf_detail::registry();
+    lock_guard<mutex> lock(r.m);
+    return r.events[name];
+}
+
+inline map<string, long long> perf_event_counts() {
+    auto& r = perf_detail::registry();
+    lock_guard<mutex> lock(r.m);
+    map<string, long long> counts;
+    for (auto& [name, c] : r.events) counts[name] = c.load(memory_order_relaxed);
+    return counts;
+}
+
+// Events that changed between two snapshots, "name delta, ...".
+inline string perf_event_delta(const map<string, long long>& before, const map<string, long long>& after, long long ops = 0) {
+    ostringstream os;
+    for (auto& [name, v] : after) {
+        auto it = before.find(name);
+        long long d = v - (it == before.end() ? 0 : it->second);
+        if (d == 0) continue;
+        if (os.tellp() > 0) os << ", ";
+        os << name << " " << perf_detail::human(ops > 0 ? double(d) / ops : double(d));
+    }
+    return ops > 0 && os.tellp() > 0 ? os.str() + " (per op)" : os.str();
+}
+
+class PerfScope {
+public:
+    explicit PerfScope(string name) : name(std::move(name)), start(PerfCounters::thread_local_instance().read()) {}
+    ~PerfScope() {
+        PerfSample d = PerfCounters::thread_local_instance().read() - start;
+        auto& r = perf_detail::registry();
+        lock_guard<mutex> lock(r.m);
+        auto& [total, calls] = r.scopes[name];
+        total += d;
+        calls++;
+    }
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+private:
+    string name;
+    PerfSample start;
+};
+
+inline void perf_report(ostream& out) {
+    auto& r = perf_detail::registry();
+    lock_guard<mutex> lock(r.m);
+    for (auto& [name, tc] : r.scopes)
+        out << "  " << name << " x" << tc.second << ": " << perf_format(tc.first) << "\n";
+    for (auto& [name, c] : r.events) out << "  " << name << ": " << c.load(memory_order_relaxed) << "\n";
+}
+
+inline void perf_reset() {
+    auto& r = perf_detail::registry();
+    lock_guard<mutex> lock(r.m);
+    r.scopes.clear();
+    for (auto& [name, c] : r.events) c.store(0, memory_order_relaxed);
+}
+
+#define CP_PERF_CONCAT_(a, b) a##b
+#define CP_PERF_CONCAT(a, b) CP_PERF_CONCAT_(a, b)
+
+#ifdef CP_PERF
+#define CP_PERF_SCOPE(name) PerfScope CP_PERF_CONCAT(cp_perf_scope_, __LINE__)(name)
+#define CP_PERF_COUNT(name)                                                      \
+    do {                                                                         \
+        static atomic<long long>& cp_perf_counter_ = perf_event_counter(name); \
+        cp_perf_counter_.fetch_add(1, memory_order_relaxed);                     \
+    } while (0)
+#else
+#include "misc/perf_hooks.hpp"
+#endif
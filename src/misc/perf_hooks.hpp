@@ -0,0 +1,23 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Instrumentation hooks for library hot paths.
+ *
+ * Features:
+ * - CP_PERF_COUNT("name") / CP_PERF_SCOPE("name"): see misc/perf_counters.hpp.
+ * - Without CP_PERF they expand to nothing and this header includes nothing,
+ *   so instrumented structures still build anywhere (non-Linux judges
+ *   included); with CP_PERF it pulls in misc/perf_counters.hpp.
+ *
+ * Usage:
+ *  #include "misc/perf_hooks.hpp"
+ *  void push(int node) { CP_PERF_COUNT("MyTree push"); ... }
+ */
+
+#pragma once
+
+#ifdef CP_PERF
+#include "misc/perf_counters.hpp"
+#else
+#define CP_PERF_SCOPE(name) ((void)0)
+#define CP_PERF_COUNT(name) ((void)0)
+#endif
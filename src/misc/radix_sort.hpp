@@ -0,0 +1,99 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Stable LSD radix sort with an optional multi-threaded mode.
+ *
+ * Features:
+ * - radix_sort(a, key, threads): sorts `a` by the unsigned integer returned by
+ *   key(x), 8 bits per pass. Passes whose digit is the same for every key are
+ *   skipped, so small key ranges cost fewer passes.
+ * - Parallel mode: every thread histograms and scatters its own contiguous
+ *   chunk; offsets are laid out thread-by-thread, so the sort stays stable.
+ * - radix_key(x): order-preserving map of integers/floating point to unsigned.
+ *
+ * Time: O((n + 256 * threads) * passes)
+ * Space: O(n) extra
+ *
+ * Usage:
+ *  vector<pair<int, int>> v = ...;
+ *  radix_sort(v, [](const pair<int, int>& p) { return radix_key(p.first); });
+ *  radix_sort(keys, [](uint64_t x) { return x; }, 0);   // 0 = all cores
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "misc/parallel.hpp"
+using namespace std;
+
+template <typename T>
+constexpr auto radix_key(T x) {
+    if constexpr (is_floating_point_v<T>) {
+        using U = conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        U bits = bit_cast<U>(x);
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        return (bits & sign) ? U(~bits) : U(bits | sign);
+    } else if constexpr (is_signed_v<T>) {
+        using U = make_unsigned_t<T>;
+        return U(U(x) ^ (U(1) << (sizeof(U) * 8 - 1)));
+    } else {
+        return x;
+    }
+}
+
+template <typename T, typename KeyF>
+void radix_sort(vector<T>& a, KeyF key, int threads = 1) {
+    using K = decltype(key(a[0]));
+    static_assert(is_unsigned_v<K>, "radix key must be an unsigned integer");
+    long long n = a.size();
+    if (n <= 1)
+        return;
+    threads = resolve_threads(threads);
+    if (n < (1 << 16))
+        threads = 1;
+
+    // Bits that differ between keys; digits outside them need no pass.
+    vector<K> ors(threads, 0), ands(threads, K(~K(0)));
+    parallel_for(n, threads, [&](long long b, long long e, int t) {
+        K o = 0, d = K(~K(0));
+        for (long long i = b; i < e; i++) {
+            K k = key(a[i]);
+            o |= k;
+            d &= k;
+        }
+        ors[t] = o;
+        ands[t] = d;
+    });
+    K diff = 0;
+    {
+        K o = 0, d = K(~K(0));
+        for (int t = 0; t < threads; t++)
+            o |= ors[t], d &= ands[t];
+        diff = o ^ d;
+    }
+
+    vector<T> buf(n);
+    vector<array<long long, 256>> cnt(threads);
+    for (int shift = 0; shift < int(sizeof(K) * 8); shift += 8) {
+        if (((diff >> shift) & 0xFF) == 0)
+            continue;
+        parallel_for(n, threads, [&](long long b, long long e, int t) {
+            auto& c = cnt[t];
+            c.fill(0);
+            for (long long i = b; i < e; i++)
+                c[(key(a[i]) >> shift) & 0xFF]++;
+        });
+        long long sum = 0;
+        for (int d = 0; d < 256; d++) {
+            for (int t = 0; t < threads; t++) {
+                long long c = cnt[t][d];
+                cnt[t][d] = sum;
+                sum += c;
+            }
+        }
+        parallel_for(n, threads, [&](long long b, long long e, int t) {
+            auto& c = cnt[t];
+            for (long long i = b; i < e; i++)
+                buf[c[(key(a[i]) >> shift) & 0xFF]++] = std::move(a[i]);
+        });
+        a.swap(buf);
+    }
+}
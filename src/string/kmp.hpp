@@ -0,0 +1,320 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Streaming single-pattern (KMP) and multi-pattern (Aho-Corasick) matching.
+ *
+ * Features:
+ * - prefix_function(s): pi[i] = length of the longest proper border of s[0, i].
+ * - KMP(pattern): feed(chunk, f) consumes the stream chunk by chunk. The matched
+ *   prefix length and the stream offset carry over, so occurrences spanning a
+ *   chunk boundary are found. While nothing is matched, memchr skips ahead to
+ *   the next occurrence of the first pattern byte.
+ * - AhoCorasick(patterns): complete DFA in one dense table. Bytes are mapped to
+ *   classes (bytes absent from every pattern share class 0), so a row is only
+ *   as wide as the pattern alphabet. Entries are premultiplied row offsets,
+ *   negated for states that end a pattern, so a step is one dependent load.
+ *   Large chunks are scanned as four interleaved lanes (each quarter warmed up
+ *   from max_len bytes before it) to overlap the load latencies.
+ *   stream() returns a cursor with its own state, so one automaton can serve
+ *   many streams / threads.
+ * - Callbacks: KMP f(start), AhoCorasick f(pattern_id, start), with start the
+ *   offset of the occurrence from the beginning of the stream, in increasing
+ *   order of the occurrence end.
+ * - MappedFile(path): read-only mmap of a file as a string_view (no copy);
+ *   read_chunks(file, size, f): fread into one reused buffer for pipes.
+ *
+ * Requirements:
+ * - Non-empty patterns. Equal patterns are all reported.
+ * - AhoCorasick memory: 4 * states * classes bytes, classes = distinct pattern
+ *   bytes + 1; states * classes < 2^31.
+ *
+ * Time: prefix_function O(m), KMP feed O(chunk), AhoCorasick build
+ *       O(total length * classes), feed O(chunk + matches)
+ * Space: O(m) for KMP, O(states * classes) for AhoCorasick
+ *
+ * Usage:
+ *  KMP kmp("needle");
+ *  kmp.feed("hay nee", [&](uint64_t pos) { ... });
+ *  kmp.feed("dle hay", [&](uint64_t pos) { ... });     // pos == 4
+ *  AhoCorasick ac({"he", "she", "hers"});
+ *  auto st = ac.stream();
+ *  MappedFile file("app.log");
+ *  st.feed(file.view(), [&](int id, uint64_t pos) { ... });
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CP_KMP_MMAP 1
+#endif
+using namespace std;
+
+inline vector<int> prefix_function(string_view s) {
+    int n = s.size();
+    vector<int> pi(n);
+    for (int i = 1; i < n; i++) {
+        int k = pi[i - 1];
+        while (k > 0 && s[i] != s[k])
+            k = pi[k - 1];
+        pi[i] = k + (s[i] == s[k]);
+    }
+    return pi;
+}
+
+struct KMP {
+    string pattern;
+    vector<int> pi;
+    int matched = 0;       // length of the pattern prefix ending at the stream end
+    uint64_t offset = 0;   // bytes consumed so far
+
+    KMP(string p) : pattern(std::move(p)), pi(prefix_function(pattern)) { assert(!pattern.empty()); }
+
+    void reset() { matched = 0, offset = 0; }
+
+    template <typename F>
+    void feed(string_view chunk, F&& f) {
+        const char* p = pattern.data();
+        const int m = pattern.size();
+        const char* s = chunk.data();
+        const size_t n = chunk.size();
+        int k = matched;
+        for (size_t i = 0; i < n; i++) {
+            if (k == 0) {
+                const void* hit = memchr(s + i, p[0], n - i);
+                if (!hit)
+                    break;
+                i = static_cast<const char*>(hit) - s;
+            }
+            while (k > 0 && p[k] != s[i])
+                k = pi[k - 1];
+            if (p[k] == s[i])
+                k++;
+            if (k == m) {
+                f(offset + i + 1 - m);
+                k = pi[m - 1];
+            }
+        }
+        matched = k;
+        offset += n;
+    }
+
+    // All occurrences in a single string.
+    static vector<uint64_t> find_all(string_view text, string pattern) {
+        vector<uint64_t> res;
+        KMP kmp(std::move(pattern));
+        kmp.feed(text, [&](uint64_t pos) { res.push_back(pos); });
+        return res;
+    }
+};
+
+struct AhoCorasick {
+    int classes = 1, states = 0, max_len = 0;
+    array<uint16_t, 256> cls{};
+    vector<int> go;                // go[row + c]: next row (state * classes), ~row if it ends a pattern
+    vector<int> out, dict;         // first pattern ending at a state; nearest proper suffix state with output
+    vector<int> next_same, len;    // per pattern: next pattern with the same string, length
+
+    AhoCorasick(const vector<string>& patterns) : next_same(patterns.size(), -1), len(patterns.size()) {
+        for (const string& p : patterns)
+            for (unsigned char c : p)
+                if (cls[c] == 0)
+                    cls[c] = classes++;
+        new_state();
+        for (int id = 0; id < int(patterns.size()); id++) {
+            assert(!patterns[id].empty());
+            len[id] = patterns[id].size();
+            max_len = max(max_len, len[id]);
+            int u = 0;
+            for (unsigned char c : patterns[id]) {
+                int v = go[size_t(u) * classes + cls[c]];
+                if (v < 0) {
+                    v = new_state();   // reallocates go: index it again
+                    go[size_t(u) * classes + cls[c]] = v;
+                }
+                u = v;
+            }
+            next_same[id] = out[u];
+            out[u] = id;
+        }
+        build();
+    }
+
+    struct Stream {
+        const AhoCorasick* ac;
+        int row = 0;
+        uint64_t offset = 0;
+
+        static const int LANES = 4;
+        vector<pair<int, size_t>> pending[LANES];   // hits of lanes 1.., reported after lane 0
+
+        template <typename F>
+        void feed(string_view chunk, F&& f) {
+            const int* go = ac->go.data();
+            const uint16_t* cls = ac->cls.data();
+            const unsigned char* s = reinterpret_cast<const unsigned char*>(chunk.data());
+            const size_t n = chunk.size(), warm = ac->max_len;
+            if (n < LANES * (warm + 4096)) {
+                int r = row;
+                for (size_t i = 0; i < n; i++) {
+                    r = go[r + cls[s[i]]];
+                    if (r < 0) {
+                        r = ~r;
+                        ac->report(r / ac->classes, offset + i + 1, f);
+                    }
+                }
+                row = r;
+                offset += n;
+                return;
+            }
+            // Four independent lanes over consecutive quarters hide the latency of the
+            // table loads. Lane k > 0 starts max_len bytes early from the root: the state
+            // only depends on the last max_len bytes, so it is exact from its first byte on.
+            const size_t len = n / LANES;
+            auto warm_up = [&](size_t at) {
+                int r = 0;
+                for (size_t i = at - min(at, warm); i < at; i++) {
+                    r = go[r + cls[s[i]]];
+                    r = r < 0 ? ~r : r;
+                }
+                return r;
+            };
+            for (auto& p : pending)
+                p.clear();
+            // lane k hit the end of a pattern at byte j (its row is ~r)
+            auto hit = [&](int& r, int k, size_t j) {
+                r = ~r;
+                if (k == 0)
+                    ac->report(r / ac->classes, offset + j + 1, f);
+                else
+                    pending[k].push_back({r, j + 1});
+            };
+            int r0 = row, r1 = warm_up(len), r2 = warm_up(2 * len), r3 = warm_up(3 * len);
+            for (size_t i = 0; i < len; i++) {
+                r0 = go[r0 + cls[s[i]]];
+                r1 = go[r1 + cls[s[len + i]]];
+                r2 = go[r2 + cls[s[2 * len + i]]];
+                r3 = go[r3 + cls[s[3 * len + i]]];
+                if ((r0 | r1 | r2 | r3) < 0) {
+                    if (r0 < 0)
+                        hit(r0, 0, i);
+                    if (r1 < 0)
+                        hit(r1, 1, len + i);
+                    if (r2 < 0)
+                        hit(r2, 2, 2 * len + i);
+                    if (r3 < 0)
+                        hit(r3, 3, 3 * len + i);
+                }
+            }
+            for (size_t j = LANES * len; j < n; j++) {
+                r3 = go[r3 + cls[s[j]]];
+                if (r3 < 0)
+                    hit(r3, 3, j);
+            }
+            for (int k = 1; k < LANES; k++)
+                for (auto [u, end] : pending[k])
+                    ac->report(u / ac->classes, offset + end, f);
+            row = r3;
+            offset += n;
+        }
+        void reset() { row = 0, offset = 0; }
+    };
+
+    Stream stream() const { return Stream{this, 0, 0, {}}; }
+
+    // (pattern id, start) of all occurrences in a single string.
+    vector<pair<int, uint64_t>> find_all(string_view text) const {
+        vector<pair<int, uint64_t>> res;
+        stream().feed(text, [&](int id, uint64_t pos) { res.push_back({id, pos}); });
+        return res;
+    }
+
+    // Reports every pattern ending at `end` whose automaton state is u.
+    template <typename F>
+    void report(int u, uint64_t end, F& f) const {
+        for (int v = out[u] >= 0 ? u : dict[u]; v >= 0; v = dict[v])
+            for (int id = out[v]; id >= 0; id = next_same[id])
+                f(id, end - len[id]);
+    }
+
+private:
+    int new_state() {
+        go.resize(go.size() + classes, -1);
+        out.push_back(-1);
+        dict.push_back(-1);
+        return states++;
+    }
+
+    // BFS over the trie: fill missing transitions from the failure state, then
+    // turn state ids into premultiplied (and output-tagged) row offsets.
+    void build() {
+        vector<int> fail(states, 0), order;
+        order.reserve(states);
+        for (int c = 0; c < classes; c++) {
+            int& g = go[c];
+            if (g < 0)
+                g = 0;
+            else
+                order.push_back(g);
+        }
+        for (size_t h = 0; h < order.size(); h++) {
+            int u = order[h];
+            for (int c = 0; c < classes; c++) {
+                int& g = go[size_t(u) * classes + c];
+                int via_fail = go[size_t(fail[u]) * classes + c];
+                if (g < 0) {
+                    g = via_fail;
+                } else {
+                    fail[g] = via_fail;
+                    order.push_back(g);
+                }
+            }
+            dict[u] = out[fail[u]] >= 0 ? fail[u] : dict[fail[u]];
+        }
+        for (int& g : go)
+            g = out[g] >= 0 || dict[g] >= 0 ? ~(g * classes) : g * classes;
+    }
+};
+
+#ifdef CP_KMP_MMAP
+// Read-only mapping of a whole file; view() is empty if the file could not be mapped.
+struct MappedFile {
+    const char* data = nullptr;
+    size_t size = 0;
+
+    explicit MappedFile(const string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                madvise(p, st.st_size, MADV_SEQUENTIAL);
+                data = static_cast<const char*>(p);
+                size = st.st_size;
+            }
+        }
+        close(fd);
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() {
+        if (data)
+            munmap(const_cast<char*>(data), size);
+    }
+
+    string_view view() const { return {data, size}; }
+};
+#endif
+
+// Calls f(chunk) for consecutive chunks of up to `chunk_size` bytes read from in.
+template <typename F>
+void read_chunks(FILE* in, size_t chunk_size, F&& f) {
+    vector<char> buf(chunk_size);
+    size_t got;
+    while ((got = fread(buf.data(), 1, chunk_size, in)) > 0)
+        f(string_view(buf.data(), got));
+}
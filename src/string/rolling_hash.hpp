@@ -0,0 +1,215 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Polynomial hashing modulo 2^61 - 1 for strings and grids.
+ *
+ * Features:
+ * - Arithmetic mod 2^61 - 1 through one __int128 product and a shift/mask fold,
+ *   no division.
+ * - HashBase<Id>: base drawn at startup from random_device and the clock (so
+ *   precomputed anti-hash tests cannot target it), with a power table shared by
+ *   every hash of the same Id that grows on demand. Id 1 is the row base of
+ *   the 2-D hash.
+ * - RollingHash(s): prefix hashes; get(l, r) is the hash of s[l, r) in O(1).
+ *   lcp(a, i, b, j): longest common prefix of a[i..] and b[j..] by binary search.
+ * - RollingHash2D(grid): get(r1, c1, r2, c2) hashes the block [r1, r2) x [c1, c2).
+ * - window_hashes(s, k): hashes of all n - k + 1 windows of length k. The
+ *   rolling update is split into four interleaved lanes (each started with a
+ *   direct hash of its first window), so the multiplications of different lanes
+ *   overlap instead of forming one dependency chain.
+ *
+ * Requirements:
+ * - Equal hashes mean equal strings with probability about 1 - n / 2^61 per
+ *   comparison of length-n strings.
+ * - Not thread-safe while the power tables grow: call HashBase<>::reserve(n)
+ *   before sharing.
+ *
+ * Time: build O(n), get O(1), lcp O(log n), window_hashes O(n)
+ * Space: O(n) (O(n m) for grids)
+ *
+ * Usage:
+ *  RollingHash h("abracadabra");
+ *  h.get(0, 4) == h.get(7, 11);                    // "abra" == "abra"
+ *  lcp(h, 0, h, 7);                                // 4
+ *  auto w = window_hashes("abcabc", 3);            // w[0] == w[3]
+ *  RollingHash2D g({"ab", "ab"});
+ *  g.get(0, 0, 1, 2) == g.get(1, 0, 2, 2);         // same row
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+namespace rolling_hash_detail {
+
+constexpr uint64_t MOD = (1ULL << 61) - 1;
+
+// x < 2^64 -> x mod 2^61 - 1
+inline uint64_t fold(uint64_t x) {
+    x = (x & MOD) + (x >> 61);
+    return x >= MOD ? x - MOD : x;
+}
+
+inline uint64_t mul(uint64_t a, uint64_t b) {
+    unsigned __int128 t = (unsigned __int128)a * b;
+    return fold((uint64_t(t) & MOD) + uint64_t(t >> 61));
+}
+
+inline uint64_t add(uint64_t a, uint64_t b) {
+    a += b;
+    return a >= MOD ? a - MOD : a;
+}
+
+inline uint64_t sub(uint64_t a, uint64_t b) { return a >= b ? a - b : a + MOD - b; }
+
+inline uint64_t random_base(int id) {
+    random_device rd;
+    mt19937_64 rng((uint64_t(rd()) << 32) ^ rd() ^
+                   uint64_t(chrono::steady_clock::now().time_since_epoch().count()) ^ uint64_t(id) * 0x9e3779b97f4a7c15ULL);
+    return uniform_int_distribution<uint64_t>(1 << 20, MOD - (1 << 20))(rng);
+}
+
+}  // namespace rolling_hash_detail
+
+template <int Id = 0>
+struct HashBase {
+    static inline const uint64_t base = rolling_hash_detail::random_base(Id);
+    static inline vector<uint64_t> pw{1};
+
+    // Ensures pw covers [0, n].
+    static void reserve(size_t n) {
+        size_t old = pw.size();
+        if (n < old)
+            return;
+        pw.resize(max(n + 1, 2 * old));
+        for (size_t i = old; i < pw.size(); i++)
+            pw[i] = rolling_hash_detail::mul(pw[i - 1], base);
+    }
+    static uint64_t power(size_t k) {
+        reserve(k);
+        return pw[k];
+    }
+};
+
+struct RollingHash {
+    using B = HashBase<0>;
+    vector<uint64_t> pre;   // pre[i]: hash of s[0, i)
+
+    RollingHash(string_view s) : pre(s.size() + 1) {
+        B::reserve(s.size());
+        for (size_t i = 0; i < s.size(); i++)
+            pre[i + 1] = rolling_hash_detail::add(rolling_hash_detail::mul(pre[i], B::base), (unsigned char)s[i] + 1);
+    }
+    // Values must lie in [0, 2^61 - 2).
+    template <typename T>
+    RollingHash(const vector<T>& s) : pre(s.size() + 1) {
+        B::reserve(s.size());
+        for (size_t i = 0; i < s.size(); i++)
+            pre[i + 1] = rolling_hash_detail::add(rolling_hash_detail::mul(pre[i], B::base), uint64_t(s[i]) + 1);
+    }
+
+    size_t size() const { return pre.size() - 1; }
+
+    // Hash of s[l, r).
+    uint64_t get(size_t l, size_t r) const {
+        return rolling_hash_detail::sub(pre[r], rolling_hash_detail::mul(pre[l], B::pw[r - l]));
+    }
+
+    // Hash of the concatenation of strings with hashes h1 and h2, |second| = len2.
+    static uint64_t concat(uint64_t h1, uint64_t h2, size_t len2) {
+        return rolling_hash_detail::add(rolling_hash_detail::mul(h1, B::power(len2)), h2);
+    }
+};
+
+// Longest common prefix of a[i..] and b[j..].
+inline size_t lcp(const RollingHash& a, size_t i, const RollingHash& b, size_t j) {
+    size_t lo = 0, hi = min(a.size() - i, b.size() - j);
+    while (lo < hi) {
+        size_t mid = (lo + hi + 1) / 2;
+        if (a.get(i, i + mid) == b.get(j, j + mid))
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Hashes of s[i, i + k) for i = 0..n-k; same values as RollingHash(s).get(i, i + k).
+inline vector<uint64_t> window_hashes(string_view s, size_t k) {
+    using namespace rolling_hash_detail;
+    using B = HashBase<0>;
+    assert(k >= 1);
+    if (s.size() < k)
+        return {};
+    const size_t cnt = s.size() - k + 1;
+    const uint64_t base = B::base, bk = MOD - B::power(k);   // -B^k
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+    vector<uint64_t> res(cnt);
+    auto direct = [&](size_t i) {
+        uint64_t h = 0;
+        for (size_t t = 0; t < k; t++)
+            h = add(mul(h, base), p[i + t] + 1);
+        return h;
+    };
+    // h(i + 1) = h(i) * B - (s[i] + 1) B^k + s[i + k] + 1; the product by B^k does
+    // not depend on h, so only one multiplication is on the chain of each lane
+    auto step = [&](uint64_t h, size_t i) {
+        unsigned __int128 t = (unsigned __int128)h * base + (unsigned __int128)bk * (p[i] + 1);
+        return fold(fold((uint64_t(t) & MOD) + uint64_t(t >> 61)) + p[i + k] + 1);
+    };
+    const size_t len = cnt / 4;
+    if (len < 4 * k + 64) {
+        uint64_t h = direct(0);
+        res[0] = h;
+        for (size_t i = 0; i + 1 < cnt; i++)
+            res[i + 1] = h = step(h, i);
+        return res;
+    }
+    uint64_t h0 = direct(0), h1 = direct(len), h2 = direct(2 * len), h3 = direct(3 * len);
+    for (size_t i = 0; i < len; i++) {
+        res[i] = h0, res[len + i] = h1, res[2 * len + i] = h2, res[3 * len + i] = h3;
+        h0 = step(h0, i);
+        h1 = step(h1, len + i);
+        h2 = step(h2, 2 * len + i);
+        h3 = step(h3, 3 * len + i);
+    }
+    for (size_t i = 4 * len; i < cnt; i++) {
+        res[i] = h3;
+        if (i + 1 < cnt)
+            h3 = step(h3, i);
+    }
+    return res;
+}
+
+struct RollingHash2D {
+    using BC = HashBase<0>;   // along a row
+    using BR = HashBase<1>;   // across rows
+    int n = 0, m = 0;
+    vector<uint64_t> pre;     // pre[i * (m + 1) + j]: hash of the block [0, i) x [0, j)
+
+    RollingHash2D(const vector<string>& g) : n(g.size()), m(g.empty() ? 0 : g[0].size()) {
+        using namespace rolling_hash_detail;
+        BC::reserve(m);
+        BR::reserve(n);
+        pre.assign(size_t(n + 1) * (m + 1), 0);
+        vector<uint64_t> row(m + 1);
+        for (int i = 0; i < n; i++) {
+            assert(int(g[i].size()) == m);
+            for (int j = 0; j < m; j++)
+                row[j + 1] = add(mul(row[j], BC::base), (unsigned char)g[i][j] + 1);
+            uint64_t* cur = &pre[size_t(i + 1) * (m + 1)];
+            const uint64_t* prv = cur - (m + 1);
+            for (int j = 0; j <= m; j++)
+                cur[j] = add(mul(prv[j], BR::base), row[j]);
+        }
+    }
+
+    // Hash of the block of rows [r1, r2) and columns [c1, c2).
+    uint64_t get(int r1, int c1, int r2, int c2) const {
+        using namespace rolling_hash_detail;
+        auto at = [&](int i, int j) { return pre[size_t(i) * (m + 1) + j]; };
+        uint64_t pr = BR::pw[r2 - r1], pc = BC::pw[c2 - c1];
+        uint64_t top = sub(at(r2, c2), mul(at(r1, c2), pr));
+        uint64_t left = sub(at(r2, c1), mul(at(r1, c1), pr));
+        return sub(top, mul(left, pc));
+    }
+};
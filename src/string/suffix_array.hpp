@@ -0,0 +1,247 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Suffix array by SA-IS, LCP array by Kasai, LCP queries and pattern search.
+ *
+ * Features:
+ * - suffix_array(s): SA-IS in O(n + alphabet). All indices are 32-bit. The
+ *   recursion keeps its reduced string, names and reduced suffix array inside
+ *   the output array itself, so the only extra memory is the L/S type bits
+ *   (n / 8 bytes) and the bucket counters of each level.
+ * - suffix_array_into(s, sa): same, writing into an existing vector to reuse
+ *   its capacity across texts.
+ * - lcp_array(s, sa): Kasai, lcp[i] = LCP(suffix sa[i], suffix sa[i + 1]).
+ * - SuffixArray(text): sa, lcp and, unless built in low-memory mode, the rank
+ *   array plus an RMQ (sparse_table.hpp) over lcp, so lcp_query(i, j) between
+ *   any two suffixes is O(1). The RMQ takes O(n log n) ints; for texts of 10^8
+ *   bytes use low_memory = true (sa + lcp only, 8 bytes per character).
+ * - find(p) / count(p) / occurrences(p): binary search on the suffix array.
+ *
+ * Requirements:
+ * - suffix_array(vector<int>, upper): values in [0, upper].
+ * - n < 2^31.
+ *
+ * Time: build O(n), lcp O(n), RMQ O(n log n); lcp_query O(1); find O(|p| log n)
+ * Space: O(n) (O(n log n) with LCP queries)
+ *
+ * Usage:
+ *  auto sa = suffix_array(string("banana"));      // {5, 3, 1, 0, 4, 2}
+ *  SuffixArray st("banana");
+ *  st.lcp_query(1, 3);                             // 3 ("ana")
+ *  st.count("an");                                 // 2
+ *  SuffixArray big(std::move(blob), true);         // no rank / RMQ
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#include "data-structures/sparse_table.hpp"
+using namespace std;
+
+namespace suffix_array_detail {
+
+template <typename Char>
+void sa_naive(const Char* s, int n, int* sa) {
+    iota(sa, sa + n, 0);
+    sort(sa, sa + n, [&](int a, int b) { return lexicographical_compare(s + a, s + n, s + b, s + n); });
+}
+
+// Writes the suffix array of s[0, n) (values in [0, upper]) to sa[0, n).
+// sa doubles as the workspace of the recursion: the reduced string lives in
+// sa[n - m, n), names in sa[m, n) and the reduced suffix array in sa[0, m).
+template <typename Char>
+void sa_is(const Char* s, int n, int upper, int* sa) {
+    if (n <= 12) {
+        sa_naive(s, n, sa);
+        return;
+    }
+    // ls[i]: suffix i is S-type (smaller than suffix i + 1); suffix n - 1 is L-type
+    vector<bool> ls(n);
+    for (int i = n - 2; i >= 0; i--)
+        ls[i] = s[i] == s[i + 1] ? ls[i + 1] : s[i] < s[i + 1];
+    auto is_lms = [&](int i) { return i > 0 && ls[i] && !ls[i - 1]; };
+
+    vector<int> start(upper + 2), b(upper + 2);
+    for (int i = 0; i < n; i++)
+        start[int(s[i]) + 1]++;
+    for (int c = 0; c <= upper; c++)
+        start[c + 1] += start[c];
+    auto bucket_ends = [&]() { copy(start.begin() + 1, start.end(), b.begin()); };
+
+    // sa holds LMS suffixes at the ends of their buckets and -1 elsewhere
+    auto induce = [&]() {
+        copy(start.begin(), start.end(), b.begin());
+        sa[b[s[n - 1]]++] = n - 1;
+        for (int i = 0; i < n; i++) {
+            int v = sa[i] - 1;
+            if (v >= 0 && !ls[v])
+                sa[b[s[v]]++] = v;
+        }
+        bucket_ends();
+        for (int i = n - 1; i >= 0; i--) {
+            int v = sa[i] - 1;
+            if (v >= 0 && ls[v])
+                sa[--b[s[v]]] = v;
+        }
+    };
+
+    fill(sa, sa + n, -1);
+    bucket_ends();
+    int m = 0;
+    for (int i = 1; i < n; i++)
+        if (is_lms(i))
+            sa[--b[s[i]]] = i, m++;
+    induce();
+    if (m == 0)
+        return;
+
+    // sorted LMS substrings to sa[0, m), then name them; LMS positions are at
+    // least 2 apart, so names fit in sa[m + pos / 2]
+    int k = 0;
+    for (int i = 0; i < n; i++)
+        if (is_lms(sa[i]))
+            sa[k++] = sa[i];
+    fill(sa + m, sa + n, -1);
+    auto lms_end = [&](int p) {
+        int q = p + 1;
+        while (q < n && !is_lms(q))
+            q++;
+        return q;
+    };
+    int name = -1, prev = -1, prev_end = -1;
+    for (int i = 0; i < m; i++) {
+        int cur = sa[i], cur_end = lms_end(cur);
+        bool same = prev >= 0 && cur_end - cur == prev_end - prev && cur_end < n && prev_end < n &&
+                    equal(s + cur, s + cur_end + 1, s + prev);
+        if (!same)
+            name++;
+        sa[m + cur / 2] = name;
+        prev = cur, prev_end = cur_end;
+    }
+    int* rec = sa + n - m;
+    for (int i = n - 1, w = n; i >= m; i--)
+        if (sa[i] >= 0)
+            sa[--w] = sa[i];
+
+    if (name + 1 < m) {
+        sa_is(rec, m, name, sa);
+    } else {
+        for (int i = 0; i < m; i++)
+            sa[rec[i]] = i;
+    }
+
+    // reduced suffix array -> LMS positions, then induce from them in order
+    for (int i = 1, j = 0; i < n; i++)
+        if (is_lms(i))
+            rec[j++] = i;
+    for (int i = 0; i < m; i++)
+        sa[i] = rec[sa[i]];
+    fill(sa + m, sa + n, -1);
+    bucket_ends();
+    for (int i = m - 1; i >= 0; i--) {
+        int j = sa[i];
+        sa[i] = -1;
+        sa[--b[s[j]]] = j;
+    }
+    induce();
+}
+
+struct Min {
+    int operator()(int a, int b) const { return min(a, b); }
+};
+
+}  // namespace suffix_array_detail
+
+inline void suffix_array_into(const string& s, vector<int>& sa) {
+    assert(s.size() < (1u << 31));
+    sa.resize(s.size());
+    suffix_array_detail::sa_is(reinterpret_cast<const unsigned char*>(s.data()), int(s.size()), 255, sa.data());
+}
+
+inline vector<int> suffix_array(const string& s) {
+    vector<int> sa;
+    suffix_array_into(s, sa);
+    return sa;
+}
+
+inline vector<int> suffix_array(const vector<int>& s, int upper) {
+    vector<int> sa(s.size());
+    suffix_array_detail::sa_is(s.data(), int(s.size()), upper, sa.data());
+    return sa;
+}
+
+// Kasai; rank is a scratch buffer (resized to n) that ends up as the inverse of sa.
+template <typename S>
+vector<int> lcp_array(const S& s, const vector<int>& sa, vector<int>& rank) {
+    int n = sa.size();
+    rank.resize(n);
+    for (int i = 0; i < n; i++)
+        rank[sa[i]] = i;
+    vector<int> lcp(max(n - 1, 0));
+    for (int i = 0, h = 0; i < n; i++) {
+        if (h > 0)
+            h--;
+        if (rank[i] == n - 1) {
+            h = 0;
+            continue;
+        }
+        int j = sa[rank[i] + 1];
+        while (i + h < n && j + h < n && s[i + h] == s[j + h])
+            h++;
+        lcp[rank[i]] = h;
+    }
+    return lcp;
+}
+
+template <typename S>
+vector<int> lcp_array(const S& s, const vector<int>& sa) {
+    vector<int> rank;
+    return lcp_array(s, sa, rank);
+}
+
+struct SuffixArray {
+    string s;
+    vector<int> sa, rank, lcp;   // rank is empty in low-memory mode
+    optional<RMQ<int, suffix_array_detail::Min>> rmq;
+
+    SuffixArray(string text, bool low_memory = false) : s(std::move(text)) {
+        suffix_array_into(s, sa);
+        lcp = lcp_array(s, sa, rank);
+        if (low_memory) {
+            vector<int>().swap(rank);
+            return;
+        }
+        if (!lcp.empty())
+            rmq.emplace(lcp, suffix_array_detail::Min());
+    }
+
+    int size() const { return s.size(); }
+
+    // Longest common prefix of the suffixes starting at i and j.
+    int lcp_query(int i, int j) {
+        assert(!rank.empty() || s.empty());
+        if (i == j)
+            return size() - i;
+        int ri = rank[i], rj = rank[j];
+        if (ri > rj)
+            swap(ri, rj);
+        return rmq->get(ri, rj - 1);
+    }
+
+    // [lo, hi) range of sa whose suffixes start with p.
+    pair<int, int> find(string_view p) const {
+        string_view t(s);
+        auto lo = partition_point(sa.begin(), sa.end(), [&](int i) { return t.substr(i, p.size()) < p; });
+        auto hi = partition_point(lo, sa.end(), [&](int i) { return t.substr(i, p.size()) == p; });
+        return {int(lo - sa.begin()), int(hi - sa.begin())};
+    }
+    int count(string_view p) const {
+        auto [lo, hi] = find(p);
+        return hi - lo;
+    }
+    // Starting positions of p in increasing order.
+    vector<int> occurrences(string_view p) const {
+        auto [lo, hi] = find(p);
+        vector<int> res(sa.begin() + lo, sa.begin() + hi);
+        sort(res.begin(), res.end());
+        return res;
+    }
+};
@@ -0,0 +1,151 @@
+/**
+ * Author: ArminHamedAzimi
+ * Description: Z-function with vectorized match extension, and pattern matching without concatenation.
+ *
+ * Features:
+ * - z_function<I>(s): z[i] = LCP(s, s[i..]), z[0] = n. I is the index type of
+ *   the result: int (default) or int64_t for strings of 2^31 bytes or more; the
+ *   algorithm itself always works with size_t positions.
+ * - Match extension compares 8 bytes at once first (most extensions stop
+ *   there), then 32 bytes per step with AVX2 (checked at runtime) or 8 without.
+ *   This pays off when extensions are long, e.g. periodic inputs with defects.
+ * - prefix_match_lengths<I>(p, t): ext[i] = LCP(p, t[i..]), i.e. the Z values
+ *   of p + sep + t past the separator, computed from z_function(p) alone.
+ * - z_search(p, t, f): f(i) for every occurrence of p in t; z_find_all(p, t).
+ *
+ * Time: O(n) (O(|p| + |t|) for matching)
+ * Space: O(n)
+ *
+ * Usage:
+ *  auto z = z_function("aabxaab");                     // {7, 1, 0, 0, 3, 1, 0}
+ *  auto big = z_function<int64_t>(huge_view);
+ *  auto ext = prefix_match_lengths("aab", "xaabaa");   // {0, 3, 1, 0, 2, 1}
+ *  auto pos = z_find_all("aa", "aaaa");                // {0, 1, 2}
+ */
+
+#pragma once
+#include <bits/stdc++.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CP_Z_X86 1
+#endif
+using namespace std;
+
+namespace z_detail {
+
+// Length of the common prefix of a[0, len) and b[0, len).
+inline size_t common_prefix_scalar(const char* a, const char* b, size_t len) {
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t x, y;
+        memcpy(&x, a + i, 8);
+        memcpy(&y, b + i, 8);
+        if (x != y)
+            return i + (__builtin_ctzll(x ^ y) >> 3);   // little endian
+    }
+    while (i < len && a[i] == b[i])
+        i++;
+    return i;
+}
+
+#ifdef CP_Z_X86
+__attribute__((target("avx2"))) inline size_t common_prefix_avx2(const char* a, const char* b, size_t len) {
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        uint32_t eq = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+        if (eq != ~0u)
+            return i + __builtin_ctz(~eq);
+    }
+    return i + common_prefix_scalar(a + i, b + i, len - i);
+}
+
+inline const bool z_use_avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+inline size_t common_prefix(const char* a, const char* b, size_t len) {
+    // most extensions stop within a few bytes: one word compare before dispatching
+    if (len >= 8) {
+        uint64_t x, y;
+        memcpy(&x, a, 8);
+        memcpy(&y, b, 8);
+        if (x != y)
+            return __builtin_ctzll(x ^ y) >> 3;
+    }
+#ifdef CP_Z_X86
+    if (z_use_avx2)
+        return common_prefix_avx2(a, b, len);
+#endif
+    return common_prefix_scalar(a, b, len);
+}
+
+}  // namespace z_detail
+
+template <typename I = int>
+vector<I> z_function(string_view s) {
+    const size_t n = s.size();
+    assert(n <= size_t(numeric_limits<I>::max()));
+    vector<I> z(n);
+    if (n == 0)
+        return z;
+    z[0] = I(n);
+    const char* p = s.data();
+    for (size_t i = 1, l = 0, r = 0; i < n; i++) {
+        size_t k = i < r ? min<size_t>(r - i, z[i - l]) : 0;
+        if (i + k >= r) {
+            k += z_detail::common_prefix(p + k, p + i + k, n - i - k);
+            l = i, r = i + k;
+        }
+        z[i] = I(k);
+    }
+    return z;
+}
+
+// ext[i] = LCP(p, t[i..]), given zp = z_function(p).
+template <typename I = int>
+vector<I> prefix_match_lengths(string_view p, string_view t, const vector<I>& zp) {
+    const size_t m = p.size(), n = t.size();
+    assert(zp.size() == m && n <= size_t(numeric_limits<I>::max()));
+    vector<I> ext(n);
+    // invariant: t[l, r) == p[0, r - l)
+    for (size_t i = 0, l = 0, r = 0; i < n; i++) {
+        size_t k = i < r ? min<size_t>(r - i, zp[i - l]) : 0;
+        if (i + k >= r) {
+            k += z_detail::common_prefix(p.data() + k, t.data() + i + k, min(m - k, n - i - k));
+            l = i, r = i + k;
+        }
+        ext[i] = I(k);
+    }
+    return ext;
+}
+
+template <typename I = int>
+vector<I> prefix_match_lengths(string_view p, string_view t) {
+    return prefix_match_lengths<I>(p, t, z_function<I>(p));
+}
+
+// f(i) for every i with t[i, i + |p|) == p, in increasing order.
+template <typename F>
+void z_search(string_view p, string_view t, F&& f) {
+    assert(!p.empty());
+    if (p.size() > t.size())
+        return;
+    auto zp = z_function<int64_t>(p);
+    const size_t m = p.size(), n = t.size();
+    for (size_t i = 0, l = 0, r = 0; i + m <= n; i++) {
+        size_t k = i < r ? min<size_t>(r - i, zp[i - l]) : 0;
+        if (i + k >= r) {
+            k += z_detail::common_prefix(p.data() + k, t.data() + i + k, m - k);
+            l = i, r = i + k;
+        }
+        if (k == m)
+            f(i);
+    }
+}
+
+inline vector<size_t> z_find_all(string_view p, string_view t) {
+    vector<size_t> res;
+    z_search(p, t, [&](size_t i) { res.push_back(i); });
+    return res;
+}
@@ -234,51 +234,48 @@ void stress_test_segment_tree_max(TestRunner& runner) {
     runner.test("Compare max implementation with naive", []() {
         StressTester stress;
         
-        return stress.compare_simple<bool>(
-            "LazySegmentTreeRangeMax vs Naive",
+        // ops: {1 = query, 2 = add, 3 = set, l, r, val}; failures shrink to a .in file.
+        auto gen = [](StressTester& rng) {
+            StressCase c;
+            int n = rng.random_int(1, 20);
+            for (int i = 0; i < n; i++) c.array.push_back(rng.random_int(1, 50));
+            c.index_fields = {1, 2};
+            for (int op = 0; op < 20; op++) {
+                auto [l, r] = rng.random_range(n);
+                c.ops.push_back({op % 3 + 1, l, r, rng.random_int(-50, 50)});
+            }
+            return c;
+        };
+        
+        auto check = [](const StressCase& c) -> bool {
+            auto max_func = [](int a, int b) { return max(a, b); };
+            vector<int> arr(c.array.begin(), c.array.end());
+            LazyRangeMax<int, decltype(max_func)> st(arr, -1e9, max_func);
+            NaiveRangeMax<int, decltype(max_func)> naive(arr, -1e9, max_func);
             
-            [&](const vector<int>& arr) -> bool {
-                auto max_func = [](int a, int b) { return max(a, b); };
-                LazyRangeMax<int, decltype(max_func)> st(arr, -1e9, max_func);
-                NaiveRangeMax<int, decltype(max_func)> naive(arr, -1e9, max_func);
-                
-                for (int op = 0; op < 20; op++) {
-                    auto [l, r] = stress.random_range(arr.size());
-                    int val = stress.random_int(-50, 50);
-                    
-                    if (op % 3 == 0) {
-                        int st_result = st.range_query(l, r);
-                        int naive_result = naive.range_query(l, r);
-                        if (st_result != naive_result) return false;
-                        
-                    } else if (op % 3 == 1) {
-                        st.range_add(l, r, val);
-                        naive.range_add(l, r, val);
-                        
-                    } else {
-                        st.range_set(l, r, val);
-                        naive.range_set(l, r, val);
-                    }
+            for (auto& op : c.ops) {
+                int l = op[1], r = op[2], val = op[3];
+                if (op[0] == 1) {
+                    if (st.range_query(l, r) != naive.range_query(l, r)) return false;
+                } else if (op[0] == 2) {
+                    st.range_add(l, r, val);
+                    naive.range_add(l, r, val);
+                } else {
+                    st.range_set(l, r, val);
+                    naive.range_set(l, r, val);
                 }
-                
+            }
             
-                for (int i = 0; i < (int)arr.size(); i++) {
-                    if (st.range_query(i, i) != naive.range_query(i, i)) {
-                        return false;
-                    }
+            for (int i = 0; i < (int)arr.size(); i++) {
+                if (st.range_query(i, i) != naive.range_query(i, i)) {
+                    return false;
                 }
-                
-                return true;
-            },
+            }
             
-            [](const vector<int>& arr) -> bool {
-                return true;
-            },
-            
-            100,   
-            20,    
-            50     
-        );
+            return true;
+        };
+        
+        return stress.run_cases("LazySegmentTreeRangeMax vs Naive", 2000, gen, check);
     });
     
     runner.test("Compare min implementation with naive", []() {
@@ -427,8 +424,8 @@ void test_type_aliases(TestRunner& runner) {
     });
 }
 
-int main() {
-    TestRunner runner;
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
     
     test_basic_max_functionality(runner);
     test_basic_min_functionality(runner);
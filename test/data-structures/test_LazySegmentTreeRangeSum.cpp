@@ -1,5 +1,6 @@
 #include "../test_runner.h"
 #include "data-structures/LazySegmentTreeRangeSum.hpp"
+#include "../fuzz/ops_lazy_range_sum.h"
 #include <vector>
 #include <algorithm>
 
@@ -215,10 +216,15 @@ void stress_test_segment_tree(TestRunner& runner) {
             100
         );
     });
+    
+    runner.test("Operation streams vs naive model", []() {
+        StressTester stress;
+        return lazy_range_sum_ops().run(stress, 2000, 100);
+    });
 }
 
-int main() {
-    TestRunner runner;
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
     
     test_basic_functionality(runner);
     test_edge_cases(runner);
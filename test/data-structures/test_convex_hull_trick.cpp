@@ -1,5 +1,6 @@
 #include "../test_runner.h"
 #include "data-structures/convex_hull_trick.hpp"
+#include "../fuzz/ops_line_container.h"
 #include <vector>
 #include <algorithm>
 
@@ -71,10 +72,15 @@ void stress_test_convex_hull_trick(TestRunner& runner) {
         }
         return true;
     });
+
+    runner.test("Operation streams vs naive model", [](){
+        StressTester stress;
+        return line_container_ops().run(stress, 2000, 100);
+    });
 }
 
-int main() {
-    TestRunner runner;
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
     test_basic_convex_hull_trick(runner);
     stress_test_convex_hull_trick(runner);
     runner.summary();
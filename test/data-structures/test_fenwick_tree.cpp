@@ -1,5 +1,6 @@
 #include "../test_runner.h"
 #include "data-structures/fenwick_tree.hpp"
+#include "../fuzz/ops_fenwick_range_ap.h"
 #include <vector>
 #include <algorithm>
 
@@ -355,12 +356,12 @@ void stress_test_fenwick_trees(TestRunner& runner) {
     runner.set_module("Fenwick Trees - Stress Testing");
     
     runner.test("FenwickTree vs Naive", []() {
-        StressTester stress;
+        StressTester tester;
         
-        return stress.compare_simple<bool>(
-            "FenwickTree vs Naive",
-            [&](const vector<int>& arr) -> bool {
-                int n = arr.size();
+        return tester.run_cases(
+            "FenwickTree vs Naive", 5000,
+            [](StressTester& stress) -> bool {
+                int n = stress.random_int(1, 20);
                 FenwickTree<int> ft(n);
                 NaiveFenwick<int> naive(n);
                 
@@ -387,19 +388,17 @@ void stress_test_fenwick_trees(TestRunner& runner) {
                     }
                 }
                 return true;
-            },
-            [](const vector<int>& arr) -> bool { return true; },
-            200, 20, 50
+            }
         );
     });
     
     runner.test("FenwickRangeAdd vs Naive", []() {
-        StressTester stress;
+        StressTester tester;
         
-        return stress.compare_simple<bool>(
-            "FenwickRangeAdd vs Naive",
-            [&](const vector<int>& arr) -> bool {
-                int n = arr.size();
+        return tester.run_cases(
+            "FenwickRangeAdd vs Naive", 5000,
+            [](StressTester& stress) -> bool {
+                int n = stress.random_int(1, 15);
                 FenwickRangeAdd<int> fr(n);
                 NaiveFenwickRangeAdd<int> naive(n);
                 
@@ -421,19 +420,17 @@ void stress_test_fenwick_trees(TestRunner& runner) {
                     }
                 }
                 return true;
-            },
-            [](const vector<int>& arr) -> bool { return true; },
-            200, 15, 50
+            }
         );
     });
     
     runner.test("FenwickRangeAP vs Naive", []() {
-        StressTester stress;
+        StressTester tester;
         
-        return stress.compare_simple<bool>(
-            "FenwickRangeAP vs Naive",
-            [&](const vector<int>& arr) -> bool {
-                int n = arr.size();
+        return tester.run_cases(
+            "FenwickRangeAP vs Naive", 5000,
+            [](StressTester& stress) -> bool {
+                int n = stress.random_int(1, 12);
                 FenwickRangeAP<long long> fa(n);
                 NaiveFenwickRangeAP<long long> naive(n);
                 
@@ -459,11 +456,14 @@ void stress_test_fenwick_trees(TestRunner& runner) {
                     }
                 }
                 return true;
-            },
-            [](const vector<int>& arr) -> bool { return true; },
-            150, 12, 30
+            }
         );
     });
+
+    runner.test("FenwickRangeAP operation streams vs naive model", []() {
+        StressTester stress;
+        return fenwick_range_ap_ops().run(stress, 2000, 100);
+    });
 }
 
 void test_performance(TestRunner& runner) {
@@ -495,8 +495,8 @@ void test_performance(TestRunner& runner) {
     });
 }
 
-int main() {
-    TestRunner runner;
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
     
     test_basic_fenwick_tree(runner);
     test_fenwick_range_add(runner);
@@ -71,8 +71,8 @@ void stress_test_lichao(TestRunner& runner) {
     });
 }
 
-int main() {
-    TestRunner runner;
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
     test_basic_lichao(runner);
     stress_test_lichao(runner);
     runner.summary();
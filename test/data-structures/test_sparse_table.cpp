@@ -116,8 +116,8 @@ void stress_test_sparse_table(TestRunner& runner) {
     });
 }
 
-int main() {
-    TestRunner runner;
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
     test_min_rmq(runner);
     test_max_rmq(runner);
     test_gcd_rmq(runner);
@@ -0,0 +1,97 @@
+#include "../test_runner.h"
+#include "../fuzz/ops_treap.h"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Nodes of x in order.
+static void in_order(node* x, vector<node*>& out) {
+    if (!x) return;
+    in_order(x->l, out);
+    out.push_back(x);
+    in_order(x->r, out);
+}
+
+void test_basic_treap(TestRunner& runner) {
+    runner.set_module("Treap - Basics");
+
+    runner.test("Insert at positions keeps the order", [](){
+        TreapSeq t;
+        vector<node*> seq;
+        int pos[] = {0, 1, 0, 2, 4, 1};
+        for (int i = 0; i < 6; i++) {
+            node* nd = t.make(i % 2 ? 100 - i : i);
+            auto [L, R] = split(t.root, pos[i]);
+            t.root = merge(merge(L, nd), R);
+            seq.insert(seq.begin() + pos[i], nd);
+        }
+        vector<node*> order;
+        in_order(t.root, order);
+        ASSERT_TRUE(order == seq);
+        ASSERT_EQ(t.root->val.sz, 6);
+        return true;
+    });
+
+    runner.test("Merge with a lower-priority left root", [](){
+        TreapSeq t;
+        node *a = t.make(1), *b = t.make(2), *c = t.make(3);
+        node* root = merge(merge(a, b), c);
+        vector<node*> order;
+        in_order(root, order);
+        ASSERT_TRUE(order == (vector<node*>{a, b, c}));
+        ASSERT_EQ(root->val.sz, 3);
+        return true;
+    });
+
+    runner.test("Split sizes", [](){
+        TreapSeq t;
+        for (int i = 0; i < 10; i++) t.root = merge(t.root, t.make(i * 7919 % 13));
+        for (int k = 0; k <= 10; k++) {
+            auto [L, R] = split(t.root, k);
+            ASSERT_EQ(L ? L->val.sz : 0, k);
+            ASSERT_EQ(R ? R->val.sz : 0, 10 - k);
+            t.root = merge(L, R);
+        }
+        return true;
+    });
+}
+
+void stress_test_treap(TestRunner& runner) {
+    runner.set_module("Treap - Stress Testing");
+
+    runner.test("Operation streams vs naive model", [](){
+        StressTester stress;
+        return treap_ops().run(stress, 2000, 100);
+    });
+}
+
+void test_treap_performance(TestRunner& runner) {
+    runner.set_module("Treap - Performance");
+
+    runner.test("3 * 10^5 inserts and erases at random positions", [](){
+        StressTester stress;
+        TreapSeq t;
+        const int n = 300000;
+        for (int i = 0; i < n; i++) {
+            auto [L, R] = split(t.root, stress.random_int(0, i));
+            t.root = merge(merge(L, t.make(stress.random_int(INT_MIN, INT_MAX))), R);
+        }
+        for (int i = n; i > n / 2; i--) {
+            auto [A, B] = split(t.root, stress.random_int(0, i - 1));
+            t.root = merge(A, split(B, 1).second);
+        }
+        ASSERT_EQ(t.root->val.sz, n / 2);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_basic_treap(runner);
+    stress_test_treap(runner);
+    test_treap_performance(runner);
+
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,5 @@
+#include "ops_fenwick_range_ap.h"
+
+static const auto fuzzer = fenwick_range_ap_ops();
+
+CP_FUZZ_TARGET(fuzzer)
@@ -0,0 +1,5 @@
+#include "ops_lazy_range_sum.h"
+
+static const auto fuzzer = lazy_range_sum_ops();
+
+CP_FUZZ_TARGET(fuzzer)
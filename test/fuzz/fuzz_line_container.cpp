@@ -0,0 +1,5 @@
+#include "ops_line_container.h"
+
+static const auto fuzzer = line_container_ops();
+
+CP_FUZZ_TARGET(fuzzer)
@@ -0,0 +1,5 @@
+#include "ops_treap.h"
+
+static const auto fuzzer = treap_ops();
+
+CP_FUZZ_TARGET(fuzzer)
@@ -0,0 +1,47 @@
+#pragma once
+#include "../fuzz_runner.h"
+#include "data-structures/fenwick_tree.hpp"
+
+// FenwickRangeAP<long long> against a plain array: constant and arithmetic
+// progression range adds, range sums and prefix sums. Rows are {op, l, r, value}.
+using FenwickRangeAPFuzzer = OpFuzzer<FenwickRangeAP<long long>, vector<long long>>;
+
+inline FenwickRangeAPFuzzer fenwick_range_ap_ops() {
+    FenwickRangeAPFuzzer f(
+        "FenwickRangeAP op streams",
+        [](const vector<long long>& a) {
+            FenwickRangeAP<long long> ft(a.size());
+            for (int i = 0; i < (int)a.size(); i++) ft.add_range_constant(i, i, a[i]);
+            return ft;
+        },
+        [](const vector<long long>& a) { return a; });
+    auto range_with_value = [](StressTester& rng, int n) {
+        auto [l, r] = rng.random_range(n);
+        return FenwickRangeAPFuzzer::Args{l, r, rng.random_ll(-1000000000, 1000000000)};
+    };
+    f.initial([](StressTester& rng) {
+         auto a = rng.random_array(rng.random_int(1, 64), -1000000000, 1000000000);
+         return vector<long long>(a.begin(), a.end());
+     })
+        .index_fields({1, 2})
+        .op("add constant", 3, range_with_value,
+            [](auto& ft, auto& a, auto& x) {
+                ft.add_range_constant(x[0], x[1], x[2]);
+                for (long long i = x[0]; i <= x[1]; i++) a[i] += x[2];
+                return true;
+            })
+        .op("add 1, 2, 3, ...", 2, range_with_value,
+            [](auto& ft, auto& a, auto& x) {
+                ft.add_range_increasing_by_one(x[0], x[1]);
+                for (long long i = x[0]; i <= x[1]; i++) a[i] += i - x[0] + 1;
+                return true;
+            })
+        .op("range sum", 3, range_with_value,
+            [](auto& ft, auto& a, auto& x) {
+                return ft.range_sum(x[0], x[1]) == accumulate(a.begin() + x[0], a.begin() + x[1] + 1, 0LL);
+            })
+        .op("prefix sum", 1, range_with_value, [](auto& ft, auto& a, auto& x) {
+            return ft.prefix_sum(x[1]) == accumulate(a.begin(), a.begin() + x[1] + 1, 0LL);
+        });
+    return f;
+}
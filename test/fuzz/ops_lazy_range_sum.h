@@ -0,0 +1,38 @@
+#pragma once
+#include "../fuzz_runner.h"
+#include "data-structures/LazySegmentTreeRangeSum.hpp"
+
+// LazyRangeSum<long long> against a plain array: range add, range set and
+// range sum. Rows are {op, l, r, value}.
+using LazyRangeSumFuzzer = OpFuzzer<LazyRangeSum<long long>, vector<long long>>;
+
+inline LazyRangeSumFuzzer lazy_range_sum_ops() {
+    LazyRangeSumFuzzer f(
+        "LazyRangeSum op streams", [](const vector<long long>& a) { return LazyRangeSum<long long>(a); },
+        [](const vector<long long>& a) { return a; });
+    auto range_with_value = [](StressTester& rng, int n) {
+        auto [l, r] = rng.random_range(n);
+        return LazyRangeSumFuzzer::Args{l, r, rng.random_ll(-1000000000, 1000000000)};
+    };
+    f.initial([](StressTester& rng) {
+         auto a = rng.random_array(rng.random_int(1, 64), -1000000000, 1000000000);
+         return vector<long long>(a.begin(), a.end());
+     })
+        .index_fields({1, 2})
+        .op("add", 3, range_with_value,
+            [](auto& st, auto& a, auto& x) {
+                st.range_add(x[0], x[1], x[2]);
+                for (long long i = x[0]; i <= x[1]; i++) a[i] += x[2];
+                return true;
+            })
+        .op("set", 2, range_with_value,
+            [](auto& st, auto& a, auto& x) {
+                st.range_set(x[0], x[1], x[2]);
+                for (long long i = x[0]; i <= x[1]; i++) a[i] = x[2];
+                return true;
+            })
+        .op("sum", 4, range_with_value, [](auto& st, auto& a, auto& x) {
+            return st.range_sum(x[0], x[1]) == accumulate(a.begin() + x[0], a.begin() + x[1] + 1, 0LL);
+        });
+    return f;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "../fuzz_runner.h"
+#include "data-structures/convex_hull_trick.hpp"
+
+// LineContainer against the list of inserted lines: add(k, m) and max query
+// at x. Rows are {op, k, m} or {op, x}; queries on an empty set are skipped.
+using LineContainerFuzzer = OpFuzzer<LineContainer, vector<pair<long long, long long>>>;
+
+inline LineContainerFuzzer line_container_ops() {
+    LineContainerFuzzer f(
+        "LineContainer op streams", [](const vector<long long>&) { return LineContainer(); },
+        [](const vector<long long>&) { return vector<pair<long long, long long>>(); });
+    f.op(
+         "add", 2,
+         [](StressTester& rng, int) {
+             return LineContainerFuzzer::Args{rng.random_ll(-1000000, 1000000), rng.random_ll(-1000000000000LL, 1000000000000LL)};
+         },
+         [](auto& cht, auto& lines, auto& x) {
+             cht.add(x[0], x[1]);
+             lines.push_back({x[0], x[1]});
+             return true;
+         })
+        .op("query", 3, [](StressTester& rng, int) { return LineContainerFuzzer::Args{rng.random_ll(-1000000, 1000000)}; },
+            [](auto& cht, auto& lines, auto& x) {
+                if (lines.empty()) return true;
+                long long best = LLONG_MIN;
+                for (auto [k, m] : lines) best = max(best, k * x[0] + m);
+                return cht.query(x[0]) == best;
+            });
+    return f;
+}
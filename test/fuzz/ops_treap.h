@@ -0,0 +1,80 @@
+#pragma once
+#include "../fuzz_runner.h"
+#include "data-structures/treap.hpp"
+
+// Implicit treap against a vector of node pointers: insert, erase and a
+// split/merge round trip at a position, checking after every step that the
+// in-order traversal is the model and every subtree size is right.
+// Positions are taken modulo the current size and priorities are drawn as
+// arguments, so any shrunk stream stays valid and replays the same shape.
+// Rows are {op, position, priority}.
+//
+// Nodes are built with node(priority), which leaves the global rng alone, so
+// streams may run on any number of threads. The nodes are owned by a list rather than the tree, so a broken tree
+// never causes a double free or a leak.
+struct TreapSeq {
+    node* root = nullptr;
+    vector<unique_ptr<node>> nodes;
+
+    node* make(int priority) {
+        nodes.push_back(make_unique<node>(priority));
+        return nodes.back().get();
+    }
+};
+
+using TreapFuzzer = OpFuzzer<TreapSeq, vector<node*>>;
+
+namespace treap_ops_detail {
+
+// In-order nodes of x; false if a stored size is wrong.
+inline bool collect(node* x, vector<node*>& out) {
+    if (!x) return true;
+    size_t before = out.size();
+    if (!collect(x->l, out)) return false;
+    out.push_back(x);
+    if (!collect(x->r, out)) return false;
+    return x->val.sz == int(out.size() - before);
+}
+
+}  // namespace treap_ops_detail
+
+inline TreapFuzzer treap_ops() {
+    TreapFuzzer f("Treap op streams", [](const vector<long long>&) { return TreapSeq(); },
+                  [](const vector<long long>&) { return vector<node*>(); });
+    auto position = [](StressTester& rng, int) {
+        return TreapFuzzer::Args{rng.random_int(0, 1 << 20), rng.random_int(INT_MIN, INT_MAX)};
+    };
+    f.op("insert", 3, position,
+         [](TreapSeq& t, vector<node*>& seq, const TreapFuzzer::Args& x) {
+             int pos = x[0] % (seq.size() + 1);
+             node* nd = t.make(int(x[1]));
+             auto [L, R] = split(t.root, pos);
+             t.root = merge(merge(L, nd), R);
+             seq.insert(seq.begin() + pos, nd);
+             return true;
+         })
+        .op("erase", 1, position,
+            [](TreapSeq& t, vector<node*>& seq, const TreapFuzzer::Args& x) {
+                if (seq.empty()) return true;
+                int pos = x[0] % seq.size();
+                auto [A, B] = split(t.root, pos);
+                auto [M, C] = split(B, 1);
+                t.root = merge(A, C);
+                bool ok = M == seq[pos] && M->val.sz == 1;
+                seq.erase(seq.begin() + pos);
+                return ok;
+            })
+        .op("split and merge", 1, position,
+            [](TreapSeq& t, vector<node*>& seq, const TreapFuzzer::Args& x) {
+                int pos = x[0] % (seq.size() + 1);
+                auto [L, R] = split(t.root, pos);
+                bool ok = (L ? L->val.sz : 0) == pos;
+                t.root = merge(L, R);
+                return ok;
+            })
+        .invariant([](TreapSeq& t, vector<node*>& seq) {
+            vector<node*> order;
+            return treap_ops_detail::collect(t.root, order) && order == seq;
+        });
+    return f;
+}
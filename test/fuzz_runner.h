@@ -0,0 +1,155 @@
+#pragma once
+#include "test_runner.h"
+
+// Differential fuzzing of a stateful structure against a naive model.
+//
+// An OpFuzzer is given how to build the structure (Sut) and the model from
+// an initial array, and a set of weighted operations. Each operation draws
+// its arguments, performs itself on both sides and reports whether their
+// answers agree; an optional invariant compares the full states after every
+// step. Streams are StressCase rows {op + 1, args...}, so a failing stream
+// is shrunk and saved as a .in file by StressTester::run_cases.
+//
+//   OpFuzzer<LazyRangeSum<long long>, vector<long long>> f("LazyRangeSum",
+//       [](auto& a) { return LazyRangeSum<long long>(a); }, [](auto& a) { return a; });
+//   f.initial(...).index_fields({1, 2}).op("add", 2, gen, apply);
+//   f.run(tester, 5000, 100);
+//
+// The same specification serves libFuzzer: CP_FUZZ_TARGET(f) defines
+// LLVMFuzzerTestOneInput, whose bytes drive the generators (see test/fuzz).
+template<typename Sut, typename Model>
+class OpFuzzer {
+public:
+    using Args = vector<long long>;
+    using MakeSut = function<Sut(const vector<long long>&)>;
+    using MakeModel = function<Model(const vector<long long>&)>;
+    using Gen = function<Args(StressTester&, int)>;
+    using Apply = function<bool(Sut&, Model&, const Args&)>;
+
+    OpFuzzer(string name, MakeSut make_sut, MakeModel make_model)
+        : name(std::move(name)), make_sut(std::move(make_sut)), make_model(std::move(make_model)) {}
+
+    // Initial array of every stream (default: empty).
+    OpFuzzer& initial(function<vector<long long>(StressTester&)> gen) {
+        initial_gen = std::move(gen);
+        return *this;
+    }
+
+    // Row fields holding array positions (field 0 is the operation).
+    OpFuzzer& index_fields(vector<int> fields) {
+        indices = std::move(fields);
+        return *this;
+    }
+
+    // gen(rng, n) draws the arguments for an array of size n; apply returns
+    // false when the structure and the model disagree.
+    OpFuzzer& op(string op_name, int weight, Gen gen, Apply apply) {
+        ops.push_back({std::move(op_name), weight, std::move(gen), std::move(apply)});
+        total_weight += weight;
+        return *this;
+    }
+
+    OpFuzzer& invariant(function<bool(Sut&, Model&)> check) {
+        state_check = std::move(check);
+        return *this;
+    }
+
+    StressCase generate(StressTester& rng, int length) const {
+        StressCase c;
+        if (initial_gen) c.array = initial_gen(rng);
+        c.index_fields = indices;
+        for (int step = 0; step < length; step++) {
+            int pick = rng.random_int(0, total_weight - 1), k = 0;
+            while (pick >= ops[k].weight) pick -= ops[k++].weight;
+            Args row = ops[k].gen(rng, (int)c.array.size());
+            row.insert(row.begin(), k + 1);
+            c.ops.push_back(std::move(row));
+        }
+        return c;
+    }
+
+    // First step (0-based) where the two sides disagree, -1 if none.
+    long long execute(const StressCase& c) const {
+        Sut sut = make_sut(c.array);
+        Model model = make_model(c.array);
+        for (size_t step = 0; step < c.ops.size(); step++) {
+            const Args& row = c.ops[step];
+            Args args(row.begin() + 1, row.end());
+            if (!ops[row[0] - 1].apply(sut, model, args)) return step;
+            if (state_check && !state_check(sut, model)) return step;
+        }
+        return -1;
+    }
+
+    // `streams` random streams of `length` operations, in parallel.
+    bool run(StressTester& tester, long long streams, int length) const {
+        return tester.run_cases(
+            name, streams, [&](StressTester& rng) { return generate(rng, length); },
+            [&](const StressCase& c) { return execute(c) < 0; });
+    }
+
+    // One libFuzzer input: the bytes pick the stream length and every draw.
+    void fuzz_one(const uint8_t* data, size_t size, int max_length = 256) const {
+        StressTester bytes(data, size);
+        StressCase c = generate(bytes, bytes.random_int(1, max_length));
+        long long step = execute(c);
+        if (step < 0) return;
+        c.ops.resize(step + 1);
+        cout << "💥 " << name << ": mismatch at step " << step << " (" << ops[c.ops[step][0] - 1].name << ")\n"
+             << c.to_input() << flush;
+        abort();
+    }
+
+private:
+    struct Op {
+        string name;
+        int weight;
+        Gen gen;
+        Apply apply;
+    };
+
+    string name;
+    MakeSut make_sut;
+    MakeModel make_model;
+    function<vector<long long>(StressTester&)> initial_gen;
+    vector<int> indices;
+    vector<Op> ops;
+    int total_weight = 0;
+    function<bool(Sut&, Model&)> state_check;
+};
+
+// libFuzzer entry point for an OpFuzzer. Without -fsanitize=fuzzer
+// (CP_FUZZ_STANDALONE) it also defines a main that replays the files given
+// as arguments, or runs STRESS_CASES (default 2000) random byte strings
+// seeded from STRESS_SEED.
+#ifdef CP_FUZZ_STANDALONE
+#define CP_FUZZ_MAIN(fuzzer)                                                      \
+    int main(int argc, char** argv) {                                             \
+        for (int i = 1; i < argc; i++) {                                          \
+            ifstream in(argv[i], ios::binary);                                    \
+            string s((istreambuf_iterator<char>(in)), istreambuf_iterator<char>()); \
+            LLVMFuzzerTestOneInput((const uint8_t*)s.data(), s.size());          \
+        }                                                                         \
+        if (argc > 1) return 0;                                                   \
+        StressTester tester;                                                      \
+        const char* n = getenv("STRESS_CASES");                                   \
+        long long cases = n ? stoll(n) : 2000;                                    \
+        for (long long i = 0; i < cases; i++) {                                   \
+            StressTester rng(tester.case_seed(i));                                \
+            string s(rng.random_int(0, 1024), 0);                                 \
+            for (auto& ch : s) ch = char(rng.random_int(0, 255));                 \
+            LLVMFuzzerTestOneInput((const uint8_t*)s.data(), s.size());          \
+        }                                                                         \
+        cout << "✅ " << cases << " random inputs passed\n";                      \
+        return 0;                                                                 \
+    }
+#else
+#define CP_FUZZ_MAIN(fuzzer)
+#endif
+
+#define CP_FUZZ_TARGET(fuzzer)                                                   \
+    extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {    \
+        (fuzzer).fuzz_one(data, size);                                           \
+        return 0;                                                                \
+    }                                                                            \
+    CP_FUZZ_MAIN(fuzzer)
@@ -0,0 +1,134 @@
+#include "../test_runner.h"
+#include "geometry/convex_hull.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Naive reference implementation: std::sort + monotone chain, no pre-filter.
+template <typename T>
+vector<Point<T>> naive_hull(vector<Point<T>> p) {
+    sort(p.begin(), p.end());
+    p.erase(unique(p.begin(), p.end()), p.end());
+    if (p.size() <= 1) return p;
+    vector<Point<T>> lo, up;
+    for (auto& q : p) {
+        while (lo.size() >= 2 && cross(lo[lo.size() - 2], lo.back(), q) <= 0) lo.pop_back();
+        lo.push_back(q);
+    }
+    for (int i = int(p.size()) - 1; i >= 0; i--) {
+        while (up.size() >= 2 && cross(up[up.size() - 2], up.back(), p[i]) <= 0) up.pop_back();
+        up.push_back(p[i]);
+    }
+    lo.pop_back(), up.pop_back();
+    lo.insert(lo.end(), up.begin(), up.end());
+    return lo;
+}
+
+template <typename T>
+vector<Point<T>> random_points(StressTester& stress, int n, long long range, long long offset = 0) {
+    vector<Point<T>> p(n);
+    for (auto& q : p)
+        q = {T(offset + stress.random_int(-range, range)), T(offset + stress.random_int(-range, range))};
+    return p;
+}
+
+void test_convex_hull_basic(TestRunner& runner) {
+    runner.set_module("Convex hull - Basic");
+
+    runner.test("Point predicates are exact", []() {
+        PointI a{0, 0}, b{4, 0}, c{1, 3};
+        ASSERT_EQ(orientation(a, b, c), 1);
+        ASSERT_EQ(orientation(a, c, b), -1);
+        ASSERT_EQ(orientation(a, b, PointI{8, 0}), 0);
+        ASSERT_TRUE(cross(a, b, c) == 12);
+        long long big = (1LL << 62) - 1;
+        PointI p{-big, -big}, q{big, big - 1}, r{big - 1, big};
+        ASSERT_EQ(orientation(p, q, r), 1);   // would overflow in 64 bits
+        Point<int> s{46341, 46341};
+        ASSERT_TRUE(s.norm2() == 2LL * 46341 * 46341);
+        PointsSoA<long long> soa(vector<PointI>{a, b, c});
+        ASSERT_TRUE(soa[2] == c && soa.to_points() == (vector<PointI>{a, b, c}));
+        return true;
+    });
+
+    runner.test("Small hulls and degenerate inputs", []() {
+        vector<PointI> sq = {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {1, 1}, {1, 0}, {0, 0}};
+        ASSERT_TRUE(convex_hull(sq) == (vector<PointI>{{0, 0}, {2, 0}, {2, 2}, {0, 2}}));
+        ASSERT_TRUE(convex_hull(vector<PointI>{}).empty());
+        ASSERT_TRUE(convex_hull(vector<PointI>{{3, 3}, {3, 3}}) == (vector<PointI>{{3, 3}}));
+        ASSERT_TRUE(convex_hull(vector<PointI>{{0, 0}, {1, 1}, {2, 2}, {1, 1}}) == (vector<PointI>{{0, 0}, {2, 2}}));
+        return true;
+    });
+}
+
+void stress_test_convex_hull(TestRunner& runner) {
+    runner.set_module("Convex hull - Stress Testing");
+
+    runner.test("Integer points vs naive (filter, SoA, threads)", []() {
+        StressTester stress;
+        for (int t = 0; t < 300; t++) {
+            int n = stress.random_int(0, t < 250 ? 300 : 3000);
+            long long range = stress.random_int(1, 3) == 1 ? 3 : 1000000;
+            auto p = random_points<long long>(stress, n, range);
+            auto expect = naive_hull(p);
+            if (convex_hull(p) != expect) return false;
+            if (convex_hull(PointsSoA<long long>(p)) != expect) return false;
+            if (convex_hull(p, 3) != expect) return false;
+        }
+        return true;
+    });
+
+    runner.test("Huge coordinates and large inputs", []() {
+        StressTester stress;
+        for (int t = 0; t < 6; t++) {
+            long long offset = t % 2 ? (1LL << 61) : 0;
+            auto p = random_points<long long>(stress, 200000, t < 3 ? 1000000000 : 30, offset);
+            for (auto& q : p) q = q * (t < 3 ? 1000000 : 1);   // coordinates up to ~2^60
+            auto expect = naive_hull(p);
+            if (convex_hull(p) != expect || convex_hull(p, 4) != expect) return false;
+        }
+        return true;
+    });
+
+    runner.test("Double points, including on a circle", []() {
+        StressTester stress;
+        for (int t = 0; t < 20; t++) {
+            int n = stress.random_int(100, 100000);
+            vector<PointD> p(n);
+            for (int i = 0; i < n; i++) {
+                double a = stress.random_int(0, 1 << 30) * 1e-8, r = t % 2 ? 1e6 : sqrt(stress.random_int(0, 1 << 30));
+                p[i] = {r * cos(a), r * sin(a)};
+            }
+            auto expect = naive_hull(p);
+            if (convex_hull(p) != expect || convex_hull(p, 2) != expect) return false;
+        }
+        return true;
+    });
+}
+
+void test_convex_hull_performance(TestRunner& runner) {
+    runner.set_module("Convex hull - Performance");
+
+    runner.test("10^7 integer points in a disk", []() {
+        mt19937_64 rng(7);
+        vector<PointI> p;
+        p.reserve(10000000);
+        while (p.size() < 10000000) {
+            long long x = rng() % 2000001 - 1000000, y = rng() % 2000001 - 1000000;
+            if (x * x + y * y <= 1000000LL * 1000000) p.push_back({x, y});
+        }
+        auto h = convex_hull(p);
+        ASSERT_TRUE(h.size() > 100);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_convex_hull_basic(runner);
+    stress_test_convex_hull(runner);
+    test_convex_hull_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
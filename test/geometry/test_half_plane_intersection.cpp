@@ -0,0 +1,174 @@
+#include "../test_runner.h"
+#include "geometry/half_plane_intersection.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+using LP = Point<long double>;
+
+// Naive reference implementation: clip a polygon by every half-plane
+// (Sutherland-Hodgman), O(n^2).
+template <typename T>
+vector<LP> naive_clip(vector<LP> poly, const vector<HalfPlane<T>>& hs) {
+    for (auto& h : hs) {
+        LP p{(long double)h.p.x, (long double)h.p.y}, d{(long double)h.d.x, (long double)h.d.y};
+        auto side = [&](const LP& q) { return d.cross(q - p); };
+        vector<LP> out;
+        for (size_t i = 0, n = poly.size(); i < n; i++) {
+            LP a = poly[i], b = poly[(i + 1) % n];
+            long double sa = side(a), sb = side(b);
+            if (sa >= 0) out.push_back(a);
+            if ((sa < 0 && sb > 0) || (sa > 0 && sb < 0)) out.push_back(a + (b - a) * (sa / (sa - sb)));
+        }
+        poly = out;
+    }
+    return poly;
+}
+
+template <typename P>
+long double shoelace(const vector<P>& poly) {
+    long double s = 0;
+    for (size_t i = 0, n = poly.size(); i < n; i++) {
+        const P& a = poly[i];
+        const P& b = poly[(i + 1) % n];
+        s += (long double)a.x * b.y - (long double)a.y * b.x;
+    }
+    return s / 2;
+}
+
+template <typename T>
+vector<HalfPlane<T>> box(T lo, T hi) {
+    Point<T> a{lo, lo}, b{hi, lo}, c{hi, hi}, d{lo, hi};
+    return {{a, b}, {b, c}, {c, d}, {d, a}};
+}
+
+// Intersection matches the clipped box, is counter-clockwise and lies in every half-plane.
+template <typename T>
+bool matches(const vector<HalfPlane<T>>& hs, T lo, T hi) {
+    auto got = half_plane_intersection(hs);
+    long double L = lo, H = hi;
+    long double expect = shoelace(naive_clip<T>({LP{L, L}, LP{H, L}, LP{H, H}, LP{L, H}}, hs));
+    long double scale = (long double)(hi - lo) * (hi - lo);
+    if (abs(shoelace(got) - expect) > 1e-9 * scale) return false;
+    for (size_t i = 0, n = got.size(); i < n; i++) {
+        PointD a = got[i], b = got[(i + 1) % n], c = got[(i + 2) % n];
+        if ((b - a).cross(c - b) < -1e-9 * scale) return false;
+        for (auto& h : hs)
+            if ((long double)h.d.x * (a.y - h.p.y) - (long double)h.d.y * (a.x - h.p.x) <
+                -1e-9 * scale * sqrtl((long double)h.d.norm2()))
+                return false;
+    }
+    return true;
+}
+
+void test_half_plane_intersection_basic(TestRunner& runner) {
+    runner.set_module("Half-plane intersection - Basic");
+
+    runner.test("Triangle, square and empty regions", []() {
+        vector<HalfPlane<long long>> tri = {{{0, 0}, {4, 0}}, {{4, 0}, {0, 4}}, {{0, 4}, {0, 0}}};
+        auto r = half_plane_intersection(tri);
+        ASSERT_EQ((int)r.size(), 3);
+        ASSERT_NEAR((double)shoelace(r), 8.0, 1e-12);
+        auto sq = box<long long>(0, 10);
+        sq.push_back({{20, 0}, {0, 20}});   // x + y <= 20, redundant
+        sq.push_back({{0, 0}, {10, 0}});    // duplicate
+        ASSERT_NEAR((double)shoelace(half_plane_intersection(sq)), 100.0, 1e-12);
+        sq.push_back({{0, 5}, {5, 0}});     // cuts off a corner
+        ASSERT_NEAR((double)shoelace(half_plane_intersection(sq)), 87.5, 1e-12);
+        auto empty = box<long long>(0, 10);
+        empty.push_back({{20, 10}, {20, 0}});   // x >= 20
+        ASSERT_TRUE(half_plane_intersection(empty).empty());
+        return true;
+    });
+
+    runner.test("Zero-area intersections are empty", []() {
+        auto line = box<long long>(0, 10);
+        line.push_back({{10, 5}, {0, 5}});   // y <= 5
+        line.push_back({{0, 5}, {10, 5}});   // y >= 5
+        ASSERT_TRUE(half_plane_intersection(line).empty());
+        auto point = box<long long>(0, 10);
+        point.push_back({{0, 20}, {20, 0}});   // x + y >= 20 touches the corner (10, 10)
+        ASSERT_TRUE(half_plane_intersection(point).empty());
+        return true;
+    });
+}
+
+void stress_test_half_plane_intersection(TestRunner& runner) {
+    runner.set_module("Half-plane intersection - Stress Testing");
+
+    runner.test("Random integer half-planes vs clipping", []() {
+        StressTester stress;
+        for (int t = 0; t < 3000; t++) {
+            int range = stress.random_int(1, t < 2000 ? 5 : 100000);
+            auto hs = box<long long>(-range, range);
+            int k = stress.random_int(0, t < 2000 ? 8 : 40);
+            for (int i = 0; i < k; i++) {
+                PointI a{stress.random_int(-range, range), stress.random_int(-range, range)}, b = a;
+                while (b == a) b = {stress.random_int(-range, range), stress.random_int(-range, range)};
+                hs.push_back({a, b});
+            }
+            shuffle(hs.begin(), hs.end(), mt19937(t));
+            if (!matches<long long>(hs, -range, range)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Double half-planes vs clipping", []() {
+        StressTester stress;
+        for (int t = 0; t < 1000; t++) {
+            auto hs = box<double>(-1, 1);
+            int k = stress.random_int(0, 20);
+            for (int i = 0; i < k; i++) {
+                double a = stress.random_int(0, 1 << 20) * 6e-6;
+                PointD p{cos(a) * 0.8, sin(a) * 0.8}, d{-sin(a), cos(a)};
+                hs.push_back({p, p + d});
+            }
+            if (!matches<double>(hs, -1, 1)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Coordinates near 2^29 stay exact", []() {
+        StressTester stress;
+        const long long R = 1LL << 29;
+        for (int t = 0; t < 200; t++) {
+            auto hs = box<long long>(-R, R);
+            for (int i = 0; i < 30; i++) {
+                PointI a{stress.random_int(-R, R), stress.random_int(-R, R)}, b{stress.random_int(-R, R), stress.random_int(-R, R)};
+                if (a != b) hs.push_back({a, b});
+            }
+            if (!matches<long long>(hs, -R, R)) return false;
+        }
+        return true;
+    });
+}
+
+void test_half_plane_intersection_performance(TestRunner& runner) {
+    runner.set_module("Half-plane intersection - Performance");
+
+    runner.test("10^6 tangent half-planes of a circle", []() {
+        const int n = 1000000;
+        const long long R = 500000000;
+        vector<HalfPlane<long long>> hs;
+        for (int i = 0; i < n; i++) {
+            double a = 2 * M_PI * i / n;
+            PointI p{llround(R * cos(a)), llround(R * sin(a))}, d{llround(-sin(a) * 1000), llround(cos(a) * 1000)};
+            hs.push_back({p, p + d});
+        }
+        shuffle(hs.begin(), hs.end(), mt19937(1));
+        auto poly = half_plane_intersection(hs);
+        ASSERT_TRUE(poly.size() > 1000);
+        ASSERT_NEAR((double)(shoelace(poly) / (M_PI * R * R)), 1.0, 1e-3);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_half_plane_intersection_basic(runner);
+    stress_test_half_plane_intersection(runner);
+    test_half_plane_intersection_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,126 @@
+#include "../test_runner.h"
+#include "geometry/minkowski_sum.hpp"
+#include "geometry/convex_hull.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Naive reference implementations: hull of all n * m sums, and pairwise
+// edge / containment checks.
+vector<PointI> naive_sum(const vector<PointI>& P, const vector<PointI>& Q) {
+    vector<PointI> all;
+    for (auto& p : P)
+        for (auto& q : Q) all.push_back(p + q);
+    return convex_hull(all);
+}
+
+bool on_segment(PointI a, PointI b, PointI p) { return orientation(a, b, p) == 0 && (p - a).dot(p - b) <= 0; }
+
+bool segments_touch(PointI a, PointI b, PointI c, PointI d) {
+    int o1 = orientation(a, b, c), o2 = orientation(a, b, d), o3 = orientation(c, d, a), o4 = orientation(c, d, b);
+    if (o1 * o2 < 0 && o3 * o4 < 0) return true;
+    return on_segment(a, b, c) || on_segment(a, b, d) || on_segment(c, d, a) || on_segment(c, d, b);
+}
+
+bool naive_inside(const vector<PointI>& h, PointI p) {
+    int n = h.size();
+    if (n == 1) return h[0] == p;
+    if (n == 2) return on_segment(h[0], h[1], p);
+    for (int i = 0; i < n; i++)
+        if (orientation(h[i], h[(i + 1) % n], p) < 0) return false;
+    return true;
+}
+
+bool naive_intersect(const vector<PointI>& P, const vector<PointI>& Q) {
+    int n = P.size(), m = Q.size();
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < m; j++)
+            if (segments_touch(P[i], P[(i + 1) % n], Q[j], Q[(j + 1) % m])) return true;
+    return naive_inside(P, Q[0]) || naive_inside(Q, P[0]);
+}
+
+vector<PointI> random_hull(StressTester& stress, int k, int range, PointI shift = {}) {
+    vector<PointI> pts(k);
+    for (auto& p : pts) p = PointI{stress.random_int(-range, range), stress.random_int(-range, range)} + shift;
+    return convex_hull(pts);
+}
+
+void test_minkowski_sum_basic(TestRunner& runner) {
+    runner.set_module("Minkowski sum - Basic");
+
+    runner.test("Square plus triangle", []() {
+        vector<PointI> sq = {{0, 0}, {1, 0}, {1, 1}, {0, 1}}, tri = {{0, 0}, {2, 0}, {0, 2}};
+        ASSERT_TRUE(minkowski_sum(sq, tri) == (vector<PointI>{{0, 0}, {3, 0}, {3, 1}, {1, 3}, {0, 3}}));
+        ASSERT_TRUE(minkowski_sum(sq, vector<PointI>{{5, 5}}) == (vector<PointI>{{5, 5}, {6, 5}, {6, 6}, {5, 6}}));
+        ASSERT_TRUE(minkowski_sum(vector<PointI>{{0, 0}, {2, 0}}, vector<PointI>{{0, 0}, {0, 3}}) ==
+                    (vector<PointI>{{0, 0}, {2, 0}, {2, 3}, {0, 3}}));
+        ASSERT_TRUE(minkowski_sum(vector<PointI>{{0, 0}, {2, 2}}, vector<PointI>{{1, 1}, {0, 0}}) ==
+                    (vector<PointI>{{0, 0}, {3, 3}}));
+        return true;
+    });
+
+    runner.test("Collision test", []() {
+        vector<PointI> sq = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+        ASSERT_TRUE(convex_intersect(sq, vector<PointI>{{1, 1}, {5, 1}, {5, 5}}));
+        ASSERT_TRUE(convex_intersect(sq, vector<PointI>{{2, 2}, {4, 2}, {4, 4}}));   // corner touch
+        ASSERT_TRUE(!convex_intersect(sq, vector<PointI>{{3, 0}, {5, 0}, {5, 2}}));
+        ASSERT_TRUE(convex_intersect(sq, vector<PointI>{{1, 1}}));
+        return true;
+    });
+}
+
+void stress_test_minkowski_sum(TestRunner& runner) {
+    runner.set_module("Minkowski sum - Stress Testing");
+
+    runner.test("Random hulls vs hull of all sums", []() {
+        StressTester stress;
+        for (int t = 0; t < 1000; t++) {
+            int range = stress.random_int(1, t < 500 ? 4 : 1000000);
+            auto P = random_hull(stress, stress.random_int(1, 30), range);
+            auto Q = random_hull(stress, stress.random_int(1, 30), range);
+            if (minkowski_sum(P, Q) != naive_sum(P, Q)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Collision test vs pairwise edges", []() {
+        StressTester stress;
+        for (int t = 0; t < 2000; t++) {
+            int range = stress.random_int(1, t < 1000 ? 4 : 1000);
+            auto P = random_hull(stress, stress.random_int(1, 12), range);
+            PointI shift{stress.random_int(-2 * range, 2 * range), stress.random_int(-2 * range, 2 * range)};
+            auto Q = random_hull(stress, stress.random_int(1, 12), range, shift);
+            if (convex_intersect(P, Q) != naive_intersect(P, Q)) return false;
+        }
+        return true;
+    });
+}
+
+void test_minkowski_sum_performance(TestRunner& runner) {
+    runner.set_module("Minkowski sum - Performance");
+
+    runner.test("Sum of two 10^6-vertex polygons", []() {
+        vector<PointI> P, Q;
+        const long long R = 1000000000000LL;
+        for (int i = 0; i < 1000000; i++) {
+            double a = 2 * M_PI * i / 1000000;
+            P.push_back({llround(R * cos(a)), llround(R * sin(a))});
+            Q.push_back({llround(R * cos(a + 1e-7)), llround(R * sin(a + 1e-7))});
+        }
+        P = convex_hull(P), Q = convex_hull(Q);
+        auto S = minkowski_sum(P, Q);
+        ASSERT_TRUE(S.size() >= P.size() && S.size() <= P.size() + Q.size());
+        ASSERT_TRUE(convex_intersect(P, Q));
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_minkowski_sum_basic(runner);
+    stress_test_minkowski_sum(runner);
+    test_minkowski_sum_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,158 @@
+#include "../test_runner.h"
+#include "geometry/polygon.hpp"
+#include "geometry/convex_hull.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Naive reference implementation: O(n) crossing number with boundary checks.
+Location naive_locate(const vector<PointI>& poly, PointI p) {
+    int n = poly.size();
+    bool in = false;
+    for (int i = 0; i < n; i++) {
+        PointI a = poly[i], b = poly[(i + 1) % n];
+        if (orientation(a, b, p) == 0 && (p - a).dot(p - b) <= 0) return Location::boundary;
+        if ((a.y > p.y) != (b.y > p.y)) {
+            // edge crosses the horizontal line through p: is the crossing right of p?
+            int o = orientation(a, b, p);
+            if ((b.y > a.y) == (o > 0)) in = !in;
+        }
+    }
+    return in ? Location::inside : Location::outside;
+}
+
+// Simple polygon: random points sorted by angle around the origin.
+vector<PointI> random_star(StressTester& stress, int n, int range) {
+    while (true) {
+        vector<PointI> p;
+        for (int i = 0; i < n; i++) {
+            PointI q{stress.random_int(-range, range), stress.random_int(-range, range)};
+            if (q != PointI{0, 0}) p.push_back(q);
+        }
+        auto half = [](PointI q) { return q.y < 0 || (q.y == 0 && q.x < 0); };
+        sort(p.begin(), p.end(), [&](PointI a, PointI b) {
+            if (half(a) != half(b)) return half(a) < half(b);
+            return a.cross(b) > 0;
+        });
+        vector<PointI> poly;
+        for (auto& q : p)   // one point per direction
+            if (poly.empty() || poly.back().cross(q) != 0 || poly.back().dot(q) < 0) poly.push_back(q);
+        if (poly.size() >= 2 && poly.back().cross(poly[0]) == 0 && poly.back().dot(poly[0]) > 0) poly.pop_back();
+        bool ok = poly.size() >= 3;
+        for (size_t i = 0; ok && i < poly.size(); i++)   // every turn around the origin below 180 degrees
+            ok = poly[i].cross(poly[(i + 1) % poly.size()]) > 0;
+        if (ok) return poly;
+    }
+}
+
+void test_polygon_basic(TestRunner& runner) {
+    runner.set_module("Polygon - Basic");
+
+    runner.test("Area and perimeter", []() {
+        vector<PointI> sq = {{0, 0}, {4, 0}, {4, 3}, {0, 3}};
+        ASSERT_TRUE(area2(sq) == 24);
+        ASSERT_NEAR(12.0, area(sq), 1e-12);
+        ASSERT_NEAR(14.0, perimeter(sq), 1e-12);
+        reverse(sq.begin(), sq.end());
+        ASSERT_TRUE(area2(sq) == -24);
+        return true;
+    });
+
+    runner.test("Locate in a concave polygon with vertical edges", []() {
+        vector<PointI> poly = {{0, 0}, {4, 0}, {4, 4}, {2, 1}, {0, 4}};
+        PolygonIndex<long long> idx(poly);
+        ASSERT_TRUE(idx.locate({2, 3}) == Location::outside);
+        ASSERT_TRUE(idx.locate({1, 1}) == Location::inside);
+        ASSERT_TRUE(idx.locate({4, 2}) == Location::boundary);
+        ASSERT_TRUE(idx.locate({2, 1}) == Location::boundary);
+        ASSERT_TRUE(idx.locate({0, 4}) == Location::boundary);
+        ASSERT_TRUE(idx.locate({2, 0}) == Location::boundary);
+        ASSERT_TRUE(idx.locate({5, 0}) == Location::outside);
+        ASSERT_TRUE(idx.locate({2, -1}) == Location::outside);
+        ConvexPolygon<long long> cp(vector<PointI>{{0, 0}, {4, 0}, {4, 4}, {0, 4}});
+        ASSERT_TRUE(cp.locate({2, 2}) == Location::inside);
+        ASSERT_TRUE(cp.locate({0, 2}) == Location::boundary);
+        ASSERT_TRUE(cp.locate({-1, 0}) == Location::outside);
+        ASSERT_TRUE(cp.locate({5, 0}) == Location::outside);
+        return true;
+    });
+}
+
+void stress_test_polygon(TestRunner& runner) {
+    runner.set_module("Polygon - Stress Testing");
+
+    runner.test("PolygonIndex vs naive on random simple polygons", []() {
+        StressTester stress;
+        for (int t = 0; t < 300; t++) {
+            int range = stress.random_int(2, t < 200 ? 6 : 1000);
+            auto poly = random_star(stress, stress.random_int(3, 40), range);
+            if (stress.random_int(0, 1)) reverse(poly.begin(), poly.end());
+            PolygonIndex<long long> idx(poly);
+            vector<PointI> qs;
+            for (int q = 0; q < 200; q++)
+                qs.push_back({stress.random_int(-range - 1, range + 1), stress.random_int(-range - 1, range + 1)});
+            for (auto& v : poly) qs.push_back(v);
+            auto batch = idx.locate_batch(qs);
+            for (size_t q = 0; q < qs.size(); q++) {
+                Location expect = naive_locate(poly, qs[q]);
+                if (idx.locate(qs[q]) != expect || batch[q] != expect) return false;
+            }
+        }
+        return true;
+    });
+
+    runner.test("ConvexPolygon vs naive on random hulls", []() {
+        StressTester stress;
+        for (int t = 0; t < 300; t++) {
+            int range = stress.random_int(1, t < 200 ? 5 : 1000);
+            vector<PointI> pts(stress.random_int(1, 50));
+            for (auto& p : pts) p = {stress.random_int(-range, range), stress.random_int(-range, range)};
+            auto hull = convex_hull(pts);
+            ConvexPolygon<long long> cp(hull);
+            for (int q = 0; q < 200; q++) {
+                PointI p{stress.random_int(-range - 1, range + 1), stress.random_int(-range - 1, range + 1)};
+                Location expect = hull.size() >= 3 ? naive_locate(hull, p)
+                                  : (orientation(hull[0], hull.back(), p) == 0 && (p - hull[0]).dot(p - hull.back()) <= 0)
+                                      ? Location::boundary
+                                      : Location::outside;
+                if (cp.locate(p) != expect) return false;
+            }
+        }
+        return true;
+    });
+
+    runner.test("Parallel batch matches sequential", []() {
+        StressTester stress;
+        auto poly = random_star(stress, 300, 100000);
+        PolygonIndex<long long> idx(poly);
+        vector<PointI> qs(100000);
+        for (auto& p : qs) p = {stress.random_int(-100001, 100001), stress.random_int(-100001, 100001)};
+        ASSERT_TRUE(idx.locate_batch(qs, 4) == idx.locate_batch(qs, 1));
+        return true;
+    });
+}
+
+void test_polygon_performance(TestRunner& runner) {
+    runner.set_module("Polygon - Performance");
+
+    runner.test("10^6 queries against a 1000-gon", []() {
+        StressTester stress;
+        auto poly = random_star(stress, 1000, 1000000000);
+        PolygonIndex<long long> idx(poly);
+        vector<PointI> qs(1000000);
+        for (auto& p : qs) p = {stress.random_int(-1000000000, 1000000000), stress.random_int(-1000000000, 1000000000)};
+        auto res = idx.locate_batch(qs);
+        ASSERT_TRUE(count(res.begin(), res.end(), Location::inside) > 0);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_polygon_basic(runner);
+    stress_test_polygon(runner);
+    test_polygon_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
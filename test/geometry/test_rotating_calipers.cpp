@@ -0,0 +1,123 @@
+#include "../test_runner.h"
+#include "geometry/rotating_calipers.hpp"
+#include "geometry/convex_hull.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Naive reference implementations: all pairs / every vertex for every edge.
+__int128 naive_diameter2(const vector<PointI>& h) {
+    __int128 best = 0;
+    for (auto& a : h)
+        for (auto& b : h) best = max(best, (a - b).norm2());
+    return best;
+}
+
+double naive_width(const vector<PointI>& h) {
+    int n = h.size();
+    if (n < 3) return 0;
+    long double best = 1e300;
+    for (int i = 0; i < n; i++) {
+        PointI a = h[i], b = h[(i + 1) % n];
+        __int128 far = 0;
+        for (auto& p : h) far = max(far, cross(a, b, p));
+        best = min(best, (long double)far / sqrtl((long double)(b - a).norm2()));
+    }
+    return double(best);
+}
+
+// Convex polygon with n vertices: random edge vectors sorted by angle, chained.
+vector<PointI> random_convex(mt19937_64& rng, int n, long long range) {
+    auto coord = [&]() { return (long long)(rng() % (2 * range + 1)) - range; };
+    vector<PointI> e(n);
+    PointI sum;
+    for (auto& v : e) v = {coord(), coord()}, sum = sum + v;
+    e.push_back(-sum);
+    auto half = [](PointI q) { return q.y < 0 || (q.y == 0 && q.x < 0); };
+    sort(e.begin(), e.end(), [&](PointI a, PointI b) {
+        if (half(a) != half(b)) return half(a) < half(b);
+        return a.cross(b) > 0;
+    });
+    vector<PointI> poly = {{0, 0}};
+    for (auto& v : e) poly.push_back(poly.back() + v);
+    return convex_hull(poly);
+}
+
+void test_rotating_calipers_basic(TestRunner& runner) {
+    runner.set_module("Rotating calipers - Basic");
+
+    runner.test("Diameter and width of small polygons", []() {
+        vector<PointI> rect = {{0, 0}, {4, 0}, {4, 3}, {0, 3}};
+        auto d = hull_diameter(rect);
+        ASSERT_TRUE(d.dist2 == 25);
+        ASSERT_TRUE((d.a - d.b).norm2() == 25);
+        ASSERT_NEAR(hull_width(rect), 3.0, 1e-12);
+        vector<PointI> tri = {{0, 0}, {6, 0}, {3, 4}};
+        ASSERT_NEAR(hull_width(tri), 4.0, 1e-12);
+        ASSERT_TRUE(hull_diameter(tri).dist2 == 36);
+        return true;
+    });
+
+    runner.test("Degenerate hulls", []() {
+        ASSERT_TRUE(hull_diameter(vector<PointI>{}).dist2 == 0);
+        ASSERT_TRUE(hull_diameter(vector<PointI>{{5, 5}}).dist2 == 0);
+        auto d = hull_diameter(vector<PointI>{{0, 0}, {3, 4}});
+        ASSERT_TRUE(d.dist2 == 25);
+        ASSERT_NEAR(hull_width(vector<PointI>{{0, 0}, {3, 4}}), 0.0, 1e-12);
+        return true;
+    });
+}
+
+void stress_test_rotating_calipers(TestRunner& runner) {
+    runner.set_module("Rotating calipers - Stress Testing");
+
+    runner.test("Random hulls vs naive", []() {
+        StressTester stress;
+        for (int t = 0; t < 500; t++) {
+            int range = stress.random_int(1, t < 300 ? 10 : 1000000);
+            vector<PointI> pts(stress.random_int(1, 60));
+            for (auto& p : pts) p = {stress.random_int(-range, range), stress.random_int(-range, range)};
+            auto h = convex_hull(pts);
+            auto d = hull_diameter(h);
+            if (d.dist2 != naive_diameter2(h) || (d.a - d.b).norm2() != d.dist2) return false;
+            double w = hull_width(h), expect = naive_width(h);
+            if (abs(w - expect) > 1e-9 * max(1.0, expect)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Huge coordinates", []() {
+        mt19937_64 rng(45);
+        for (int t = 0; t < 50; t++) {
+            auto h = random_convex(rng, 200, 1LL << 52);
+            if (hull_diameter(h).dist2 != naive_diameter2(h)) return false;
+            double w = hull_width(h), expect = naive_width(h);
+            if (abs(w - expect) > 1e-9 * expect) return false;
+        }
+        return true;
+    });
+}
+
+void test_rotating_calipers_performance(TestRunner& runner) {
+    runner.set_module("Rotating calipers - Performance");
+
+    runner.test("10^6-vertex polygon", []() {
+        mt19937_64 rng(1);
+        auto h = random_convex(rng, 1000000, 1000000000);
+        ASSERT_TRUE(h.size() > 900000);
+        auto d = hull_diameter(h);
+        double w = hull_width(h);
+        ASSERT_TRUE(w > 0 && w * w <= double(d.dist2));
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_rotating_calipers_basic(runner);
+    stress_test_rotating_calipers(runner);
+    test_rotating_calipers_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
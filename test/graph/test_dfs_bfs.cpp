@@ -0,0 +1,192 @@
+#include "../test_runner.h"
+#include "graph/dfs_bfs.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Naive helpers for comparison
+vector<vector<int>> to_adj(int n, const vector<pair<int, int>>& edges, bool undirected) {
+    vector<vector<int>> adj(n);
+    for (auto [u, v] : edges) {
+        adj[u].push_back(v);
+        if (undirected) adj[v].push_back(u);
+    }
+    return adj;
+}
+
+vector<char> reachable(const vector<vector<int>>& adj, int src, int banned_vertex = -1) {
+    vector<char> seen(adj.size(), 0);
+    if (src == banned_vertex) return seen;
+    vector<int> st = {src};
+    seen[src] = 1;
+    while (!st.empty()) {
+        int v = st.back();
+        st.pop_back();
+        for (int to : adj[v])
+            if (!seen[to] && to != banned_vertex) {
+                seen[to] = 1;
+                st.push_back(to);
+            }
+    }
+    return seen;
+}
+
+int count_components(int n, const vector<pair<int, int>>& edges, int banned_edge = -1, int banned_vertex = -1) {
+    vector<pair<int, int>> kept;
+    for (int i = 0; i < int(edges.size()); i++)
+        if (i != banned_edge) kept.push_back(edges[i]);
+    auto adj = to_adj(n, kept, true);
+    vector<char> seen(n, 0);
+    int comps = 0;
+    for (int v = 0; v < n; v++) {
+        if (seen[v] || v == banned_vertex) continue;
+        comps++;
+        auto r = reachable(adj, v, banned_vertex);
+        for (int u = 0; u < n; u++) if (r[u]) seen[u] = 1;
+    }
+    return comps;
+}
+
+vector<pair<int, int>> random_edge_list(StressTester& stress, int n, int m) {
+    vector<pair<int, int>> edges(m);
+    for (auto& [u, v] : edges) {
+        u = stress.random_int(0, n - 1);
+        v = stress.random_int(0, n - 1);
+    }
+    return edges;
+}
+
+void test_csr_and_dfs(TestRunner& runner) {
+    runner.set_module("DFS/BFS - CSR and DFS order");
+
+    runner.test("CSR layout and transpose", []() {
+        CSRGraph g(4, {{0, 1}, {0, 2}, {2, 3}, {1, 3}});
+        ASSERT_EQ(g.degree(0), 2);
+        ASSERT_EQ(g.degree(3), 0);
+        ASSERT_EQ(g.num_arcs(), 4);
+        auto t = g.transpose();
+        ASSERT_EQ(t.degree(3), 2);
+        ASSERT_EQ(t.neighbors(3)[0], 2);
+        ASSERT_EQ(t.neighbors(3)[1], 1);
+        return true;
+    });
+
+    runner.test("Pre/post order", []() {
+        CSRGraph g(5, {{0, 1}, {1, 2}, {0, 3}, {4, 0}});
+        auto o = dfs_order(g);
+        ASSERT_TRUE(o.pre == vector<int>({0, 1, 2, 3, 4}));
+        ASSERT_TRUE(o.post == vector<int>({2, 1, 3, 0, 4}));
+        ASSERT_EQ(o.parent[2], 1);
+        ASSERT_EQ(o.parent[4], -1);
+        auto r = dfs_order(g, 1);
+        ASSERT_TRUE(r.pre == vector<int>({1, 2}));
+        return true;
+    });
+
+    runner.test("Deep path without recursion", []() {
+        const int n = 2000000;
+        vector<pair<int, int>> edges;
+        for (int i = 0; i + 1 < n; i++) edges.push_back({i, i + 1});
+        CSRGraph g(n, edges, true);
+        auto o = dfs_order(g, 0);
+        ASSERT_EQ(o.post[0], n - 1);
+        ASSERT_EQ(int(low_link(g).bridges.size()), n - 1);
+        CSRGraph d(n, edges);
+        ASSERT_EQ(strongly_connected_components(d).first, n);
+        return true;
+    });
+}
+
+void test_low_link_and_scc(TestRunner& runner) {
+    runner.set_module("DFS/BFS - Low-link and SCC");
+
+    runner.test("Bridges with multi-edges", []() {
+        // 0-1 doubled (not a bridge), 1-2 bridge, 2-3-4 triangle, 4-5 bridge
+        vector<pair<int, int>> edges = {{0, 1}, {1, 0}, {1, 2}, {2, 3}, {3, 4}, {4, 2}, {4, 5}};
+        auto ll = low_link(CSRGraph(6, edges, true));
+        ASSERT_TRUE(ll.bridges == vector<int>({2, 6}));
+        ASSERT_TRUE(ll.articulation_points == vector<int>({1, 2, 4}));
+        return true;
+    });
+
+    runner.test("SCC topological numbering", []() {
+        CSRGraph g(6, {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 3}, {5, 4}});
+        auto [cnt, comp] = strongly_connected_components(g);
+        ASSERT_EQ(cnt, 3);
+        ASSERT_EQ(comp[0], comp[2]);
+        ASSERT_EQ(comp[3], comp[4]);
+        ASSERT_TRUE(comp[0] < comp[3]);
+        ASSERT_TRUE(comp[5] < comp[4]);
+        return true;
+    });
+}
+
+void stress_test_traversals(TestRunner& runner) {
+    runner.set_module("DFS/BFS - Stress Testing");
+
+    runner.test("Bridges/articulation points vs removal", []() {
+        StressTester stress;
+        for (int t = 0; t < 150; t++) {
+            int n = stress.random_int(1, 12);
+            auto edges = random_edge_list(stress, n, stress.random_int(0, 18));
+            auto ll = low_link(CSRGraph(n, edges, true));
+            int base = count_components(n, edges);
+            vector<int> bridges, cuts;
+            for (int i = 0; i < int(edges.size()); i++)
+                if (count_components(n, edges, i) > base) bridges.push_back(i);
+            for (int v = 0; v < n; v++) {
+                int isolated = 1;
+                for (auto [a, b] : edges) if ((a == v || b == v) && a != b) isolated = 0;
+                if (count_components(n, edges, -1, v) > base - isolated) cuts.push_back(v);
+            }
+            if (ll.bridges != bridges || ll.articulation_points != cuts) return false;
+        }
+        return true;
+    });
+
+    runner.test("SCC vs mutual reachability", []() {
+        StressTester stress;
+        for (int t = 0; t < 150; t++) {
+            int n = stress.random_int(1, 15);
+            auto edges = random_edge_list(stress, n, stress.random_int(0, 30));
+            auto adj = to_adj(n, edges, false);
+            auto [cnt, comp] = strongly_connected_components(CSRGraph(n, edges));
+            vector<vector<char>> r(n);
+            for (int v = 0; v < n; v++) r[v] = reachable(adj, v);
+            for (int u = 0; u < n; u++)
+                for (int v = 0; v < n; v++)
+                    if ((comp[u] == comp[v]) != (r[u][v] && r[v][u])) return false;
+            for (auto [u, v] : edges)
+                if (comp[u] > comp[v]) return false;
+            if (cnt != *max_element(comp.begin(), comp.end()) + 1) return false;
+        }
+        return true;
+    });
+
+    runner.test("Direction-optimizing BFS vs top-down", []() {
+        StressTester stress;
+        for (int t = 0; t < 100; t++) {
+            int n = stress.random_int(1, 3000);
+            bool undirected = t % 2;
+            auto edges = random_edge_list(stress, n, stress.random_int(0, 8 * n));
+            CSRGraph g(n, edges, undirected);
+            CSRGraph in = undirected ? g : g.transpose();
+            int src = stress.random_int(0, n - 1);
+            auto expected = bfs(g, src);
+            if (bfs_direction_optimizing(g, in, src) != expected) return false;
+            if (bfs_direction_optimizing(g, in, src, 3) != expected) return false;
+            if (bfs_direction_optimizing(g, in, src, 2, 1, 1) != expected) return false;
+        }
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_csr_and_dfs(runner);
+    test_low_link_and_scc(runner);
+    stress_test_traversals(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,124 @@
+#include "../test_runner.h"
+#include "graph/dijkstra.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Naive Bellman-Ford for comparison
+vector<long long> naive_shortest_paths(const vector<vector<pair<int, long long>>>& adj, int src) {
+    const long long INF = numeric_limits<long long>::max();
+    int n = adj.size();
+    vector<long long> dist(n, INF);
+    dist[src] = 0;
+    for (int it = 0; it < n; it++)
+        for (int u = 0; u < n; u++)
+            if (dist[u] != INF)
+                for (auto [v, w] : adj[u])
+                    dist[v] = min(dist[v], dist[u] + w);
+    return dist;
+}
+
+void test_heaps(TestRunner& runner) {
+    runner.set_module("Dijkstra - Heaps");
+
+    runner.test("DaryHeap push/pop/decrease-key", []() {
+        DaryHeap<int> heap(6);
+        heap.push(0, 50);
+        heap.push(1, 20);
+        heap.push(2, 40);
+        heap.push(3, 10);
+        heap.push(2, 5);     // decrease
+        heap.push(1, 100);   // not a decrease, ignored
+        ASSERT_EQ(heap.size(), 4);
+        ASSERT_EQ(heap.pop().second, 2);
+        ASSERT_EQ(heap.pop().second, 3);
+        ASSERT_EQ(heap.pop().first, 20);
+        ASSERT_TRUE(heap.contains(0));
+        heap.clear();
+        ASSERT_TRUE(heap.empty());
+        ASSERT_FALSE(heap.contains(0));
+        return true;
+    });
+
+    runner.test("RadixHeap monotone pops", []() {
+        RadixHeap<long long> heap;
+        heap.push(0, 7);
+        heap.push(1, 3);
+        heap.push(2, 3);
+        heap.push(3, 1000000000000LL);
+        ASSERT_EQ(heap.pop().first, 3);
+        heap.push(4, 5);
+        ASSERT_EQ(heap.pop().first, 3);
+        ASSERT_EQ(heap.pop().first, 5);
+        ASSERT_EQ(heap.pop().first, 7);
+        ASSERT_EQ(heap.pop().second, 3);
+        ASSERT_TRUE(heap.empty());
+        return true;
+    });
+}
+
+void test_dijkstra(TestRunner& runner) {
+    runner.set_module("Dijkstra - Shortest Paths");
+
+    runner.test("Small graph with parents", []() {
+        vector<vector<pair<int, long long>>> adj(5);
+        adj[0] = {{1, 4}, {2, 1}};
+        adj[2] = {{1, 2}, {3, 7}};
+        adj[1] = {{3, 1}};
+        vector<int> par;
+        auto dist = dijkstra(adj, 0, &par);
+        ASSERT_EQ(dist[0], 0);
+        ASSERT_EQ(dist[1], 3);
+        ASSERT_EQ(dist[2], 1);
+        ASSERT_EQ(dist[3], 4);
+        ASSERT_EQ(dist[4], numeric_limits<long long>::max());
+        ASSERT_EQ(par[3], 1);
+        ASSERT_EQ(par[1], 2);
+        ASSERT_EQ(par[0], -1);
+        return true;
+    });
+
+    runner.test("Dense Dijkstra on matrix", []() {
+        vector<vector<long long>> w = {
+            {-1, 4, 1, -1},
+            {-1, -1, -1, 1},
+            {-1, 2, -1, 7},
+            {-1, -1, -1, -1},
+        };
+        auto dist = dijkstra_dense(w, 0);
+        ASSERT_EQ(dist[1], 3);
+        ASSERT_EQ(dist[3], 4);
+        return true;
+    });
+}
+
+void stress_test_dijkstra(TestRunner& runner) {
+    runner.set_module("Dijkstra - Stress Testing");
+
+    runner.test("All heaps vs Bellman-Ford", []() {
+        StressTester stress;
+        for (int t = 0; t < 100; t++) {
+            int n = stress.random_int(1, 40);
+            int m = stress.random_int(0, n * 3);
+            vector<vector<pair<int, long long>>> adj(n);
+            for (int i = 0; i < m; i++)
+                adj[stress.random_int(0, n - 1)].push_back({stress.random_int(0, n - 1), stress.random_ll(0, 1000)});
+            int src = stress.random_int(0, n - 1);
+            auto expected = naive_shortest_paths(adj, src);
+            if (dijkstra(adj, src) != expected) return false;
+            if ((dijkstra<long long, RadixHeap<long long>>(adj, src)) != expected) return false;
+            if ((dijkstra<long long, LazyBinaryHeap<long long>>(adj, src)) != expected) return false;
+        }
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_heaps(runner);
+    test_dijkstra(runner);
+    stress_test_dijkstra(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,206 @@
+#include "../test_runner.h"
+#include "graph/flow.hpp"
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+using namespace std;
+
+using MCF = MinCostFlow<int, long long>;
+
+// Brute-force assignment: minimum cost perfect matching over all permutations
+long long naive_assignment(const vector<vector<long long>>& c) {
+    int n = c.size();
+    vector<int> perm(n);
+    iota(perm.begin(), perm.end(), 0);
+    long long best = LLONG_MAX;
+    do {
+        long long s = 0;
+        for (int i = 0; i < n; i++) s += c[i][perm[i]];
+        best = min(best, s);
+    } while (next_permutation(perm.begin(), perm.end()));
+    return best;
+}
+
+// Min-cost flow with Bellman-Ford on every augmentation
+pair<int, long long> naive_min_cost_flow(int n, const vector<tuple<int, int, int, long long>>& edges, int s, int t) {
+    struct E { int to, rev, cap; long long cost; };
+    vector<vector<E>> g(n);
+    for (auto [u, v, cap, cost] : edges) {
+        g[u].push_back({v, int(g[v].size()) + (u == v), cap, cost});
+        g[v].push_back({u, int(g[u].size()) - 1, 0, -cost});
+    }
+    int flow = 0;
+    long long cost = 0;
+    while (true) {
+        vector<long long> dist(n, LLONG_MAX);
+        vector<pair<int, int>> prev(n, {-1, -1});
+        dist[s] = 0;
+        for (int it = 0; it < n; it++)
+            for (int u = 0; u < n; u++)
+                if (dist[u] != LLONG_MAX)
+                    for (int i = 0; i < int(g[u].size()); i++)
+                        if (g[u][i].cap > 0 && dist[u] + g[u][i].cost < dist[g[u][i].to]) {
+                            dist[g[u][i].to] = dist[u] + g[u][i].cost;
+                            prev[g[u][i].to] = {u, i};
+                        }
+        if (dist[t] == LLONG_MAX) break;
+        int c = INT_MAX;
+        for (int v = t; v != s; v = prev[v].first) c = min(c, g[prev[v].first][prev[v].second].cap);
+        for (int v = t; v != s; v = prev[v].first) {
+            auto& e = g[prev[v].first][prev[v].second];
+            e.cap -= c;
+            g[v][e.rev].cap += c;
+        }
+        flow += c;
+        cost += c * dist[t];
+    }
+    return {flow, cost};
+}
+
+void test_max_flow(TestRunner& runner) {
+    runner.set_module("Flow - MaxFlow");
+
+    runner.test("Classic network", []() {
+        MaxFlow<int> mf(6);
+        mf.add_edge(0, 1, 16);
+        mf.add_edge(0, 2, 13);
+        mf.add_edge(1, 2, 10);
+        mf.add_edge(2, 1, 4);
+        mf.add_edge(1, 3, 12);
+        mf.add_edge(3, 2, 9);
+        mf.add_edge(2, 4, 14);
+        mf.add_edge(4, 3, 7);
+        mf.add_edge(3, 5, 20);
+        int e = mf.add_edge(4, 5, 4);
+        ASSERT_EQ(mf.flow(0, 5), 23);
+        ASSERT_EQ(mf.get_edge(e).flow, 4);
+        auto cut = mf.min_cut(0);
+        ASSERT_TRUE(cut[0]);
+        ASSERT_FALSE(cut[5]);
+        return true;
+    });
+}
+
+void test_min_cost_flow(TestRunner& runner) {
+    runner.set_module("Flow - MinCostFlow");
+
+    runner.test("Small network, all strategies", []() {
+        for (auto strategy : {MCF::Strategy::DaryHeap, MCF::Strategy::RadixHeap, MCF::Strategy::Dense}) {
+            MCF mcf(4);
+            mcf.add_edge(0, 1, 2, 1);
+            mcf.add_edge(0, 2, 1, 2);
+            mcf.add_edge(1, 2, 1, 1);
+            mcf.add_edge(1, 3, 1, 3);
+            int e = mcf.add_edge(2, 3, 2, 1);
+            auto [f, c] = mcf.flow(0, 3, numeric_limits<int>::max(), strategy);
+            ASSERT_EQ(f, 3);
+            ASSERT_EQ(c, 10);
+            ASSERT_EQ(mcf.get_edge(e).flow, 2);
+        }
+        return true;
+    });
+
+    runner.test("Flow limit and incremental calls", []() {
+        MCF mcf(3);
+        mcf.add_edge(0, 1, 5, 1);
+        mcf.add_edge(1, 2, 5, 1);
+        mcf.add_edge(0, 2, 5, 10);
+        auto [f1, c1] = mcf.flow(0, 2, 4);
+        ASSERT_EQ(f1, 4);
+        ASSERT_EQ(c1, 8);
+        auto [f2, c2] = mcf.flow(0, 2, 3);
+        ASSERT_EQ(f2, 3);
+        ASSERT_EQ(c2, 2 + 20);
+        return true;
+    });
+
+    runner.test("Negative costs", []() {
+        MCF mcf(4);
+        mcf.add_edge(0, 1, 1, -5);
+        mcf.add_edge(0, 2, 1, 2);
+        mcf.add_edge(1, 3, 1, 1);
+        mcf.add_edge(2, 3, 1, -1);
+        auto [f, c] = mcf.flow(0, 3);
+        ASSERT_EQ(f, 2);
+        ASSERT_EQ(c, -3);
+        return true;
+    });
+
+    runner.test("Cost scaling on small network", []() {
+        MCF mcf(4);
+        mcf.add_edge(0, 1, 2, 1);
+        mcf.add_edge(0, 2, 1, 2);
+        mcf.add_edge(1, 2, 1, 1);
+        mcf.add_edge(1, 3, 1, 3);
+        mcf.add_edge(2, 3, 2, 1);
+        auto [f, c] = mcf.flow_cost_scaling(0, 3);
+        ASSERT_EQ(f, 3);
+        ASSERT_EQ(c, 10);
+        return true;
+    });
+}
+
+void stress_test_flow(TestRunner& runner) {
+    runner.set_module("Flow - Stress Testing");
+
+    runner.test("Assignment vs brute force", []() {
+        StressTester stress;
+        for (int t = 0; t < 100; t++) {
+            int n = stress.random_int(1, 6);
+            vector<vector<long long>> c(n, vector<long long>(n));
+            MCF mcf(2 * n + 2);
+            int s = 2 * n, tt = 2 * n + 1;
+            for (int i = 0; i < n; i++) {
+                mcf.add_edge(s, i, 1, 0);
+                mcf.add_edge(n + i, tt, 1, 0);
+                for (int j = 0; j < n; j++) {
+                    c[i][j] = stress.random_ll(0, 1000000000LL);
+                    mcf.add_edge(i, n + j, 1, c[i][j]);
+                }
+            }
+            long long expected = naive_assignment(c);
+            MCF copy = mcf;
+            if (mcf.flow(s, tt) != make_pair(n, expected)) return false;
+            if (copy.flow_cost_scaling(s, tt) != make_pair(n, expected)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Random networks vs Bellman-Ford SSP", []() {
+        StressTester stress;
+        for (int t = 0; t < 200; t++) {
+            int n = stress.random_int(2, 12);
+            int m = stress.random_int(0, 30);
+            vector<tuple<int, int, int, long long>> edges;
+            for (int i = 0; i < m; i++) {
+                int u = stress.random_int(0, n - 1), v = stress.random_int(0, n - 1);
+                if (u == v) continue;
+                edges.push_back({u, v, stress.random_int(0, 10), stress.random_ll(0, 100)});
+            }
+            auto expected = naive_min_cost_flow(n, edges, 0, n - 1);
+            for (auto strategy : {MCF::Strategy::DaryHeap, MCF::Strategy::RadixHeap, MCF::Strategy::Dense}) {
+                MCF mcf(n);
+                for (auto [u, v, cap, cost] : edges) mcf.add_edge(u, v, cap, cost);
+                if (mcf.flow(0, n - 1, numeric_limits<int>::max(), strategy) != expected) return false;
+            }
+            MCF mcf(n);
+            for (auto [u, v, cap, cost] : edges) mcf.add_edge(u, v, cap, cost);
+            if (mcf.flow_cost_scaling(0, n - 1) != expected) return false;
+
+            MaxFlow<int> mf(n);
+            for (auto [u, v, cap, cost] : edges) mf.add_edge(u, v, cap);
+            if (mf.flow(0, n - 1) != expected.first) return false;
+        }
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_max_flow(runner);
+    test_min_cost_flow(runner);
+    stress_test_flow(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
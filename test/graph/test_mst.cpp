@@ -0,0 +1,138 @@
+#include "../test_runner.h"
+#include "graph/mst.hpp"
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+using namespace std;
+
+// Naive Kruskal with comparison sort on (w, index)
+template <typename W>
+SpanningForest<W> naive_mst(int n, const vector<WeightedEdge<W>>& edges) {
+    vector<int> ids(edges.size());
+    iota(ids.begin(), ids.end(), 0);
+    stable_sort(ids.begin(), ids.end(), [&](int a, int b) { return edges[a].w < edges[b].w; });
+    DSU dsu(n);
+    SpanningForest<W> res;
+    for (int id : ids)
+        if (dsu.unite(edges[id].u, edges[id].v)) {
+            res.edges.push_back(id);
+            res.weight += edges[id].w;
+        }
+    sort(res.edges.begin(), res.edges.end());
+    return res;
+}
+
+template <typename W>
+vector<WeightedEdge<W>> random_graph(StressTester& stress, int n, int m, W min_w, W max_w) {
+    vector<WeightedEdge<W>> edges(m);
+    for (auto& e : edges) {
+        e.u = stress.random_int(0, n - 1);
+        e.v = stress.random_int(0, n - 1);
+        e.w = W(stress.random_ll(min_w, max_w));
+    }
+    return edges;
+}
+
+void test_concurrent_dsu(TestRunner& runner) {
+    runner.set_module("MST - ConcurrentDSU");
+
+    runner.test("Sequential semantics", []() {
+        ConcurrentDSU dsu(6);
+        ASSERT_TRUE(dsu.unite(0, 1));
+        ASSERT_TRUE(dsu.unite(2, 3));
+        ASSERT_FALSE(dsu.unite(1, 0));
+        ASSERT_TRUE(dsu.unite(1, 3));
+        ASSERT_TRUE(dsu.sameComponent(0, 2));
+        ASSERT_FALSE(dsu.sameComponent(0, 5));
+        return true;
+    });
+
+    runner.test("Parallel unions", []() {
+        const int n = 1 << 14;
+        ConcurrentDSU dsu(n);
+        atomic<int> merges{0};
+        parallel_for(n - 1, 4, [&](long long b, long long e, int) {
+            for (long long i = b; i < e; i++)
+                if (dsu.unite(i, i + 1)) merges++;
+        });
+        ASSERT_EQ(merges.load(), n - 1);
+        ASSERT_TRUE(dsu.sameComponent(0, n - 1));
+        return true;
+    });
+}
+
+void test_mst_basic(TestRunner& runner) {
+    runner.set_module("MST - Basic");
+
+    runner.test("Triangle", []() {
+        vector<WeightedEdge<long long>> edges = {{0, 1, 5}, {1, 2, 3}, {0, 2, 4}};
+        for (auto f : {kruskal_mst(3, edges), filter_kruskal_mst(3, edges), boruvka_mst(3, edges, 2)}) {
+            ASSERT_EQ(f.weight, 7);
+            ASSERT_TRUE(f.edges == vector<int>({1, 2}));
+        }
+        return true;
+    });
+
+    runner.test("Forest with ties, self loops and negative weights", []() {
+        vector<WeightedEdge<int>> edges = {
+            {0, 1, 1}, {1, 2, 1}, {0, 2, 1}, {3, 3, -5}, {3, 4, -2}, {4, 5, -2}, {3, 5, -2},
+        };
+        for (auto f : {kruskal_mst(7, edges), filter_kruskal_mst(7, edges), boruvka_mst(7, edges, 3)}) {
+            ASSERT_EQ(f.weight, -2);
+            ASSERT_TRUE(f.edges == vector<int>({0, 1, 4, 5}));
+        }
+        return true;
+    });
+
+    runner.test("Floating point weights", []() {
+        vector<WeightedEdge<double>> edges = {{0, 1, 0.5}, {1, 2, -1.25}, {0, 2, 0.25}};
+        auto f = kruskal_mst(3, edges);
+        ASSERT_NEAR(f.weight, -1.0, 1e-12);
+        ASSERT_TRUE(f.edges == vector<int>({1, 2}));
+        return true;
+    });
+}
+
+void stress_test_mst(TestRunner& runner) {
+    runner.set_module("MST - Stress Testing");
+
+    runner.test("All algorithms return the same forest", []() {
+        StressTester stress;
+        for (int t = 0; t < 200; t++) {
+            int n = stress.random_int(1, 60);
+            int m = stress.random_int(0, 300);
+            long long max_w = t % 2 ? 5 : 1000000000000LL;
+            auto edges = random_graph<long long>(stress, n, m, -max_w, max_w);
+            auto expected = naive_mst(n, edges);
+            int threads = stress.random_int(1, 4);
+            auto k = kruskal_mst(n, edges, threads);
+            auto fk = filter_kruskal_mst(n, edges);
+            auto b = boruvka_mst(n, edges, threads);
+            if (k.edges != expected.edges || k.weight != expected.weight) return false;
+            if (fk.edges != expected.edges || fk.weight != expected.weight) return false;
+            if (b.edges != expected.edges || b.weight != expected.weight) return false;
+        }
+        return true;
+    });
+
+    runner.test("Large graph, parallel radix sort path", []() {
+        StressTester stress;
+        int n = 20000, m = 200000;
+        auto edges = random_graph<int>(stress, n, m, 0, 1000);
+        auto expected = naive_mst(n, edges);
+        ASSERT_TRUE(kruskal_mst(n, edges, 4).edges == expected.edges);
+        ASSERT_TRUE(filter_kruskal_mst(n, edges).edges == expected.edges);
+        ASSERT_TRUE(boruvka_mst(n, edges, 4).edges == expected.edges);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_concurrent_dsu(runner);
+    test_mst_basic(runner);
+    stress_test_mst(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
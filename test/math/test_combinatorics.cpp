@@ -0,0 +1,175 @@
+#include "../test_runner.h"
+#include "math/combinatorics.hpp"
+#include <vector>
+
+using namespace std;
+
+using mint = modint998244353;
+using comb = Combinatorics<mint>;
+
+// Naive reference implementations
+template <typename M>
+vector<vector<M>> pascal(int n) {
+    vector<vector<M>> c(n + 1, vector<M>(n + 1));
+    for (int i = 0; i <= n; i++) {
+        c[i][0] = 1;
+        for (int j = 1; j <= i; j++)
+            c[i][j] = c[i - 1][j - 1] + c[i - 1][j];
+    }
+    return c;
+}
+
+template <typename M>
+vector<M> naive_stirling1(int n) {
+    vector<M> row = {1};
+    for (int i = 0; i < n; i++) {   // multiply by (x + i)
+        vector<M> next(row.size() + 1);
+        for (int k = 0; k < int(row.size()); k++) {
+            next[k] += row[k] * M(i);
+            next[k + 1] += row[k];
+        }
+        row = next;
+    }
+    return row;
+}
+
+template <typename M>
+vector<M> naive_stirling2(int n) {
+    vector<vector<M>> s(n + 1, vector<M>(n + 1));
+    s[0][0] = 1;
+    for (int i = 1; i <= n; i++)
+        for (int k = 1; k <= i; k++)
+            s[i][k] = s[i - 1][k - 1] + M(k) * s[i - 1][k];
+    return s[n];
+}
+
+void test_combinatorics_basic(TestRunner& runner) {
+    runner.set_module("Combinatorics - Basic");
+
+    runner.test("Small values", []() {
+        ASSERT_EQ(comb::C(10, 3).val(), 120u);
+        ASSERT_EQ(comb::C(3, 10).val(), 0u);
+        ASSERT_EQ(comb::C(5, -1).val(), 0u);
+        ASSERT_EQ(comb::P(5, 2).val(), 20u);
+        ASSERT_EQ(comb::multichoose(3, 2).val(), 6u);
+        ASSERT_EQ(comb::multichoose(0, 0).val(), 1u);
+        ASSERT_EQ(comb::catalan(5).val(), 42u);
+        ASSERT_EQ(comb::factorial(10).val(), 3628800u);
+        ASSERT_TRUE(comb::inverse(7) * mint(7) == mint(1));
+        return true;
+    });
+
+    runner.test("Tables grow geometrically", []() {
+        comb::reset();
+        comb::C(100, 50);
+        ASSERT_EQ((int)comb::fact.size(), 101);
+        comb::C(102, 1);
+        ASSERT_EQ((int)comb::fact.size(), 202);
+        for (int i = 0; i < 202; i++)
+            if (comb::fact[i] * comb::inv_fact[i] != mint(1)) return false;
+        return true;
+    });
+
+    runner.test("Stirling rows", []() {
+        ASSERT_TRUE(comb::stirling2_row(5) == (vector<mint>{0, 1, 15, 25, 10, 1}));
+        ASSERT_TRUE(comb::stirling1_row(4) == (vector<mint>{0, 6, 11, 6, 1}));
+        ASSERT_TRUE(comb::stirling1_row(0) == (vector<mint>{1}));
+        ASSERT_TRUE(comb::stirling2_row(0) == (vector<mint>{1}));
+        return true;
+    });
+
+    runner.test("Lucas", []() {
+        LucasBinomial lucas(7);
+        ASSERT_EQ(lucas.C(10, 3), 120 % 7);
+        ASSERT_EQ(lucas.C(7, 3), 0);
+        ASSERT_EQ(lucas.C(3, 5), 0);
+        return true;
+    });
+}
+
+void stress_test_combinatorics(TestRunner& runner) {
+    runner.set_module("Combinatorics - Stress Testing");
+
+    runner.test("C, P and batch vs Pascal", []() {
+        StressTester stress;
+        comb::reset();
+        auto ref = pascal<mint>(500);
+        vector<pair<long long, long long>> qs;
+        for (int t = 0; t < 5000; t++) {
+            int n = stress.random_int(0, 500), k = stress.random_int(-2, 502);
+            mint expect = k >= 0 && k <= n ? ref[n][k] : mint(0);
+            if (comb::C(n, k) != expect) return false;
+            if (k >= 0 && k <= n && comb::P(n, k) != expect * comb::factorial(k)) return false;
+            qs.push_back({n, k});
+        }
+        auto batch = comb::binomials(qs);
+        for (size_t i = 0; i < qs.size(); i++)
+            if (batch[i] != comb::C(qs[i].first, qs[i].second)) return false;
+        return true;
+    });
+
+    runner.test("Stirling rows vs recurrences (NTT and arbitrary modulus)", []() {
+        using m7 = modint1000000007;
+        for (int n : {1, 2, 3, 17, 64, 65, 300}) {
+            if (comb::stirling1_row(n) != naive_stirling1<mint>(n)) return false;
+            if (comb::stirling2_row(n) != naive_stirling2<mint>(n)) return false;
+            if (Combinatorics<m7>::stirling1_row(n) != naive_stirling1<m7>(n)) return false;
+            if (Combinatorics<m7>::stirling2_row(n) != naive_stirling2<m7>(n)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Lucas vs Pascal mod small primes", []() {
+        StressTester stress;
+        for (int p : {2, 3, 5, 13, 101}) {
+            LucasBinomial lucas(p);
+            vector<vector<int>> c(301, vector<int>(301, 0));
+            for (int i = 0; i <= 300; i++) {
+                c[i][0] = 1;
+                for (int j = 1; j <= i; j++) c[i][j] = (c[i - 1][j - 1] + c[i - 1][j]) % p;
+            }
+            for (int t = 0; t < 500; t++) {
+                int n = stress.random_int(0, 300), k = stress.random_int(0, 300);
+                if (lucas.C(n, k) != (k <= n ? c[n][k] : 0)) return false;
+            }
+        }
+        return true;
+    });
+
+    runner.test("Dynamic modulus with reset", []() {
+        using dm = dynamic_modint<32>;
+        using dcomb = Combinatorics<dm>;
+        dm::set_mod(1000003);
+        dcomb::reset();
+        if (dcomb::C(1000, 500) != dm(LucasBinomial(1000003).C(1000, 500))) return false;
+        dm::set_mod(13);
+        dcomb::reset();
+        if (dcomb::C(12, 5).val() != 792 % 13) return false;
+        return true;
+    });
+}
+
+void test_combinatorics_performance(TestRunner& runner) {
+    runner.set_module("Combinatorics - Performance");
+
+    runner.test("Batch of 10^6 binomials up to 10^7", []() {
+        StressTester stress;
+        vector<pair<long long, long long>> qs(1000000);
+        for (auto& [n, k] : qs) {
+            n = stress.random_int(0, 10000000);
+            k = stress.random_int(0, n);
+        }
+        auto res = comb::binomials(qs);
+        ASSERT_TRUE(res[0] == comb::C(qs[0].first, qs[0].second));
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_combinatorics_basic(runner);
+    stress_test_combinatorics(runner);
+    test_combinatorics_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
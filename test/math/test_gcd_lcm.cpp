@@ -0,0 +1,167 @@
+#include "../test_runner.h"
+#include "data-structures/sparse_table.hpp"
+#include "math/gcd_lcm.hpp"
+#include <vector>
+
+using namespace std;
+
+// Naive reference implementations
+bool naive_is_prime(uint64_t n) {
+    if (n < 2) return false;
+    for (uint64_t d = 2; d * d <= n; d++)
+        if (n % d == 0) return false;
+    return true;
+}
+
+void test_gcd_lcm_basic(TestRunner& runner) {
+    runner.set_module("GCD/LCM - Basic");
+
+    runner.test("binary_gcd small values and signs", []() {
+        ASSERT_EQ(binary_gcd(12, 18), 6);
+        ASSERT_EQ(binary_gcd(0, 7), 7);
+        ASSERT_EQ(binary_gcd(7, 0), 7);
+        ASSERT_EQ(binary_gcd(0, 0), 0);
+        ASSERT_EQ(binary_gcd(-12, 18), 6);
+        ASSERT_EQ(binary_gcd(1ULL << 40, 3ULL << 20), 1ULL << 20);
+        ASSERT_EQ(binary_gcd(~0ULL, ~0ULL - 2), 1ULL);
+        return true;
+    });
+
+    runner.test("ext_gcd", []() {
+        auto [g, x, y] = ext_gcd(240LL, 46LL);
+        ASSERT_EQ(g, 2LL);
+        ASSERT_EQ(240 * x + 46 * y, 2LL);
+        auto [g2, x2, y2] = ext_gcd(0LL, -5LL);
+        ASSERT_EQ(g2, 5LL);
+        ASSERT_EQ(-5 * y2, 5LL);
+        return true;
+    });
+
+    runner.test("lcm with overflow handling", []() {
+        ASSERT_EQ(*checked_lcm(4, 6), 12);
+        ASSERT_EQ(*checked_lcm(0, 6), 0);
+        ASSERT_EQ(*checked_lcm(1LL << 40, 3LL << 30), 3LL << 40);
+        ASSERT_FALSE(checked_lcm(1000000007LL * 998244353, 1000000009LL).has_value());
+        ASSERT_EQ(capped_lcm(1LL << 40, 3LL << 30, 1000000LL), 1000000LL);
+        ASSERT_EQ(lcm_all(vector<int>{2, 3, 4, 5}), 60);
+        ASSERT_EQ(lcm_all(vector<long long>{1000000007, 998244353, 1000000009}, (long long)4e18), (long long)4e18);
+        ASSERT_EQ(gcd_all(vector<int>{12, 18, 24}), 6);
+        return true;
+    });
+
+    runner.test("Range gcd through RMQ", []() {
+        vector<int> a = {12, 18, 24, 7, 14};
+        RMQ<int, BinaryGcd> st(a, BinaryGcd());
+        ASSERT_EQ(st.get(0, 2), 6);
+        ASSERT_EQ(st.get(3, 4), 7);
+        ASSERT_EQ(st.get(0, 4), 1);
+        return true;
+    });
+
+    runner.test("Primality and factorization", []() {
+        ASSERT_TRUE(miller_rabin(1000000007));
+        ASSERT_FALSE(miller_rabin(1));
+        ASSERT_FALSE(miller_rabin(3215031751ULL));            // strong pseudoprime to 2, 3, 5, 7
+        ASSERT_TRUE(miller_rabin(18446744073709551557ULL));    // largest 64-bit prime
+        ASSERT_FALSE(miller_rabin(18446744073709551615ULL));
+        auto f = prime_factorize(600851475143ULL);
+        ASSERT_TRUE(f == (vector<pair<uint64_t, int>>{{71, 1}, {839, 1}, {1471, 1}, {6857, 1}}));
+        ASSERT_TRUE(prime_factors(0).empty());
+        ASSERT_TRUE(prime_factors(1).empty());
+        ASSERT_TRUE(prime_factorize(0).empty());
+        ASSERT_TRUE(prime_factorize(1).empty());
+        ASSERT_TRUE(prime_factors(1024) == vector<uint64_t>(10, 2));
+        return true;
+    });
+}
+
+void stress_test_gcd_lcm(TestRunner& runner) {
+    runner.set_module("GCD/LCM - Stress Testing");
+
+    runner.test("binary_gcd vs std::gcd", []() {
+        StressTester stress;
+        for (int t = 0; t < 200000; t++) {
+            long long a = stress.random_ll(LLONG_MIN / 2, LLONG_MAX / 2), b = stress.random_ll(LLONG_MIN / 2, LLONG_MAX / 2);
+            if (t % 3 == 0) {   // large common factor
+                long long g = stress.random_ll(1, 1 << 20);
+                a = a / (1 << 21) * g, b = b / (1 << 21) * g;
+            }
+            if (binary_gcd(a, b) != std::gcd(a, b)) return false;
+            uint32_t x = stress.random_int(0, INT_MAX), y = stress.random_int(0, INT_MAX);
+            if (binary_gcd(x, y) != std::gcd(x, y)) return false;
+            auto [g, p, q] = ext_gcd(a, b);
+            if (g != std::gcd(a, b) || (__int128)a * p + (__int128)b * q != g) return false;
+        }
+        return true;
+    });
+
+    runner.test("checked_lcm vs __int128", []() {
+        StressTester stress;
+        for (int t = 0; t < 100000; t++) {
+            long long a = stress.random_ll(0, 1LL << stress.random_int(1, 62));
+            long long b = stress.random_ll(0, 1LL << stress.random_int(1, 62));
+            __int128 l = a == 0 || b == 0 ? 0 : (__int128)a / std::gcd(a, b) * b;
+            auto r = checked_lcm(a, b);
+            if (l > LLONG_MAX ? r.has_value() : (!r || *r != l)) return false;
+        }
+        return true;
+    });
+
+    runner.test("miller_rabin vs trial division", []() {
+        StressTester stress;
+        for (uint64_t n = 0; n < 200000; n++)
+            if (miller_rabin(n) != naive_is_prime(n)) return false;
+        for (int t = 0; t < 2000; t++) {
+            uint64_t n = stress.random_ll(1, 1LL << 40);
+            if (miller_rabin(n) != naive_is_prime(n)) return false;
+        }
+        return true;
+    });
+
+    runner.test("prime_factors multiply back and are prime", []() {
+        StressTester stress;
+        for (int t = 0; t < 300; t++) {
+            uint64_t n;
+            if (t % 3 == 0) {
+                // semiprime of two ~32-bit primes (the hard case for rho)
+                auto next_prime = [](uint64_t x) { while (!miller_rabin(x)) x++; return x; };
+                n = next_prime(stress.random_ll(1, 1LL << 31)) * next_prime(stress.random_ll(1, 1LL << 31));
+            } else {
+                n = (uint64_t)stress.random_ll(1, LLONG_MAX) * (t % 3 == 1 ? 2 : 1) + (t & 1);
+            }
+            auto f = prime_factors(n);
+            if (!is_sorted(f.begin(), f.end())) return false;
+            unsigned __int128 prod = 1;
+            for (auto p : f) {
+                if (!miller_rabin(p)) return false;
+                prod *= p;
+            }
+            if (prod != n) return false;
+        }
+        return true;
+    });
+}
+
+void test_gcd_lcm_performance(TestRunner& runner) {
+    runner.set_module("GCD/LCM - Performance");
+
+    runner.test("Factorize 1000 random 62-bit numbers", []() {
+        StressTester stress;
+        for (int t = 0; t < 1000; t++) {
+            uint64_t n = stress.random_ll(1LL << 61, LLONG_MAX / 2);
+            uint64_t prod = 1;
+            for (auto p : prime_factors(n)) prod *= p;
+            if (prod != n) return false;
+        }
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_gcd_lcm_basic(runner);
+    stress_test_gcd_lcm(runner);
+    test_gcd_lcm_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
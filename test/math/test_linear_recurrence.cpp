@@ -0,0 +1,109 @@
+#include "../test_runner.h"
+#include "math/linear_recurrence.hpp"
+#include "math/matrix.hpp"
+#include <vector>
+
+using namespace std;
+
+using mint = modint998244353;
+
+// Naive reference: iterate the recurrence
+vector<mint> naive_terms(const vector<mint>& c, const vector<mint>& init, int n) {
+    vector<mint> s(init.begin(), init.begin() + c.size());
+    while (int(s.size()) < n) {
+        mint x = 0;
+        for (int j = 0; j < int(c.size()); j++)
+            x += c[j] * s[s.size() - 1 - j];
+        s.push_back(x);
+    }
+    return s;
+}
+
+void test_linear_recurrence_basic(TestRunner& runner) {
+    runner.set_module("Linear Recurrence - Basic");
+
+    runner.test("Fibonacci", []() {
+        vector<mint> fib = {0, 1, 1, 2, 3, 5, 8, 13};
+        auto c = berlekamp_massey(fib);
+        ASSERT_TRUE(c == (vector<mint>{1, 1}));
+        ASSERT_EQ(kitamasa(c, {0, 1}, 10).val(), 55u);
+        ASSERT_EQ(linear_recurrence_nth(fib, 90).val(), (unsigned)(2880067194370816120ULL % 998244353));
+        return true;
+    });
+
+    runner.test("Degenerate sequences", []() {
+        ASSERT_TRUE(berlekamp_massey(vector<mint>{0, 0, 0}).empty());
+        ASSERT_EQ(linear_recurrence_nth(vector<mint>{0, 0, 0}, 100).val(), 0u);
+        auto c = berlekamp_massey(vector<mint>{3, 6, 12, 24});
+        ASSERT_TRUE(c == (vector<mint>{2}));
+        ASSERT_EQ(kitamasa(c, {3}, 20).val(), (unsigned)(3LL << 20));
+        return true;
+    });
+}
+
+void stress_test_linear_recurrence(TestRunner& runner) {
+    runner.set_module("Linear Recurrence - Stress Testing");
+
+    runner.test("Berlekamp-Massey recovers random recurrences", []() {
+        StressTester stress;
+        for (int t = 0; t < 50; t++) {
+            int d = stress.random_int(1, 30);
+            vector<mint> c(d), init(d);
+            for (auto& x : c) x = mint(stress.random_ll(0, mint::mod() - 1));
+            for (auto& x : init) x = mint(stress.random_ll(0, mint::mod() - 1));
+            auto s = naive_terms(c, init, 2 * d + 10);
+            auto got = berlekamp_massey(vector<mint>(s.begin(), s.begin() + 2 * d));
+            if (int(got.size()) > d) return false;
+            if (naive_terms(got, s, 2 * d + 10) != s) return false;
+        }
+        return true;
+    });
+
+    runner.test("Kitamasa vs iteration and companion matrix", []() {
+        StressTester stress;
+        for (int t = 0; t < 30; t++) {
+            int d = stress.random_int(1, 12);
+            vector<mint> c(d), init(d);
+            for (auto& x : c) x = mint(stress.random_ll(0, mint::mod() - 1));
+            for (auto& x : init) x = mint(stress.random_ll(0, mint::mod() - 1));
+            auto s = naive_terms(c, init, 300);
+            for (int k : {0, d - 1, d, 57, 299})
+                if (kitamasa(c, init, k) != s[k]) return false;
+            unsigned long long k = stress.random_ll(0, LLONG_MAX);
+            Matrix<mint> comp(d, d);
+            for (int j = 0; j < d; j++) comp[0][j] = c[j];
+            for (int i = 1; i < d; i++) comp[i][i - 1] = 1;
+            // state (s[i+d-1], ..., s[i]) -> advance k - (d - 1) steps from (s[d-1], ..., s[0])
+            vector<mint> state(init.rbegin(), init.rend());
+            mint expect = k < (unsigned long long)d ? init[k] : (comp.pow(k - (d - 1)) * state)[0];
+            if (kitamasa(c, init, k) != expect) return false;
+        }
+        return true;
+    });
+}
+
+void test_linear_recurrence_performance(TestRunner& runner) {
+    runner.set_module("Linear Recurrence - Performance");
+
+    runner.test("Order 1000 recurrence, k = 10^18", []() {
+        StressTester stress;
+        int d = 1000;
+        vector<mint> c(d), init(d);
+        for (auto& x : c) x = mint(stress.random_ll(0, mint::mod() - 1));
+        for (auto& x : init) x = mint(stress.random_ll(0, mint::mod() - 1));
+        auto s = naive_terms(c, init, 2 * d);
+        ASSERT_TRUE(berlekamp_massey(s) == c);
+        mint a = kitamasa(c, init, 1000000000000000000ULL);
+        ASSERT_TRUE(a == linear_recurrence_nth(s, 1000000000000000000ULL));
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_linear_recurrence_basic(runner);
+    stress_test_linear_recurrence(runner);
+    test_linear_recurrence_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
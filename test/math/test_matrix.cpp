@@ -0,0 +1,126 @@
+#include "../test_runner.h"
+#include "math/matrix.hpp"
+#include <vector>
+
+using namespace std;
+
+// Naive reference implementation
+template <typename T>
+Matrix<T> naive_mul(const Matrix<T>& x, const Matrix<T>& y) {
+    Matrix<T> c(x.n, y.m);
+    for (int i = 0; i < x.n; i++)
+        for (int j = 0; j < y.m; j++)
+            for (int k = 0; k < x.m; k++)
+                c[i][j] += x[i][k] * y[k][j];
+    return c;
+}
+
+template <typename T>
+Matrix<T> random_matrix(StressTester& stress, int n, int m, long long hi) {
+    Matrix<T> a(n, m);
+    for (auto& x : a.a)
+        x = T(stress.random_ll(0, hi));
+    return a;
+}
+
+void test_matrix_basic(TestRunner& runner) {
+    runner.set_module("Matrix - Basic");
+
+    runner.test("Fibonacci by power", []() {
+        using mint = modint1000000007;
+        Matrix<mint> f(2, 2);
+        f[0][0] = f[0][1] = f[1][0] = 1;
+        ASSERT_EQ(f.pow(10)[0][1].val(), 55u);
+        ASSERT_EQ(f.pow(90)[0][1].val(), (unsigned)(2880067194370816120ULL % 1000000007));
+        ASSERT_TRUE(f.pow(0) == Matrix<mint>::identity(2));
+        return true;
+    });
+
+    runner.test("Fixed size", []() {
+        using mint = modint998244353;
+        Matrix<mint, 2> g = {{1, 1, 1, 0}};
+        ASSERT_EQ(g.pow(10)[0][1].val(), 55u);
+        ASSERT_TRUE((g * Matrix<mint, 2>::identity() == g));
+        return true;
+    });
+
+    runner.test("Rectangular product and matrix-vector", []() {
+        Matrix<long long> a(2, 3), b(3, 1);
+        a.a = {1, 2, 3, 4, 5, 6};
+        b.a = {1, 0, -1};
+        auto c = a * b;
+        ASSERT_EQ(c.n, 2);
+        ASSERT_EQ(c.m, 1);
+        ASSERT_EQ(c[0][0], -2LL);
+        ASSERT_EQ(c[1][0], -2LL);
+        auto v = a * vector<long long>{1, 1, 1};
+        ASSERT_EQ(v[1], 15LL);
+        ASSERT_TRUE(a.transpose().transpose() == a);
+        return true;
+    });
+}
+
+void stress_test_matrix(TestRunner& runner) {
+    runner.set_module("Matrix - Stress Testing");
+
+    runner.test("Delayed reduction vs naive (several moduli)", []() {
+        StressTester stress;
+        using m1 = modint998244353;
+        using m2 = static_modint<2147483647>;   // 4 products per chunk
+        using m3 = static_modint<1 << 30>;      // even: no Montgomery
+        using dm = dynamic_modint<33>;
+        for (int t = 0; t < 20; t++) {
+            int n = stress.random_int(1, 70), k = stress.random_int(1, 70), m = stress.random_int(1, 70);
+            auto a1 = random_matrix<m1>(stress, n, k, LLONG_MAX), b1 = random_matrix<m1>(stress, k, m, LLONG_MAX);
+            if (!(a1 * b1 == naive_mul(a1, b1))) return false;
+            auto a2 = random_matrix<m2>(stress, n, k, LLONG_MAX), b2 = random_matrix<m2>(stress, k, m, LLONG_MAX);
+            if (!(a2 * b2 == naive_mul(a2, b2))) return false;
+            auto a3 = random_matrix<m3>(stress, n, k, LLONG_MAX), b3 = random_matrix<m3>(stress, k, m, LLONG_MAX);
+            if (!(a3 * b3 == naive_mul(a3, b3))) return false;
+            dm::set_mod(stress.random_int(1, INT_MAX));
+            auto a4 = random_matrix<dm>(stress, n, k, LLONG_MAX), b4 = random_matrix<dm>(stress, k, m, LLONG_MAX);
+            if (!(a4 * b4 == naive_mul(a4, b4))) return false;
+        }
+        return true;
+    });
+
+    runner.test("pow vs repeated products, fixed vs dynamic", []() {
+        StressTester stress;
+        using mint = modint998244353;
+        for (int t = 0; t < 20; t++) {
+            auto a = random_matrix<mint>(stress, 4, 4, mint::mod() - 1);
+            int e = stress.random_int(0, 40);
+            auto expect = Matrix<mint>::identity(4);
+            for (int i = 0; i < e; i++) expect = naive_mul(expect, a);
+            if (!(a.pow(e) == expect)) return false;
+            Matrix<mint, 4> f;
+            copy(a.a.begin(), a.a.end(), f.a.begin());
+            auto fp = f.pow(e);
+            if (!equal(fp.a.begin(), fp.a.end(), expect.a.begin())) return false;
+        }
+        return true;
+    });
+}
+
+void test_matrix_performance(TestRunner& runner) {
+    runner.set_module("Matrix - Performance");
+
+    runner.test("200 x 200 to the power 10^18", []() {
+        StressTester stress;
+        using mint = modint1000000007;
+        auto a = random_matrix<mint>(stress, 200, 200, mint::mod() - 1);
+        auto p = a.pow(1000000000000000000ULL);
+        // A^e commutes with A
+        ASSERT_TRUE(p * a == a * p);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_matrix_basic(runner);
+    stress_test_matrix(runner);
+    test_matrix_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,137 @@
+#include "../test_runner.h"
+#include "math/modular.hpp"
+#include <vector>
+
+using namespace std;
+
+// Naive modular arithmetic for comparison
+long long naive_mul(long long a, long long b, long long m) { return (__int128)a * b % m; }
+
+long long naive_pow(long long a, long long e, long long m) {
+    long long r = 1 % m;
+    a %= m;
+    while (e) {
+        if (e & 1) r = naive_mul(r, a, m);
+        a = naive_mul(a, a, m);
+        e >>= 1;
+    }
+    return r;
+}
+
+void test_static_modint(TestRunner& runner) {
+    runner.set_module("Modular - static_modint");
+
+    runner.test("Basic arithmetic mod 998244353", []() {
+        using mint = modint998244353;
+        mint a = 5, b = -3;
+        ASSERT_EQ((a + b).val(), 2u);
+        ASSERT_EQ((b - a).val(), 998244353u - 8);
+        ASSERT_EQ((a * b).val(), 998244353u - 15);
+        ASSERT_EQ((a / a).val(), 1u);
+        ASSERT_EQ((-mint(0)).val(), 0u);
+        ASSERT_EQ(mint(3).pow(998244352).val(), 1u);
+        ASSERT_TRUE(mint(7) * mint(7).inv() == mint(1));
+        return true;
+    });
+
+    runner.test("Compile-time evaluation", []() {
+        constexpr modint1000000007 x = modint1000000007(2).pow(1000000);
+        static_assert(x.val() == 235042059);
+        constexpr auto y = modint1000000007(10).inv();
+        static_assert((y * 10).val() == 1);
+        ASSERT_EQ(x.val(), 235042059u);
+        return true;
+    });
+
+    runner.test("Even and tiny moduli use the plain path", []() {
+        using m1 = static_modint<1 << 20>;
+        ASSERT_EQ((m1(1 << 19) * m1(6)).val(), 0u);
+        ASSERT_EQ((m1(5) * m1(5).inv()).val(), 1u);
+        using m2 = static_modint<1>;
+        ASSERT_EQ((m2(5) * m2(7)).val(), 0u);
+        return true;
+    });
+
+    runner.test("Stream I/O", []() {
+        stringstream ss("-1");
+        modint998244353 a;
+        ss >> a;
+        stringstream out;
+        out << a;
+        ASSERT_EQ(out.str(), string("998244352"));
+        return true;
+    });
+}
+
+void test_dynamic_modint(TestRunner& runner) {
+    runner.set_module("Modular - dynamic_modint");
+
+    runner.test("Barrett with runtime modulus", []() {
+        using mint = dynamic_modint<7>;
+        mint::set_mod(1000003);
+        mint a = 123456789, b = -987654321LL;
+        ASSERT_EQ(a.val(), 123456789u % 1000003);
+        ASSERT_EQ((a * b).val(), (unsigned)(((123456789LL % 1000003) * ((-987654321LL % 1000003 + 1000003) % 1000003)) % 1000003));
+        ASSERT_TRUE(a / b * b == a);
+        mint::set_mod(2);
+        ASSERT_EQ(mint(5).val(), 1u);
+        return true;
+    });
+
+    runner.test("64-bit Montgomery", []() {
+        using mint = dynamic_modint64<3>;
+        const uint64_t m = (1ULL << 62) + 135;   // odd
+        mint::set_mod(m);
+        mint a = 0x123456789abcdefLL, b = -5;
+        ASSERT_EQ((a * b).val(), (uint64_t)((unsigned __int128)0x123456789abcdefULL * (m - 5) % m));
+        ASSERT_TRUE(a * a.inv() == mint(1));
+        ASSERT_EQ(mint(3).pow(m - 1).val(), (uint64_t)naive_pow(3, m - 1, m));
+        return true;
+    });
+
+    runner.test("Batch inversion", []() {
+        vector<modint998244353> xs = {1, 2, 3, 4, 998244352};
+        auto expected = xs;
+        for (auto& x : expected) x = x.inv();
+        batch_inverse(xs);
+        ASSERT_TRUE(xs == expected);
+        return true;
+    });
+}
+
+void stress_test_modular(TestRunner& runner) {
+    runner.set_module("Modular - Stress Testing");
+
+    runner.test("All types vs __int128 reference", []() {
+        StressTester stress;
+        using sm = modint1000000007;
+        using dm = dynamic_modint<11>;
+        using dm64 = dynamic_modint64<11>;
+        for (int t = 0; t < 200; t++) {
+            uint32_t m32 = stress.random_int(1, INT_MAX);
+            uint64_t m64 = stress.random_ll(1, LLONG_MAX / 2) | 1;
+            dm::set_mod(m32);
+            dm64::set_mod(m64);
+            for (int i = 0; i < 100; i++) {
+                long long a = stress.random_ll(LLONG_MIN / 2, LLONG_MAX / 2);
+                long long b = stress.random_ll(LLONG_MIN / 2, LLONG_MAX / 2);
+                auto norm = [](long long x, long long m) { x %= m; return x < 0 ? x + m : x; };
+                if ((sm(a) * sm(b)).val() != naive_mul(norm(a, 1000000007), norm(b, 1000000007), 1000000007)) return false;
+                if ((sm(a) - sm(b)).val() != norm(norm(a, 1000000007) - norm(b, 1000000007), 1000000007)) return false;
+                if ((dm(a) * dm(b)).val() != naive_mul(norm(a, m32), norm(b, m32), m32)) return false;
+                if ((dm64(a) * dm64(b)).val() != (uint64_t)naive_mul(norm(a, m64), norm(b, m64), m64)) return false;
+                if ((dm64(a) + dm64(b)).val() != (uint64_t)((norm(a, m64) + (__int128)norm(b, m64)) % m64)) return false;
+            }
+        }
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_static_modint(runner);
+    test_dynamic_modint(runner);
+    stress_test_modular(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,168 @@
+#include "../test_runner.h"
+#include "math/ntt.hpp"
+#include <vector>
+
+using namespace std;
+
+using mint = modint998244353;
+
+template <typename M>
+vector<M> random_poly(StressTester& stress, int n) {
+    vector<M> a(n);
+    for (auto& x : a)
+        x = M(stress.random_ll(0, M::mod() - 1));
+    return a;
+}
+
+// Runs f once with the AVX2 path (if available) and once forced scalar.
+template <typename M, typename F>
+bool both_paths(F&& f) {
+    bool saved = NTT<M>::use_avx2;
+    bool ok = true;
+    for (bool simd : {true, false}) {
+        NTT<M>::use_avx2 = simd && ntt_cpu_has_avx2();
+        ok = ok && f();
+    }
+    NTT<M>::use_avx2 = saved;
+    return ok;
+}
+
+void test_ntt_basic(TestRunner& runner) {
+    runner.set_module("NTT - Basic");
+
+    runner.test("Primitive roots", []() {
+        static_assert(primitive_root(998244353) == 3);
+        static_assert(primitive_root(754974721) == 11);
+        static_assert(primitive_root(167772161) == 3);
+        ASSERT_EQ(primitive_root(469762049), 3u);
+        return true;
+    });
+
+    runner.test("Small products", []() {
+        vector<mint> a = {1, 2, 3}, b = {4, 5};
+        auto c = convolution(a, b);
+        ASSERT_EQ((int)c.size(), 4);
+        ASSERT_EQ(c[0].val(), 4u);
+        ASSERT_EQ(c[1].val(), 13u);
+        ASSERT_EQ(c[2].val(), 22u);
+        ASSERT_EQ(c[3].val(), 15u);
+        ASSERT_TRUE(convolution(a, vector<mint>{}).empty());
+        return true;
+    });
+
+    runner.test("Forward then inverse is identity for every size", []() {
+        StressTester stress;
+        return both_paths<mint>([&]() {
+            for (int n = 1; n <= (1 << 12); n *= 2) {
+                auto a = random_poly<mint>(stress, n), b = a;
+                NTT<mint>::forward(b);
+                NTT<mint>::inverse(b);
+                if (a != b)
+                    return false;
+            }
+            return true;
+        });
+    });
+
+    runner.test("Transform of x is the roots of unity", []() {
+        // bit-reversed output: sum of the transform of x^1 is 0, of x^0 is n
+        int n = 64;
+        vector<mint> a(n);
+        a[1] = 1;
+        NTT<mint>::forward(a);
+        mint s = 0;
+        for (auto x : a)
+            s += x;
+        ASSERT_TRUE(s == mint(0));
+        ASSERT_TRUE(a[0] == mint(1));
+        return true;
+    });
+
+    runner.test("Arbitrary modulus", []() {
+        using m7 = modint1000000007;
+        vector<m7> a = {m7(-1), m7(-1)}, b = {m7(-1), m7(1)};
+        auto c = convolution_arbitrary(a, b);   // (-1 - x)(-1 + x) = 1 - x^2
+        ASSERT_EQ(c[0].val(), 1u);
+        ASSERT_EQ(c[1].val(), 0u);
+        ASSERT_EQ(c[2].val(), 1000000006u);
+        return true;
+    });
+}
+
+void stress_test_ntt(TestRunner& runner) {
+    runner.set_module("NTT - Stress Testing");
+
+    runner.test("convolution vs naive (both paths)", []() {
+        StressTester stress;
+        return both_paths<mint>([&]() {
+            for (int t = 0; t < 60; t++) {
+                int n = stress.random_int(1, 600), m = stress.random_int(1, 600);
+                auto a = random_poly<mint>(stress, n), b = random_poly<mint>(stress, m);
+                if (convolution(a, b) != convolution_naive(a, b))
+                    return false;
+                if (convolution(a, a) != convolution_naive(a, a))
+                    return false;
+            }
+            return true;
+        });
+    });
+
+    runner.test("Other NTT primes", []() {
+        StressTester stress;
+        using p2 = static_modint<167772161>;
+        using p3 = static_modint<469762049>;
+        for (int t = 0; t < 20; t++) {
+            int n = stress.random_int(41, 300), m = stress.random_int(41, 300);
+            auto a = random_poly<p2>(stress, n), b = random_poly<p2>(stress, m);
+            if (convolution(a, b) != convolution_naive(a, b))
+                return false;
+            auto c = random_poly<p3>(stress, n), d = random_poly<p3>(stress, m);
+            if (convolution(c, d) != convolution_naive(c, d))
+                return false;
+        }
+        return true;
+    });
+
+    runner.test("convolution_arbitrary vs naive (static and dynamic modulus)", []() {
+        StressTester stress;
+        using dm = dynamic_modint<30>;
+        for (int t = 0; t < 30; t++) {
+            dm::set_mod(stress.random_int(2, INT_MAX));
+            int n = stress.random_int(1, 400), m = stress.random_int(1, 400);
+            auto a = random_poly<modint1000000007>(stress, n), b = random_poly<modint1000000007>(stress, m);
+            if (convolution_arbitrary(a, b) != convolution_naive(a, b))
+                return false;
+            vector<dm> c(n), d(m);
+            for (auto& x : c) x = dm(stress.random_ll(0, INT_MAX));
+            for (auto& x : d) x = dm(stress.random_ll(0, INT_MAX));
+            if (convolution_arbitrary(c, d) != convolution_naive(c, d))
+                return false;
+        }
+        return true;
+    });
+}
+
+void test_ntt_performance(TestRunner& runner) {
+    runner.set_module("NTT - Performance");
+
+    runner.test("Product of two 5 * 10^5 polynomials", []() {
+        StressTester stress;
+        auto a = random_poly<mint>(stress, 500000), b = random_poly<mint>(stress, 500000);
+        auto c = convolution(a, b);
+        // check one coefficient directly
+        mint expect = 0;
+        for (int i = 0; i <= 1000; i++)
+            expect += a[i] * b[1000 - i];
+        ASSERT_TRUE(c[1000] == expect);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_ntt_basic(runner);
+    stress_test_ntt(runner);
+    test_ntt_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,189 @@
+#include "../test_runner.h"
+#include "math/polynomial.hpp"
+#include <vector>
+
+using namespace std;
+
+using mint = modint998244353;
+
+vector<mint> random_poly(StressTester& stress, int n) {
+    vector<mint> a(n);
+    for (auto& x : a)
+        x = mint(stress.random_ll(0, mint::mod() - 1));
+    return a;
+}
+
+vector<mint> truncated(vector<mint> a, int n) {
+    a.resize(n);
+    return a;
+}
+
+// Naive reference implementations
+vector<mint> naive_inv(const vector<mint>& f, int n) {
+    vector<mint> g(n);
+    mint i0 = f[0].inv();
+    for (int i = 0; i < n; i++) {
+        mint s = i == 0 ? mint(1) : mint(0);
+        for (int j = 1; j <= i && j < int(f.size()); j++)
+            s -= f[j] * g[i - j];
+        g[i] = s * i0;
+    }
+    return g;
+}
+
+// exp via g' = f' g
+vector<mint> naive_exp(const vector<mint>& f, int n) {
+    vector<mint> g(n);
+    g[0] = 1;
+    for (int i = 1; i < n; i++) {
+        mint s = 0;
+        for (int k = 1; k <= i && k < int(f.size()); k++)
+            s += mint(k) * f[k] * g[i - k];
+        g[i] = s * mint(i).inv();
+    }
+    return g;
+}
+
+void test_polynomial_basic(TestRunner& runner) {
+    runner.set_module("Polynomial - Basic");
+
+    runner.test("Inverse of 1 + x", []() {
+        auto g = poly_inv(vector<mint>{1, 1}, 5);
+        vector<mint> expect = {1, -1, 1, -1, 1};
+        ASSERT_TRUE(g == expect);
+        return true;
+    });
+
+    runner.test("log(1 + x) and exp back", []() {
+        auto l = poly_log(vector<mint>{1, 1}, 4);
+        vector<mint> expect = {0, 1, -mint(2).inv(), mint(3).inv()};
+        ASSERT_TRUE(l == expect);
+        auto e = poly_exp(l, 4);
+        vector<mint> back = {1, 1, 0, 0};
+        ASSERT_TRUE(e == back);
+        return true;
+    });
+
+    runner.test("Division with remainder", []() {
+        // x^3 + 2x + 5 = (x^2 + x + 3)(x - 1) + 8
+        vector<mint> a = {5, 2, 0, 1}, b = {-1, 1};
+        auto [q, r] = poly_divmod(a, b);
+        ASSERT_TRUE(q == (vector<mint>{3, 1, 1}));
+        ASSERT_TRUE(r == (vector<mint>{8}));
+        auto [q2, r2] = poly_divmod(b, a);
+        ASSERT_TRUE(q2.empty());
+        ASSERT_TRUE(r2 == b);
+        return true;
+    });
+
+    runner.test("Multipoint evaluation small", []() {
+        auto ys = multipoint_eval(vector<mint>{1, 1}, vector<mint>{0, 1, 2});
+        ASSERT_TRUE(ys == (vector<mint>{1, 2, 3}));
+        return true;
+    });
+}
+
+void stress_test_polynomial(TestRunner& runner) {
+    runner.set_module("Polynomial - Stress Testing");
+
+    runner.test("poly_inv vs naive", []() {
+        StressTester stress;
+        for (int t = 0; t < 30; t++) {
+            int n = stress.random_int(1, 300);
+            auto f = random_poly(stress, stress.random_int(1, 300));
+            if (f[0] == mint(0))
+                f[0] = 1;
+            if (poly_inv(f, n) != naive_inv(f, n))
+                return false;
+        }
+        return true;
+    });
+
+    runner.test("poly_exp vs naive, log inverts exp", []() {
+        StressTester stress;
+        for (int t = 0; t < 20; t++) {
+            int n = stress.random_int(1, 250);
+            auto f = random_poly(stress, stress.random_int(1, 250));
+            f[0] = 0;
+            auto e = poly_exp(f, n);
+            if (e != naive_exp(f, n))
+                return false;
+            if (poly_log(e, n) != truncated(f, n))
+                return false;
+        }
+        return true;
+    });
+
+    runner.test("poly_divmod reconstructs the dividend", []() {
+        StressTester stress;
+        for (int t = 0; t < 30; t++) {
+            auto a = random_poly(stress, stress.random_int(1, 500));
+            auto b = random_poly(stress, stress.random_int(1, 300));
+            if (b.back() == mint(0))
+                b.back() = 1;
+            auto [q, r] = poly_divmod(a, b);
+            if (int(r.size()) >= int(b.size()))
+                return false;
+            auto back = q.empty() ? vector<mint>() : convolution(q, b);
+            back.resize(max(back.size(), r.size()));
+            for (int i = 0; i < int(r.size()); i++)
+                back[i] += r[i];
+            back.resize(a.size());
+            if (back != a)
+                return false;
+        }
+        return true;
+    });
+
+    runner.test("multipoint_eval vs Horner", []() {
+        StressTester stress;
+        for (int t = 0; t < 10; t++) {
+            auto f = random_poly(stress, stress.random_int(1, 700));
+            auto xs = random_poly(stress, stress.random_int(1, 700));
+            auto ys = multipoint_eval(f, xs);
+            for (int i = 0; i < int(xs.size()); i++) {
+                mint y = 0;
+                for (int j = int(f.size()) - 1; j >= 0; j--)
+                    y = y * xs[i] + f[j];
+                if (y != ys[i])
+                    return false;
+            }
+        }
+        return true;
+    });
+}
+
+void test_polynomial_performance(TestRunner& runner) {
+    runner.set_module("Polynomial - Performance");
+
+    runner.test("exp of length 2 * 10^5", []() {
+        StressTester stress;
+        int n = 200000;
+        auto f = random_poly(stress, n);
+        f[0] = 0;
+        auto e = poly_exp(f, n);
+        ASSERT_TRUE(e[0] == mint(1));
+        ASSERT_TRUE(e[1] == f[1]);
+        return true;
+    });
+
+    runner.test("multipoint_eval with 5 * 10^4 points", []() {
+        StressTester stress;
+        auto f = random_poly(stress, 50000), xs = random_poly(stress, 50000);
+        auto ys = multipoint_eval(f, xs);
+        mint y = 0;
+        for (int j = int(f.size()) - 1; j >= 0; j--)
+            y = y * xs[123] + f[j];
+        ASSERT_TRUE(ys[123] == y);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_polynomial_basic(runner);
+    stress_test_polynomial(runner);
+    test_polynomial_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,160 @@
+#include "../test_runner.h"
+#include "math/prime_sieve.hpp"
+#include <vector>
+
+using namespace std;
+
+// Naive reference implementations
+vector<char> naive_is_prime(int n) {
+    vector<char> p(n + 1, 1);
+    p[0] = 0;
+    if (n >= 1) p[1] = 0;
+    for (long long i = 2; i * i <= n; i++)
+        if (p[i])
+            for (long long j = i * i; j <= n; j += i) p[j] = 0;
+    return p;
+}
+
+bool trial_division(uint64_t x) {
+    if (x < 2) return false;
+    for (uint64_t d = 2; d * d <= x; d++)
+        if (x % d == 0) return false;
+    return true;
+}
+
+void test_prime_sieve_basic(TestRunner& runner) {
+    runner.set_module("Prime Sieve - Basic");
+
+    runner.test("First primes", []() {
+        auto p = primes_up_to(30);
+        vector<uint64_t> expect = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29};
+        ASSERT_TRUE(p == expect);
+        ASSERT_TRUE(primes_up_to(1).empty());
+        ASSERT_EQ((int)primes_up_to(2).size(), 1);
+        return true;
+    });
+
+    runner.test("Known counts", []() {
+        ASSERT_EQ(count_primes(1, 1000000), 78498ULL);
+        ASSERT_EQ(count_primes(0, 10000000, 4), 664579ULL);
+        ASSERT_EQ(count_primes(7, 7), 1ULL);
+        ASSERT_EQ(count_primes(8, 10), 0ULL);
+        ASSERT_EQ(prime_pi(1000000), 78498ULL);
+        ASSERT_EQ(prime_pi(2), 1ULL);
+        ASSERT_EQ(prime_pi(1), 0ULL);
+        return true;
+    });
+
+    runner.test("Linear sieve factorization", []() {
+        LinearSieve ls(1000);
+        auto f = ls.factorize(360);
+        ASSERT_TRUE(f == (vector<pair<int, int>>{{2, 3}, {3, 2}, {5, 1}}));
+        ASSERT_TRUE(ls.factorize(1).empty());
+        ASSERT_TRUE(ls.is_prime(997));
+        ASSERT_FALSE(ls.is_prime(999));
+        ASSERT_EQ((int)ls.primes.size(), 168);
+        return true;
+    });
+}
+
+void stress_test_prime_sieve(TestRunner& runner) {
+    runner.set_module("Prime Sieve - Stress Testing");
+
+    runner.test("Random ranges vs naive sieve", []() {
+        StressTester stress;
+        const int N = 3000000;
+        auto ref = naive_is_prime(N);
+        for (int t = 0; t < 40; t++) {
+            uint64_t lo = stress.random_int(0, N), hi = stress.random_int(0, N);
+            if (lo > hi) swap(lo, hi);
+            if (t % 4 == 0) hi = min<uint64_t>(N, lo + stress.random_int(0, 200));
+            int threads = stress.random_int(1, 4);
+            vector<char> seen(N + 1, 0);
+            bool ok = true;
+            mutex mu;
+            for_each_prime(lo, hi, [&](uint64_t p) {
+                lock_guard<mutex> lock(mu);
+                if (p < lo || p > hi || seen[p]) ok = false;
+                else seen[p] = 1;
+            }, threads);
+            for (uint64_t x = lo; x <= hi; x++)
+                if (seen[x] != ref[x]) return false;
+            if (!ok) return false;
+            uint64_t expect = count(ref.begin() + lo, ref.begin() + hi + 1, 1);
+            if (count_primes(lo, hi, threads) != expect) return false;
+        }
+        return true;
+    });
+
+    runner.test("Single thread streams in increasing order", []() {
+        uint64_t last = 0;
+        bool ok = true;
+        for_each_prime(0, 2000000, [&](uint64_t p) { ok = ok && p > last; last = p; });
+        ASSERT_TRUE(ok);
+        ASSERT_EQ(last, 1999993ULL);
+        return true;
+    });
+
+    runner.test("Windows near 10^12 vs trial division", []() {
+        StressTester stress;
+        for (int t = 0; t < 3; t++) {
+            uint64_t lo = 1000000000000ULL + stress.random_ll(0, 1000000000LL);
+            uint64_t hi = lo + 500;
+            vector<uint64_t> got;
+            for_each_prime(lo, hi, [&](uint64_t p) { got.push_back(p); });
+            vector<uint64_t> expect;
+            for (uint64_t x = lo; x <= hi; x++)
+                if (trial_division(x)) expect.push_back(x);
+            if (got != expect) return false;
+        }
+        return true;
+    });
+
+    runner.test("prime_pi vs sieve count", []() {
+        StressTester stress;
+        for (int t = 0; t < 30; t++) {
+            uint64_t n = stress.random_ll(0, 20000000);
+            if (prime_pi(n) != count_primes(0, n)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Linear sieve vs naive", []() {
+        const int N = 1000000;
+        LinearSieve ls(N);
+        auto ref = naive_is_prime(N);
+        for (int x = 2; x <= N; x++) {
+            if (ls.is_prime(x) != bool(ref[x])) return false;
+            int y = 1;
+            for (auto [p, e] : ls.factorize(x)) {
+                if (!ref[p]) return false;
+                while (e--) y *= p;
+            }
+            if (y != x) return false;
+        }
+        return true;
+    });
+}
+
+void test_prime_sieve_performance(TestRunner& runner) {
+    runner.set_module("Prime Sieve - Performance");
+
+    runner.test("count_primes up to 10^9", []() {
+        ASSERT_EQ(count_primes(0, 1000000000, 0), 50847534ULL);
+        return true;
+    });
+
+    runner.test("prime_pi(10^12)", []() {
+        ASSERT_EQ(prime_pi(1000000000000ULL), 37607912018ULL);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_prime_sieve_basic(runner);
+    stress_test_prime_sieve(runner);
+    test_prime_sieve_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
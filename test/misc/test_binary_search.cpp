@@ -0,0 +1,148 @@
+#include "../test_runner.h"
+#include "misc/binary_search.hpp"
+#include "data-structures/offline_convex_hull_trick.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Naive reference implementation
+template <typename T>
+int naive_lower_bound(const vector<T>& a, T x) {
+    int i = 0;
+    while (i < int(a.size()) && a[i] < x) i++;
+    return i;
+}
+
+template <typename T>
+vector<T> random_sorted(StressTester& stress, int n, int range) {
+    vector<T> a(n);
+    for (auto& x : a) x = T(stress.random_int(-range, range));
+    sort(a.begin(), a.end());
+    return a;
+}
+
+template <typename T>
+bool stress_type(StressTester& stress, int max_n, int range) {
+    for (int t = 0; t < 200; t++) {
+        auto a = random_sorted<T>(stress, stress.random_int(0, max_n), range);
+        Eytzinger<T> e(a);
+        STree<T> st(a);
+        auto check = [&](T x) {
+            int expect = naive_lower_bound(a, x);
+            return branchless_lower_bound(a.begin(), a.end(), x) - a.begin() == expect &&
+                   e.lower_bound(x) == expect && st.lower_bound(x) == expect;
+        };
+        for (int q = 0; q < 100; q++)
+            if (!check(T(stress.random_int(-range - 2, range + 2)))) return false;
+        if (!check(numeric_limits<T>::max()) || !check(numeric_limits<T>::lowest())) return false;
+    }
+    return true;
+}
+
+void test_binary_search_basic(TestRunner& runner) {
+    runner.set_module("Binary search - Basic");
+
+    runner.test("Static layouts, small", []() {
+        vector<int> a = {1, 3, 3, 3, 7, 9};
+        Eytzinger<int> e(a);
+        STree<int> st(a);
+        for (int x = 0; x <= 10; x++) {
+            int expect = lower_bound(a.begin(), a.end(), x) - a.begin();
+            ASSERT_EQ(int(branchless_lower_bound(a.begin(), a.end(), x) - a.begin()), expect);
+            ASSERT_EQ(e.lower_bound(x), expect);
+            ASSERT_EQ(st.lower_bound(x), expect);
+        }
+        vector<int> empty;
+        ASSERT_EQ(Eytzinger<int>(empty).lower_bound(5), 0);
+        ASSERT_EQ(STree<int>(empty).lower_bound(5), 0);
+        return true;
+    });
+
+    runner.test("Binary search on the answer", []() {
+        ASSERT_EQ(first_true(0, 100, [](int x) { return x * x >= 50; }), 8);
+        ASSERT_EQ(first_true(0, 100, [](int) { return false; }), 100);
+        ASSERT_EQ(first_true(-5LL, 5LL, [](long long) { return true; }), -5LL);
+        long long big = first_true(0LL, 1LL << 62, [](long long x) { return x >= 1234567890123LL; });
+        ASSERT_EQ(big, 1234567890123LL);
+        ASSERT_EQ(first_true_parallel(0LL, 1LL << 62, [](long long x) { return x >= 987654321LL; }, 4), 987654321LL);
+        double r = bisect_real(0, 2, [](double x) { return x * x >= 2; });
+        ASSERT_TRUE(r * r >= 2 && nextafter(r, 0.0) * nextafter(r, 0.0) < 2);
+        double neg = bisect_real(-1e300, 1e300, [](double x) { return x >= -3.5e-200; });
+        ASSERT_TRUE(neg == -3.5e-200);
+        return true;
+    });
+
+    runner.test("Offline convex hull trick queries", []() {
+        StressTester stress;
+        for (int t = 0; t < 100; t++) {
+            // distinct slopes: get() is what changed here, not add()
+            vector<pair<long long, long long>> ls;
+            for (int k = -50; k <= 50; k++)
+                if (stress.random_int(0, 3) == 0) ls.push_back({k, stress.random_int(-1000, 1000)});
+            if (ls.empty()) ls.push_back({0, 0});
+            offline_convex_hull cht;
+            for (auto [k, b] : ls) cht.add(k, b);
+            for (int q = 0; q < 50; q++) {
+                long long x = stress.random_int(-100, 100), best = LLONG_MIN;
+                for (auto [k, b] : ls) best = max(best, k * x + b);
+                if (cht.get(x) != best) return false;
+            }
+        }
+        return true;
+    });
+}
+
+void stress_test_binary_search(TestRunner& runner) {
+    runner.set_module("Binary search - Stress Testing");
+
+    runner.test("int keys (AVX2 S-tree) vs naive", []() {
+        StressTester stress;
+        return stress_type<int>(stress, 3000, 1000);
+    });
+    runner.test("long long keys vs naive", []() {
+        StressTester stress;
+        return stress_type<long long>(stress, 3000, 100000);
+    });
+    runner.test("unsigned / short / double keys vs naive", []() {
+        StressTester stress;
+        return stress_type<unsigned>(stress, 600, 1000) && stress_type<short>(stress, 600, 300) &&
+               stress_type<double>(stress, 600, 1000);
+    });
+
+    runner.test("first_true_parallel vs first_true", []() {
+        StressTester stress;
+        for (int t = 0; t < 200; t++) {
+            int lo = stress.random_int(-1000, 1000), hi = lo + stress.random_int(0, 2000);
+            int target = stress.random_int(lo - 5, hi + 5);
+            auto pred = [&](int x) { return x >= target; };
+            if (first_true_parallel(lo, hi, pred, stress.random_int(1, 7)) != first_true(lo, hi, pred)) return false;
+        }
+        return true;
+    });
+}
+
+void test_binary_search_performance(TestRunner& runner) {
+    runner.set_module("Binary search - Performance");
+
+    runner.test("10^7 S-tree queries on 10^7 keys", []() {
+        mt19937 rng(5);
+        vector<int> a(10000000);
+        for (auto& x : a) x = int(rng());
+        sort(a.begin(), a.end());
+        STree<int> st(a);
+        long long total = 0;
+        for (int q = 0; q < 10000000; q++) total += st.lower_bound(int(rng()));
+        ASSERT_TRUE(total > 0);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_binary_search_basic(runner);
+    stress_test_binary_search(runner);
+    test_binary_search_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
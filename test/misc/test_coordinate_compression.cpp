@@ -0,0 +1,108 @@
+#include "../test_runner.h"
+#include "misc/coordinate_compression.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Naive reference implementation
+template <typename T>
+vector<T> naive_keys(vector<T> a) {
+    sort(a.begin(), a.end());
+    a.erase(unique(a.begin(), a.end()), a.end());
+    return a;
+}
+
+template <typename T>
+bool matches_naive(const vector<T>& a, const CoordinateCompression<T>& cc) {
+    auto keys = naive_keys(a);
+    if (cc.keys != keys) return false;
+    for (size_t i = 0; i < a.size(); i++)
+        if (cc.rank[i] != lower_bound(keys.begin(), keys.end(), a[i]) - keys.begin()) return false;
+    return true;
+}
+
+void test_coordinate_compression_basic(TestRunner& runner) {
+    runner.set_module("CoordinateCompression - Basic");
+
+    runner.test("Keys, ranks and lookups", []() {
+        vector<int> a = {50, -3, 7, 50, 7, -1000000000};
+        CoordinateCompression cc(a);
+        ASSERT_TRUE(cc.keys == (vector<int>{-1000000000, -3, 7, 50}));
+        ASSERT_TRUE(cc.rank == (vector<int>{3, 1, 2, 3, 2, 0}));
+        ASSERT_EQ(cc.lower_bound(8), 3);
+        ASSERT_EQ(cc.lower_bound(INT_MIN), 0);
+        ASSERT_EQ(cc.lower_bound(51), 4);
+        ASSERT_EQ(cc.find(7), 2);
+        ASSERT_EQ(cc.find(8), -1);
+        return true;
+    });
+
+    runner.test("Empty and single input", []() {
+        CoordinateCompression<long long> e(vector<long long>{});
+        ASSERT_EQ(e.size(), 0);
+        ASSERT_EQ(e.lower_bound(5), 0);
+        ASSERT_EQ(e.find(5), -1);
+        CoordinateCompression<unsigned> s(vector<unsigned>{9, 9, 9});
+        ASSERT_EQ(s.size(), 1);
+        ASSERT_TRUE(s.rank == (vector<int>{0, 0, 0}));
+        return true;
+    });
+}
+
+void stress_test_coordinate_compression(TestRunner& runner) {
+    runner.set_module("CoordinateCompression - Stress Testing");
+
+    runner.test("Random inputs vs sort + unique", []() {
+        StressTester stress;
+        for (int t = 0; t < 200; t++) {
+            int n = stress.random_int(0, 300), range = stress.random_int(1, 1000);
+            vector<long long> a(n);
+            for (auto& x : a) x = (long long)stress.random_int(-range, range) * 1000000007LL;
+            CoordinateCompression cc(a);
+            if (!matches_naive(a, cc)) return false;
+            auto keys = naive_keys(a);
+            for (int q = 0; q < 100; q++) {
+                long long x = (long long)stress.random_int(-range - 1, range + 1) * 1000000007LL + stress.random_int(-1, 1);
+                if (cc.lower_bound(x) != lower_bound(keys.begin(), keys.end(), x) - keys.begin()) return false;
+            }
+        }
+        return true;
+    });
+
+    runner.test("Parallel build matches sequential", []() {
+        StressTester stress;
+        vector<int> a(300000);
+        for (auto& x : a) x = stress.random_int(-50000, 50000);
+        CoordinateCompression seq(a), par(a, 4);
+        ASSERT_TRUE(seq.keys == par.keys);
+        ASSERT_TRUE(seq.rank == par.rank);
+        ASSERT_TRUE(matches_naive(a, par));
+        vector<int> qs(100000);
+        for (auto& x : qs) x = stress.random_int(-60000, 60000);
+        ASSERT_TRUE(seq.ranks(qs) == par.ranks(qs, 4));
+        return true;
+    });
+}
+
+void test_coordinate_compression_performance(TestRunner& runner) {
+    runner.set_module("CoordinateCompression - Performance");
+
+    runner.test("10^7 64-bit keys", []() {
+        mt19937_64 rng(3);
+        vector<long long> a(10000000);
+        for (auto& x : a) x = rng() % 1000000000000LL;
+        CoordinateCompression cc(a, 0);
+        ASSERT_EQ(cc.keys[cc.rank[12345]], a[12345]);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_coordinate_compression_basic(runner);
+    stress_test_coordinate_compression(runner);
+    test_coordinate_compression_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
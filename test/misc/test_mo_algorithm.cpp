@@ -0,0 +1,190 @@
+#include "../test_runner.h"
+#include "misc/mo_algorithm.hpp"
+#include <vector>
+#include <set>
+
+using namespace std;
+
+// Naive reference implementations
+int naive_distinct(const vector<int>& a, int l, int r) {
+    return set<int>(a.begin() + l, a.begin() + r).size();
+}
+
+vector<int> naive_path(const vector<int>& parent, const vector<int>& depth, int u, int v) {
+    vector<int> res;
+    while (u != v) {
+        if (depth[u] < depth[v]) swap(u, v);
+        res.push_back(u);
+        u = parent[u];
+    }
+    res.push_back(u);
+    return res;
+}
+
+// Distinct-count state shared by the tests.
+struct Distinct {
+    vector<int> cnt;
+    int distinct = 0;
+    Distinct(int maxv) : cnt(maxv, 0) {}
+    void add(int x) { distinct += cnt[x]++ == 0; }
+    void remove(int x) { distinct -= --cnt[x] == 0; }
+};
+
+vector<pair<int, int>> random_ranges(StressTester& stress, int n, int q) {
+    vector<pair<int, int>> qs(q);
+    for (auto& [l, r] : qs) {
+        l = stress.random_int(0, n);
+        r = stress.random_int(0, n);
+        if (l > r) swap(l, r);
+    }
+    return qs;
+}
+
+void test_mo_basic(TestRunner& runner) {
+    runner.set_module("Mo's algorithm - Basic");
+
+    runner.test("Hilbert order visits every cell once", []() {
+        for (int lg : {1, 2, 3, 4}) {
+            int side = 1 << lg;
+            vector<int> seen(side * side, 0);
+            vector<pair<int, int>> cell(side * side);
+            for (int x = 0; x < side; x++)
+                for (int y = 0; y < side; y++) {
+                    uint64_t d = hilbert_order(x, y, lg);
+                    if (d >= uint64_t(side * side) || seen[d]++) return false;
+                    cell[d] = {x, y};
+                }
+            for (int d = 1; d < side * side; d++)   // consecutive cells are adjacent
+                if (abs(cell[d].first - cell[d - 1].first) + abs(cell[d].second - cell[d - 1].second) != 1) return false;
+        }
+        return true;
+    });
+
+    runner.test("Distinct values, small", []() {
+        vector<int> a = {1, 2, 1, 3, 2, 2, 4};
+        vector<pair<int, int>> qs = {{0, 7}, {0, 3}, {2, 5}, {4, 6}, {3, 3}};
+        for (MoOrder mode : {MoOrder::hilbert, MoOrder::block}) {
+            Distinct d(5);
+            vector<int> ans(qs.size());
+            mo(a.size(), qs, [&](int i) { d.add(a[i]); }, [&](int i) { d.remove(a[i]); },
+               [&](int q) { ans[q] = d.distinct; }, mode);
+            ASSERT_TRUE(ans == (vector<int>{4, 2, 3, 1, 0}));
+        }
+        return true;
+    });
+}
+
+void stress_test_mo(TestRunner& runner) {
+    runner.set_module("Mo's algorithm - Stress Testing");
+
+    runner.test("Range distinct vs naive, both orders", []() {
+        StressTester stress;
+        for (int t = 0; t < 50; t++) {
+            int n = stress.random_int(1, 200), maxv = stress.random_int(1, 20);
+            vector<int> a(n);
+            for (auto& x : a) x = stress.random_int(0, maxv - 1);
+            auto qs = random_ranges(stress, n, 300);
+            for (MoOrder mode : {MoOrder::hilbert, MoOrder::block}) {
+                Distinct d(maxv);
+                vector<int> ans(qs.size());
+                mo(n, qs, [&](int i) { d.add(a[i]); }, [&](int i) { d.remove(a[i]); },
+                   [&](int q) { ans[q] = d.distinct; }, mode);
+                for (size_t q = 0; q < qs.size(); q++)
+                    if (ans[q] != naive_distinct(a, qs[q].first, qs[q].second)) return false;
+            }
+        }
+        return true;
+    });
+
+    runner.test("Mo with updates vs naive", []() {
+        StressTester stress;
+        for (int t = 0; t < 50; t++) {
+            int n = stress.random_int(1, 100), maxv = stress.random_int(1, 10);
+            vector<int> a(n);
+            for (auto& x : a) x = stress.random_int(0, maxv - 1);
+            int u = stress.random_int(0, 100);
+            vector<pair<int, int>> upd(u);   // (position, new value)
+            for (auto& [p, v] : upd) p = stress.random_int(0, n - 1), v = stress.random_int(0, maxv - 1);
+            auto ranges = random_ranges(stress, n, 200);
+            vector<array<int, 3>> qs;
+            for (auto [l, r] : ranges) qs.push_back({l, r, stress.random_int(0, u)});
+
+            vector<int> cur = a;
+            auto swapped = upd;   // apply() swaps values so that it undoes itself
+            Distinct d(maxv);
+            vector<int> ans(qs.size());
+            mo_with_updates(
+                n, qs, u, [&](int i) { d.add(cur[i]); }, [&](int i) { d.remove(cur[i]); },
+                [&](int k, int l, int r) {
+                    auto& [p, v] = swapped[k];
+                    if (l <= p && p < r) d.remove(cur[p]), d.add(v);
+                    swap(cur[p], v);
+                },
+                [&](int q) { ans[q] = d.distinct; });
+
+            for (size_t q = 0; q < qs.size(); q++) {
+                vector<int> b = a;
+                for (int k = 0; k < qs[q][2]; k++) b[upd[k].first] = upd[k].second;
+                if (ans[q] != naive_distinct(b, qs[q][0], qs[q][1])) return false;
+            }
+        }
+        return true;
+    });
+
+    runner.test("Mo on trees vs naive paths", []() {
+        StressTester stress;
+        for (int t = 0; t < 50; t++) {
+            int n = stress.random_int(1, 120), maxv = stress.random_int(1, 10);
+            vector<pair<int, int>> edges;
+            for (int v = 1; v < n; v++) edges.push_back({stress.random_int(max(0, v - 5), v - 1), v});
+            CSRGraph g(n, edges, true);
+            int root = stress.random_int(0, n - 1);
+            vector<int> color(n);
+            for (auto& c : color) c = stress.random_int(0, maxv - 1);
+            vector<pair<int, int>> qs(200);
+            for (auto& [u, v] : qs) u = stress.random_int(0, n - 1), v = stress.random_int(0, n - 1);
+
+            Distinct d(maxv);
+            vector<int> ans(qs.size());
+            mo_on_tree(g, root, qs, [&](int v) { d.add(color[v]); }, [&](int v) { d.remove(color[v]); },
+                       [&](int q) { ans[q] = d.distinct; });
+
+            auto dfs = dfs_order(g, root);
+            vector<int> depth(n, 0);
+            for (int v : dfs.pre)
+                if (dfs.parent[v] >= 0) depth[v] = depth[dfs.parent[v]] + 1;
+            for (size_t q = 0; q < qs.size(); q++) {
+                set<int> cs;
+                for (int v : naive_path(dfs.parent, depth, qs[q].first, qs[q].second)) cs.insert(color[v]);
+                if (ans[q] != int(cs.size())) return false;
+            }
+        }
+        return true;
+    });
+}
+
+void test_mo_performance(TestRunner& runner) {
+    runner.set_module("Mo's algorithm - Performance");
+
+    runner.test("2*10^5 distinct-count queries on 2*10^5 elements", []() {
+        StressTester stress;
+        int n = 200000;
+        vector<int> a(n);
+        for (auto& x : a) x = stress.random_int(0, 1000);
+        auto qs = random_ranges(stress, n, 200000);
+        Distinct d(1001);
+        long long total = 0;
+        mo(n, qs, [&](int i) { d.add(a[i]); }, [&](int i) { d.remove(a[i]); }, [&](int) { total += d.distinct; });
+        ASSERT_TRUE(total > 0);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_mo_basic(runner);
+    stress_test_mo(runner);
+    test_mo_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
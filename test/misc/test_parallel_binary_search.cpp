@@ -0,0 +1,153 @@
+#include "../test_runner.h"
+#include "misc/parallel_binary_search.hpp"
+#include "data-structures/fenwick_tree.hpp"
+#include "data-structures/LazySegmentTreeRangeSum.hpp"
+#include <vector>
+
+using namespace std;
+
+// Meteors-style instance: updates add v to the sectors [l, r], member i owns
+// some sectors and is done once their total reaches need[i].
+struct Instance {
+    int n = 0;
+    vector<array<long long, 3>> upd;   // {l, r, v}
+    vector<vector<int>> owned;
+    vector<long long> need;
+};
+
+// Naive reference implementation
+vector<int> naive_answers(const Instance& in) {
+    int T = in.upd.size(), q = in.need.size();
+    vector<long long> a(in.n, 0);
+    vector<int> ans(q, T + 1);
+    for (int t = 0; t <= T; t++) {
+        for (int i = 0; i < q; i++) {
+            if (ans[i] <= T) continue;
+            long long s = 0;
+            for (int p : in.owned[i]) s += a[p];
+            if (s >= in.need[i]) ans[i] = t;
+        }
+        if (t < T)
+            for (int p = in.upd[t][0]; p <= in.upd[t][1]; p++) a[p] += in.upd[t][2];
+    }
+    return ans;
+}
+
+Instance random_instance(StressTester& stress, int n, int T, int q) {
+    Instance in;
+    in.n = n;
+    in.upd.resize(T);
+    for (auto& [l, r, v] : in.upd) {
+        l = stress.random_int(0, n - 1), r = stress.random_int(0, n - 1);
+        if (l > r) swap(l, r);
+        v = stress.random_int(0, 10);
+    }
+    in.owned.resize(q);
+    for (int p = 0; p < n; p++) in.owned[stress.random_int(0, q - 1)].push_back(p);
+    for (int i = 0; i < q; i++) in.need.push_back(stress.random_int(0, 40 * n / q + 5));
+    return in;
+}
+
+vector<int> fenwick_answers(const Instance& in, int threads) {
+    using F = FenwickTree<long long>;
+    return parallel_binary_search(
+        in.need.size(), in.upd.size(), [&]() { return F(in.n + 1); },
+        [&](F& f, int t) {
+            auto [l, r, v] = in.upd[t];
+            f.add(l, v), f.add(r + 1, -v);
+        },
+        [&](F& f, int i) {
+            long long s = 0;
+            for (int p : in.owned[i])
+                if ((s += f.prefix_sum(p)) >= in.need[i]) return true;
+            return s >= in.need[i];
+        },
+        threads);
+}
+
+void test_parallel_binary_search_basic(TestRunner& runner) {
+    runner.set_module("Parallel binary search - Basic");
+
+    runner.test("Point adds, prefix thresholds", []() {
+        vector<pair<int, int>> upd = {{0, 1}, {2, 5}, {1, 1}, {0, 3}};
+        vector<int> pos = {0, 2, 3, 1};
+        vector<long long> need = {1, 7, 100, 0};
+        auto ans = parallel_binary_search(
+            4, upd.size(), []() { return FenwickTree<long long>(4); },
+            [&](FenwickTree<long long>& f, int t) { f.add(upd[t].first, upd[t].second); },
+            [&](FenwickTree<long long>& f, int i) { return f.prefix_sum(pos[i]) >= need[i]; });
+        ASSERT_TRUE(ans == (vector<int>{1, 3, 5, 0}));
+        return true;
+    });
+
+    runner.test("No updates, no queries", []() {
+        auto none = parallel_binary_search(
+            0, 5, []() { return 0; }, [](int&, int) {}, [](int&, int) { return true; });
+        ASSERT_TRUE(none.empty());
+        auto never = parallel_binary_search(
+            2, 0, []() { return 0; }, [](int&, int) {}, [](int&, int i) { return i == 0; });
+        ASSERT_TRUE(never == (vector<int>{0, 1}));
+        return true;
+    });
+}
+
+void stress_test_parallel_binary_search(TestRunner& runner) {
+    runner.set_module("Parallel binary search - Stress Testing");
+
+    runner.test("Fenwick range adds vs naive replay", []() {
+        StressTester stress;
+        for (int t = 0; t < 100; t++) {
+            auto in = random_instance(stress, stress.random_int(1, 40), stress.random_int(0, 40), stress.random_int(1, 15));
+            auto expect = naive_answers(in);
+            if (fenwick_answers(in, 1) != expect) return false;
+            if (fenwick_answers(in, stress.random_int(2, 5)) != expect) return false;
+        }
+        return true;
+    });
+
+    runner.test("LazyRangeSum range thresholds vs naive replay", []() {
+        StressTester stress;
+        for (int t = 0; t < 100; t++) {
+            auto in = random_instance(stress, stress.random_int(1, 40), stress.random_int(0, 40), 1);
+            int q = stress.random_int(1, 15);
+            vector<array<int, 2>> range(q);
+            in.owned.assign(q, {});
+            in.need.assign(q, 0);
+            for (int i = 0; i < q; i++) {
+                int l = stress.random_int(0, in.n - 1), r = stress.random_int(0, in.n - 1);
+                if (l > r) swap(l, r);
+                range[i] = {l, r};
+                for (int p = l; p <= r; p++) in.owned[i].push_back(p);
+                in.need[i] = stress.random_int(0, 100);
+            }
+            auto ans = parallel_binary_search(
+                q, in.upd.size(), [&]() { return LazyRangeSum<long long>(in.n); },
+                [&](LazyRangeSum<long long>& s, int t) { s.range_add(in.upd[t][0], in.upd[t][1], in.upd[t][2]); },
+                [&](LazyRangeSum<long long>& s, int i) { return s.range_sum(range[i][0], range[i][1]) >= in.need[i]; },
+                2);
+            if (ans != naive_answers(in)) return false;
+        }
+        return true;
+    });
+}
+
+void test_parallel_binary_search_performance(TestRunner& runner) {
+    runner.set_module("Parallel binary search - Performance");
+
+    runner.test("10^5 members, 10^5 sectors, 10^5 updates", []() {
+        StressTester stress;
+        auto in = random_instance(stress, 100000, 100000, 100000);
+        auto ans = fenwick_answers(in, 0);
+        ASSERT_EQ(int(ans.size()), 100000);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_parallel_binary_search_basic(runner);
+    stress_test_parallel_binary_search(runner);
+    test_parallel_binary_search_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,91 @@
+// Instrumentation is compiled in for this file only, whatever the build option.
+#ifndef CP_PERF
+#define CP_PERF
+#endif
+#include "../test_runner.h"
+#include "misc/perf_counters.hpp"
+#include "data-structures/LazySegmentTreeRangeMax.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+static volatile long long sink;
+
+static void busy_loop(long long n) {
+    for (long long i = 0; i < n; i++) sink = sink + i;
+}
+
+static long long event_delta(const map<string, long long>& before, const string& name) {
+    auto after = perf_event_counts();
+    auto it = before.find(name);
+    return after[name] - (it == before.end() ? 0 : it->second);
+}
+
+void test_perf_counters_basic(TestRunner& runner) {
+    runner.set_module("Perf counters - Basics");
+
+    runner.test("Counters measure a loop or report unavailable", []() {
+        PerfCounters pc;
+        PerfSample a = pc.read();
+        busy_loop(1000000);
+        PerfSample d = pc.read() - a;
+        for (int e = 0; e < PERF_EVENTS; e++) ASSERT_EQ(d.has(PerfEvent(e)), pc.available(PerfEvent(e)));
+        if (d.has(PERF_TASK_CLOCK)) ASSERT_TRUE(d[PERF_TASK_CLOCK] > 0);
+        if (d.has(PERF_INSTRUCTIONS)) ASSERT_TRUE(d[PERF_INSTRUCTIONS] >= 1000000);
+        ASSERT_FALSE(perf_format(d).empty());
+        ASSERT_EQ(perf_format(PerfSample{}), string("perf counters unavailable"));
+        return true;
+    });
+
+    runner.test("Scopes accumulate per name", []() {
+        perf_reset();
+        for (int i = 0; i < 3; i++) {
+            CP_PERF_SCOPE("loop");
+            busy_loop(10000);
+        }
+        ostringstream out;
+        perf_report(out);
+        ASSERT_TRUE(out.str().find("loop x3") != string::npos);
+        return true;
+    });
+
+    runner.test("Event counters and deltas", []() {
+        auto before = perf_event_counts();
+        for (int i = 0; i < 5; i++) CP_PERF_COUNT("test event");
+        ASSERT_EQ(event_delta(before, "test event"), 5LL);
+        ASSERT_EQ(perf_event_delta(before, perf_event_counts()), string("test event 5"));
+        ASSERT_EQ(perf_event_delta(before, perf_event_counts(), 2), string("test event 2.50 (per op)"));
+        return true;
+    });
+}
+
+void test_perf_counters_structures(TestRunner& runner) {
+    runner.set_module("Perf counters - Structure events");
+
+    runner.test("Segment tree visits and pushes", []() {
+        vector<int> a = {5, 1, 4, 2, 8, 3, 7, 6};
+        auto max_func = [](int x, int y) { return max(x, y); };
+        LazyRangeMax<int, decltype(max_func)> st(a, INT_MIN, max_func);
+        auto before = perf_event_counts();
+        ASSERT_EQ(st.range_query(0, 7), 8);   // the root covers it
+        ASSERT_EQ(event_delta(before, "LazyRangeMax visit"), 1LL);
+        before = perf_event_counts();
+        ASSERT_EQ(st.range_query(0, 0), 5);   // root, then two children per level
+        ASSERT_EQ(event_delta(before, "LazyRangeMax visit"), 7LL);
+        ASSERT_EQ(event_delta(before, "LazyRangeMax push"), 0LL);
+        st.range_add(0, 7, 1);
+        before = perf_event_counts();
+        ASSERT_EQ(st.range_query(0, 0), 6);   // one pending tag per level on the path
+        ASSERT_EQ(event_delta(before, "LazyRangeMax push"), 3LL);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_perf_counters_basic(runner);
+    test_perf_counters_structures(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,193 @@
+#include "../test_runner.h"
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+using namespace std;
+
+void set_threads(int t) {
+    string arg = "--threads=" + to_string(t);
+    char* argv[] = {nullptr, arg.data()};
+    StressTester::configure(2, argv);
+}
+
+// Replays case i of the run_cases call named name; (-1, "") turns it off.
+void set_replay(long long i, const string& name) {
+    string c = "--case=" + to_string(i), o = "--only=" + name;
+    char* argv[] = {nullptr, c.data(), o.data()};
+    StressTester::configure(3, argv);
+}
+
+// First draw of every case, filled in by run_cases.
+vector<int> first_draws(StressTester& tester, int n) {
+    vector<int> v(n);
+    tester.run_cases("record draws", n, [&](StressTester& rng, long long i) {
+        v[i] = rng.random_int(0, 1 << 30);
+        return true;
+    });
+    return v;
+}
+
+void test_stress_tester_basic(TestRunner& runner) {
+    runner.set_module("StressTester - Basic");
+
+    runner.test("Streams are determined by the seed", []() {
+        StressTester a(12345), b(12345), c(12346);
+        vector<int> x(10), y(10), z(10);
+        for (int i = 0; i < 10; i++) x[i] = a.random_int(0, 1 << 30), y[i] = b.random_int(0, 1 << 30), z[i] = c.random_int(0, 1 << 30);
+        ASSERT_TRUE(x == y);
+        ASSERT_TRUE(x != z);
+        ASSERT_TRUE(a.case_seed(7) == b.case_seed(7) && a.case_seed(7) != a.case_seed(8));
+        return true;
+    });
+
+    runner.test("Case streams do not depend on the thread count", []() {
+        StressTester tester(99);
+        set_threads(1);
+        auto one = first_draws(tester, 2000);
+        set_threads(4);
+        auto four = first_draws(tester, 2000);
+        set_threads(0);
+        ASSERT_TRUE(one == four);
+        sort(one.begin(), one.end());
+        ASSERT_TRUE(unique(one.begin(), one.end()) - one.begin() > 1990);
+        return true;
+    });
+
+    runner.test("Smallest failing case is reported", []() {
+        StressTester tester(5);
+        for (int t : {1, 3, 8}) {
+            set_threads(t);
+            bool ok = tester.run_cases("fails at 777 and later", 5000, [](StressTester&, long long i) {
+                if (i == 4000) throw runtime_error("boom");
+                return i < 777 || i % 3 != 0;
+            });
+            ASSERT_FALSE(ok);
+            ASSERT_EQ(tester.get_failed_case(), 777LL);
+        }
+        set_threads(0);
+        ASSERT_TRUE(tester.run_cases("passes", 100, [](StressTester&) { return true; }));
+        ASSERT_EQ(tester.get_failed_case(), -1LL);
+        return true;
+    });
+
+    runner.test("Replay runs one case of the named call only", []() {
+        StressTester tester(5);
+        set_replay(800, "target");
+        bool other = tester.run_cases("other", 1000, [](StressTester&) { return false; });
+        vector<long long> seen;
+        bool target = tester.run_cases("target", 5000, [&](StressTester&, long long i) {
+            seen.push_back(i);
+            return true;
+        });
+        bool too_few = tester.run_cases("target", 100, [](StressTester&) { return true; });
+        set_replay(-1, "");
+        ASSERT_TRUE(other);
+        ASSERT_TRUE(target);
+        ASSERT_TRUE(seen == vector<long long>{800});
+        ASSERT_FALSE(too_few);
+        ASSERT_EQ(tester.get_failed_case(), -1LL);
+        return true;
+    });
+}
+
+// Prefix sums with a planted bug: range adds of 4+ elements skip the last one.
+StressCase random_ops(StressTester& rng) {
+    StressCase c;
+    int n = rng.random_int(1, 40);
+    for (int i = 0; i < n; i++) c.array.push_back(rng.random_int(-1000, 1000));
+    c.index_fields = {1, 2};
+    for (int k = rng.random_int(1, 60); k--;) {
+        auto [l, r] = rng.random_range(n);
+        c.ops.push_back({rng.random_int(1, 2), l, r, rng.random_int(-1000, 1000)});
+    }
+    return c;
+}
+
+bool buggy_matches_naive(const StressCase& c) {
+    vector<long long> good = c.array, bad = c.array;
+    for (auto& op : c.ops) {
+        if (op[0] == 1) {
+            for (long long i = op[1]; i <= op[2]; i++) good[i] += op[3];
+            for (long long i = op[1]; i <= op[2] - (op[2] - op[1] >= 3); i++) bad[i] += op[3];
+        } else {
+            long long g = 0, b = 0;
+            for (long long i = op[1]; i <= op[2]; i++) g += good[i], b += bad[i];
+            if (g != b) return false;
+        }
+    }
+    return true;
+}
+
+void test_stress_tester_shrinking(TestRunner& runner) {
+    runner.set_module("StressTester - Shrinking");
+    setenv("STRESS_CASE_DIR", filesystem::temp_directory_path().c_str(), 1);
+
+    runner.test("Array shrinks to the smallest failing values", []() {
+        StressCase c;
+        for (int i = 0; i < 50; i++) c.array.push_back(37 * i % 101);
+        auto fails = [](const StressCase& d) {
+            for (size_t i = 0; i < d.array.size(); i++)
+                for (size_t j = i + 1; j < d.array.size(); j++)
+                    if (d.array[i] + d.array[j] >= 100) return true;
+            return false;
+        };
+        auto small = StressTester::shrink(c, fails);
+        ASSERT_EQ(small.array.size(), size_t(2));
+        ASSERT_EQ(small.array[0] + small.array[1], 100LL);
+        ASSERT_TRUE(StressTester::shrink(c, fails, 1).array == small.array);
+        ASSERT_EQ(small.to_input(), "2\n" + to_string(small.array[0]) + " " + to_string(small.array[1]) + "\n");
+        return true;
+    });
+
+    runner.test("Operation sequence shrinks and is saved", []() {
+        StressTester tester(3);
+        ASSERT_FALSE(tester.run_cases("planted range add bug", 2000, random_ops, buggy_matches_naive));
+        ifstream in(filesystem::temp_directory_path() / "planted_range_add_bug.in");
+        long long n, q;
+        ASSERT_TRUE(bool(in >> n >> q));
+        // Four zeros, one range add and one query over all of them.
+        ASSERT_EQ(n, 4LL);
+        ASSERT_EQ(q, 2LL);
+        vector<long long> rest;
+        for (long long x; in >> x;) rest.push_back(x);
+        ASSERT_TRUE(rest == (vector<long long>{0, 0, 0, 0, 1, 1, 4, 1, 2, 1, 4, 0}));
+        return true;
+    });
+
+    runner.test("A case that passes on replay is not saved", []() {
+        StressTester tester(4);
+        auto path = filesystem::temp_directory_path() / "flaky_check.in";
+        filesystem::remove(path);
+        set_threads(1);
+        bool failed_once = false;
+        ASSERT_FALSE(tester.run_cases("flaky check", 100, random_ops, [&](const StressCase&) {
+            return exchange(failed_once, true);
+        }));
+        set_threads(0);
+        ASSERT_EQ(tester.get_failed_case(), 0LL);
+        ASSERT_FALSE(filesystem::exists(path));
+        return true;
+    });
+
+    runner.test("compare_simple shrinks its input array", []() {
+        StressTester tester(8);
+        ASSERT_FALSE(tester.compare_simple<int>(
+            "max of the first five",
+            [](const vector<int>& a) { return *max_element(a.begin(), a.begin() + min<size_t>(5, a.size())); },
+            [](const vector<int>& a) { return *max_element(a.begin(), a.end()); }, 1000, 30, 100));
+        ifstream in(filesystem::temp_directory_path() / "max_of_the_first_five.in");
+        string all((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        ASSERT_EQ(all, string("6\n0 0 0 0 0 1\n"));
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_stress_tester_basic(runner);
+    test_stress_tester_shrinking(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
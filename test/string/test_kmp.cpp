@@ -0,0 +1,186 @@
+#include "../test_runner.h"
+#include "string/kmp.hpp"
+#include <vector>
+#include <string>
+#include <algorithm>
+
+using namespace std;
+
+// Naive reference implementations
+vector<uint64_t> naive_find(const string& s, const string& p) {
+    vector<uint64_t> res;
+    for (size_t i = 0; i + p.size() <= s.size(); i++)
+        if (s.compare(i, p.size(), p) == 0) res.push_back(i);
+    return res;
+}
+
+vector<pair<int, uint64_t>> naive_find_many(const string& s, const vector<string>& ps) {
+    vector<pair<int, uint64_t>> res;
+    for (int id = 0; id < int(ps.size()); id++)
+        for (auto pos : naive_find(s, ps[id])) res.push_back({id, pos});
+    sort(res.begin(), res.end());
+    return res;
+}
+
+// Splits s into random chunks and calls feed(chunk) on each.
+template <typename F>
+void feed_in_chunks(StressTester& stress, const string& s, F feed) {
+    size_t i = 0;
+    while (i < s.size()) {
+        size_t len = stress.random_int(0, 8);
+        feed(string_view(s).substr(i, len));
+        i += len;
+    }
+}
+
+void test_kmp_basic(TestRunner& runner) {
+    runner.set_module("KMP / Aho-Corasick - Basic");
+
+    runner.test("Prefix function", []() {
+        ASSERT_TRUE(prefix_function("aabaaab") == (vector<int>{0, 1, 0, 1, 2, 2, 3}));
+        ASSERT_TRUE(prefix_function("").empty());
+        return true;
+    });
+
+    runner.test("KMP across chunk boundaries", []() {
+        KMP kmp("needle");
+        vector<uint64_t> hits;
+        auto cb = [&](uint64_t pos) { hits.push_back(pos); };
+        kmp.feed("hay nee", cb);
+        kmp.feed("dle hay need", cb);
+        kmp.feed("", cb);
+        kmp.feed("le", cb);
+        ASSERT_TRUE(hits == (vector<uint64_t>{4, 15}));
+        ASSERT_TRUE(KMP::find_all("aaaa", "aa") == (vector<uint64_t>{0, 1, 2}));
+        return true;
+    });
+
+    runner.test("Aho-Corasick classic example", []() {
+        AhoCorasick ac({"he", "she", "his", "hers", "he"});
+        auto res = ac.find_all("ushers");
+        sort(res.begin(), res.end());
+        vector<pair<int, uint64_t>> expect = {{0, 2}, {1, 1}, {3, 2}, {4, 2}};
+        ASSERT_TRUE(res == expect);
+        return true;
+    });
+
+    runner.test("Mapped file and chunked reads", []() {
+        string text = "abc needle xyz needle\n";
+        string path = "/tmp/cp_kmp_test_" + to_string(getpid()) + ".txt";
+        FILE* out = fopen(path.c_str(), "wb");
+        fwrite(text.data(), 1, text.size(), out);
+        fclose(out);
+        {
+            MappedFile file(path);
+            ASSERT_TRUE(file.view() == text);
+            ASSERT_TRUE(KMP::find_all(file.view(), "needle") == (vector<uint64_t>{4, 15}));
+        }
+        KMP kmp("needle");
+        vector<uint64_t> hits;
+        FILE* in = fopen(path.c_str(), "rb");
+        read_chunks(in, 5, [&](string_view chunk) { kmp.feed(chunk, [&](uint64_t pos) { hits.push_back(pos); }); });
+        fclose(in);
+        remove(path.c_str());
+        ASSERT_TRUE(hits == (vector<uint64_t>{4, 15}));
+        ASSERT_TRUE(MappedFile("/nonexistent/file").view().empty());
+        return true;
+    });
+}
+
+void stress_test_kmp(TestRunner& runner) {
+    runner.set_module("KMP / Aho-Corasick - Stress Testing");
+
+    runner.test("KMP chunked vs naive", []() {
+        StressTester stress;
+        for (int t = 0; t < 500; t++) {
+            int sigma = stress.random_int(1, 3);
+            string s = stress.random_string(stress.random_int(0, 300), 'a', char('a' + sigma - 1));
+            string p = stress.random_string(stress.random_int(1, 6), 'a', char('a' + sigma - 1));
+            KMP kmp(p);
+            vector<uint64_t> hits;
+            feed_in_chunks(stress, s, [&](string_view c) { kmp.feed(c, [&](uint64_t pos) { hits.push_back(pos); }); });
+            if (hits != naive_find(s, p)) return false;
+            if (kmp.offset != s.size()) return false;
+        }
+        return true;
+    });
+
+    runner.test("Aho-Corasick chunked vs naive", []() {
+        StressTester stress;
+        for (int t = 0; t < 300; t++) {
+            int sigma = stress.random_int(1, 4);
+            vector<string> ps(stress.random_int(1, 20));
+            for (auto& p : ps) p = stress.random_string(stress.random_int(1, 5), 'a', char('a' + sigma));
+            AhoCorasick ac(ps);
+            string s = stress.random_string(stress.random_int(0, 300), 'a', char('a' + sigma - 1));
+            vector<pair<int, uint64_t>> hits;
+            auto st = ac.stream();
+            feed_in_chunks(stress, s, [&](string_view c) {
+                st.feed(c, [&](int id, uint64_t pos) { hits.push_back({id, pos}); });
+            });
+            sort(hits.begin(), hits.end());
+            if (hits != naive_find_many(s, ps)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Aho-Corasick large chunks (interleaved lanes)", []() {
+        StressTester stress;
+        for (int t = 0; t < 20; t++) {
+            vector<string> ps(stress.random_int(1, 30));
+            for (auto& p : ps) p = stress.random_string(stress.random_int(1, 12), 'a', 'b');
+            AhoCorasick ac(ps);
+            string s = stress.random_string(stress.random_int(20000, 60000), 'a', 'b');
+            vector<pair<int, uint64_t>> hits;
+            auto st = ac.stream();
+            size_t cut = stress.random_int(0, int(s.size()));
+            auto cb = [&](int id, uint64_t pos) {
+                if (!hits.empty() && hits.back().second + ps[hits.back().first].size() > pos + ps[id].size())
+                    hits.push_back({-1, 0});   // out of order
+                hits.push_back({id, pos});
+            };
+            st.feed(string_view(s).substr(0, cut), cb);
+            st.feed(string_view(s).substr(cut), cb);
+            sort(hits.begin(), hits.end());
+            if (hits != naive_find_many(s, ps)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Arbitrary bytes", []() {
+        StressTester stress;
+        string s(2000, '\0');
+        for (auto& c : s) c = char(stress.random_int(0, 255));
+        vector<string> ps = {s.substr(10, 3), s.substr(500, 1), string(1, '\xff'), string(1, '\0')};
+        AhoCorasick ac(ps);
+        auto res = ac.find_all(s);
+        sort(res.begin(), res.end());
+        ASSERT_TRUE(res == naive_find_many(s, ps));
+        return true;
+    });
+}
+
+void test_kmp_performance(TestRunner& runner) {
+    runner.set_module("KMP / Aho-Corasick - Performance");
+
+    runner.test("1000 patterns over 5*10^7 bytes", []() {
+        StressTester stress;
+        string s = stress.random_string(50000000, 'a', 'z');
+        vector<string> ps(1000);
+        for (auto& p : ps) p = stress.random_string(6, 'a', 'z');
+        AhoCorasick ac(ps);
+        long long cnt = 0;
+        ac.stream().feed(s, [&](int, uint64_t) { cnt++; });
+        ASSERT_TRUE(cnt >= 0);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_kmp_basic(runner);
+    stress_test_kmp(runner);
+    test_kmp_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -0,0 +1,130 @@
+#include "../test_runner.h"
+#include "string/rolling_hash.hpp"
+#include <vector>
+#include <string>
+
+using namespace std;
+
+// Naive reference implementations
+size_t naive_lcp(const string& a, size_t i, const string& b, size_t j) {
+    size_t h = 0;
+    while (i + h < a.size() && j + h < b.size() && a[i + h] == b[j + h]) h++;
+    return h;
+}
+
+void test_rolling_hash_basic(TestRunner& runner) {
+    runner.set_module("RollingHash - Basic");
+
+    runner.test("Modular arithmetic", []() {
+        using namespace rolling_hash_detail;
+        ASSERT_EQ(mul(MOD - 1, MOD - 1), 1ULL);
+        ASSERT_EQ(mul(1ULL << 60, 2), 1ULL);
+        ASSERT_EQ(sub(0, 1), MOD - 1);
+        ASSERT_TRUE(HashBase<0>::base != HashBase<1>::base);
+        return true;
+    });
+
+    runner.test("Substring hashes and LCP", []() {
+        string s = "abracadabra";
+        RollingHash h(s);
+        ASSERT_TRUE(h.get(0, 4) == h.get(7, 11));
+        ASSERT_TRUE(h.get(0, 4) != h.get(1, 5));
+        ASSERT_TRUE(h.get(3, 3) == 0);
+        ASSERT_EQ(lcp(h, 0, h, 7), 4u);
+        ASSERT_EQ(lcp(h, 1, h, 8), 3u);
+        ASSERT_TRUE(RollingHash::concat(h.get(0, 2), h.get(2, 4), 2) == h.get(0, 4));
+        RollingHash v(vector<int>{1, 2, 1, 2});
+        ASSERT_TRUE(v.get(0, 2) == v.get(2, 4));
+        return true;
+    });
+
+    runner.test("2-D hash", []() {
+        RollingHash2D g({"abab", "baba", "abab"});
+        ASSERT_TRUE(g.get(0, 0, 2, 2) == g.get(0, 2, 2, 4));
+        ASSERT_TRUE(g.get(0, 0, 2, 2) == g.get(1, 1, 3, 3));
+        ASSERT_TRUE(g.get(0, 0, 2, 2) != g.get(1, 0, 3, 2));
+        // transposed content must differ
+        RollingHash2D t({"ab", "cd"}), u({"ac", "bd"});
+        ASSERT_TRUE(t.get(0, 0, 2, 2) != u.get(0, 0, 2, 2));
+        return true;
+    });
+}
+
+void stress_test_rolling_hash(TestRunner& runner) {
+    runner.set_module("RollingHash - Stress Testing");
+
+    runner.test("Equal hashes iff equal substrings", []() {
+        StressTester stress;
+        for (int t = 0; t < 200; t++) {
+            string s = stress.random_string(stress.random_int(1, 200), 'a', char('a' + stress.random_int(0, 2)));
+            RollingHash h(s);
+            int n = s.size();
+            for (int q = 0; q < 200; q++) {
+                int len = stress.random_int(0, n);
+                int i = stress.random_int(0, n - len), j = stress.random_int(0, n - len);
+                bool eq = s.compare(i, len, s, j, len) == 0;
+                if ((h.get(i, i + len) == h.get(j, j + len)) != eq) return false;
+                if (lcp(h, i, h, j) != naive_lcp(s, i, s, j)) return false;
+            }
+        }
+        return true;
+    });
+
+    runner.test("window_hashes matches get()", []() {
+        StressTester stress;
+        for (int t = 0; t < 100; t++) {
+            string s = stress.random_string(stress.random_int(0, t < 90 ? 300 : 20000), 'a', 'c');
+            int k = stress.random_int(1, 40);
+            auto w = window_hashes(s, k);
+            RollingHash h(s);
+            if (w.size() != (s.size() >= size_t(k) ? s.size() - k + 1 : 0)) return false;
+            for (size_t i = 0; i < w.size(); i++)
+                if (w[i] != h.get(i, i + k)) return false;
+        }
+        return true;
+    });
+
+    runner.test("2-D hash vs block comparison", []() {
+        StressTester stress;
+        for (int t = 0; t < 50; t++) {
+            int n = stress.random_int(1, 15), m = stress.random_int(1, 15);
+            vector<string> g(n);
+            for (auto& row : g) row = stress.random_string(m, 'a', 'b');
+            RollingHash2D h(g);
+            for (int q = 0; q < 200; q++) {
+                int a = stress.random_int(1, n), b = stress.random_int(1, m);
+                int r1 = stress.random_int(0, n - a), c1 = stress.random_int(0, m - b);
+                int r2 = stress.random_int(0, n - a), c2 = stress.random_int(0, m - b);
+                bool eq = true;
+                for (int i = 0; i < a && eq; i++)
+                    eq = g[r1 + i].compare(c1, b, g[r2 + i], c2, b) == 0;
+                if ((h.get(r1, c1, r1 + a, c1 + b) == h.get(r2, c2, r2 + a, c2 + b)) != eq) return false;
+            }
+        }
+        return true;
+    });
+}
+
+void test_rolling_hash_performance(TestRunner& runner) {
+    runner.set_module("RollingHash - Performance");
+
+    runner.test("2*10^6 LCP queries on a 10^6 string", []() {
+        StressTester stress;
+        string s = stress.random_string(1000000, 'a', 'b');
+        RollingHash h(s);
+        size_t total = 0;
+        for (int q = 0; q < 2000000; q++)
+            total += lcp(h, stress.random_int(0, 999999), h, stress.random_int(0, 999999));
+        ASSERT_TRUE(total > 0);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_rolling_hash_basic(runner);
+    stress_test_rolling_hash(runner);
+    test_rolling_hash_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
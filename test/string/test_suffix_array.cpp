@@ -0,0 +1,158 @@
+#include "../test_runner.h"
+#include "string/suffix_array.hpp"
+#include <vector>
+#include <string>
+#include <algorithm>
+
+using namespace std;
+
+// Naive reference implementations
+vector<int> naive_sa(const string& s) {
+    vector<int> sa(s.size());
+    iota(sa.begin(), sa.end(), 0);
+    sort(sa.begin(), sa.end(), [&](int a, int b) { return s.compare(a, string::npos, s, b, string::npos) < 0; });
+    return sa;
+}
+
+int naive_lcp(const string& s, int i, int j) {
+    int h = 0;
+    while (i + h < int(s.size()) && j + h < int(s.size()) && s[i + h] == s[j + h]) h++;
+    return h;
+}
+
+vector<int> naive_occurrences(const string& s, const string& p) {
+    vector<int> res;
+    for (size_t i = 0; i + p.size() <= s.size(); i++)
+        if (s.compare(i, p.size(), p) == 0) res.push_back(i);
+    return res;
+}
+
+void test_suffix_array_basic(TestRunner& runner) {
+    runner.set_module("SuffixArray - Basic");
+
+    runner.test("banana", []() {
+        ASSERT_TRUE(suffix_array(string("banana")) == (vector<int>{5, 3, 1, 0, 4, 2}));
+        ASSERT_TRUE(lcp_array(string("banana"), suffix_array(string("banana"))) == (vector<int>{1, 3, 0, 0, 2}));
+        return true;
+    });
+
+    runner.test("Empty and single character", []() {
+        ASSERT_TRUE(suffix_array(string("")).empty());
+        ASSERT_TRUE(suffix_array(string("z")) == (vector<int>{0}));
+        SuffixArray st("x");
+        ASSERT_EQ(st.lcp_query(0, 0), 1);
+        ASSERT_EQ(st.count("x"), 1);
+        ASSERT_EQ(st.count("xx"), 0);
+        return true;
+    });
+
+    runner.test("LCP queries and pattern lookup", []() {
+        SuffixArray st("mississippi");
+        ASSERT_EQ(st.lcp_query(1, 4), 4);   // "issi(ssippi)" vs "issi(ppi)"
+        ASSERT_EQ(st.lcp_query(2, 3), 1);
+        ASSERT_EQ(st.lcp_query(0, 1), 0);
+        ASSERT_EQ(st.lcp_query(10, 7), 1);
+        ASSERT_EQ(st.count("ss"), 2);
+        ASSERT_EQ(st.count("i"), 4);
+        ASSERT_EQ(st.count("q"), 0);
+        ASSERT_EQ(st.count(""), 11);
+        ASSERT_TRUE(st.occurrences("issi") == (vector<int>{1, 4}));
+        return true;
+    });
+
+    runner.test("Integer alphabet and buffer reuse", []() {
+        vector<int> s = {3, 1, 2, 1, 2, 0, 3, 1, 2, 1, 2, 0, 3};
+        string t;
+        for (int x : s) t += char('a' + x);
+        ASSERT_TRUE(suffix_array(s, 3) == naive_sa(t));
+        vector<int> sa(1000, 7);
+        suffix_array_into("abcab", sa);
+        ASSERT_TRUE(sa == naive_sa("abcab"));
+        return true;
+    });
+}
+
+void stress_test_suffix_array(TestRunner& runner) {
+    runner.set_module("SuffixArray - Stress Testing");
+
+    runner.test("SA and LCP vs naive, small alphabets", []() {
+        StressTester stress;
+        for (int t = 0; t < 600; t++) {
+            int n = stress.random_int(0, 200), sigma = stress.random_int(1, t % 3 == 0 ? 2 : 26);
+            string s = stress.random_string(n, 'a', char('a' + sigma - 1));
+            auto sa = suffix_array(s);
+            if (sa != naive_sa(s)) return false;
+            auto lcp = lcp_array(s, sa);
+            for (int i = 0; i + 1 < n; i++)
+                if (lcp[i] != naive_lcp(s, sa[i], sa[i + 1])) return false;
+        }
+        return true;
+    });
+
+    runner.test("Periodic and Fibonacci strings", []() {
+        vector<string> cases = {string(1000, 'a'), "b"};
+        string a = "a", b = "ab";
+        while (b.size() < 3000) tie(a, b) = make_pair(b, b + a);
+        cases.push_back(b);
+        string p;
+        for (int i = 0; i < 500; i++) p += "abc";
+        cases.push_back(p + "ab");
+        for (auto& s : cases)
+            if (suffix_array(s) != naive_sa(s)) return false;
+        return true;
+    });
+
+    runner.test("lcp_query and occurrences vs naive", []() {
+        StressTester stress;
+        for (int t = 0; t < 100; t++) {
+            string s = stress.random_string(stress.random_int(1, 300), 'a', char('a' + stress.random_int(0, 2)));
+            int n = s.size();
+            SuffixArray st(s);
+            for (int q = 0; q < 100; q++) {
+                int i = stress.random_int(0, n - 1), j = stress.random_int(0, n - 1);
+                if (st.lcp_query(i, j) != naive_lcp(s, i, j)) return false;
+            }
+            for (int q = 0; q < 20; q++) {
+                string p = stress.random_string(stress.random_int(1, 4), 'a', 'c');
+                if (st.occurrences(p) != naive_occurrences(s, p)) return false;
+            }
+        }
+        return true;
+    });
+
+    runner.test("Low-memory mode matches", []() {
+        StressTester stress;
+        string s = stress.random_string(5000, 'a', 'd');
+        SuffixArray full(s), lean(s, true);
+        ASSERT_TRUE(full.sa == lean.sa && full.lcp == lean.lcp);
+        ASSERT_TRUE(lean.rank.empty() && !lean.rmq);
+        ASSERT_EQ(lean.count("abca"), full.count("abca"));
+        return true;
+    });
+}
+
+void test_suffix_array_performance(TestRunner& runner) {
+    runner.set_module("SuffixArray - Performance");
+
+    runner.test("SA + LCP of 10^7 random bytes", []() {
+        StressTester stress;
+        string s = stress.random_string(10000000, 'a', 'd');
+        auto sa = suffix_array(s);
+        auto lcp = lcp_array(s, sa);
+        for (int i = 0; i < 1000; i++) {
+            int k = stress.random_int(0, int(s.size()) - 2);
+            if (s.compare(sa[k], string::npos, s, sa[k + 1], string::npos) >= 0) return false;
+            if (lcp[k] != naive_lcp(s, sa[k], sa[k + 1])) return false;
+        }
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_suffix_array_basic(runner);
+    stress_test_suffix_array(runner);
+    test_suffix_array_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
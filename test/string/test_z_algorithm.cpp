@@ -0,0 +1,112 @@
+#include "../test_runner.h"
+#include "string/z_algorithm.hpp"
+#include <vector>
+#include <string>
+
+using namespace std;
+
+// Naive reference implementations
+vector<int> naive_z(const string& s) {
+    int n = s.size();
+    vector<int> z(n);
+    for (int i = 0; i < n; i++)
+        while (i + z[i] < n && s[z[i]] == s[i + z[i]]) z[i]++;
+    return z;
+}
+
+void test_z_basic(TestRunner& runner) {
+    runner.set_module("Z-function - Basic");
+
+    runner.test("Small strings", []() {
+        ASSERT_TRUE(z_function("aabxaab") == (vector<int>{7, 1, 0, 0, 3, 1, 0}));
+        ASSERT_TRUE(z_function("").empty());
+        ASSERT_TRUE(z_function("a") == (vector<int>{1}));
+        ASSERT_TRUE(z_function<int64_t>("aaa") == (vector<int64_t>{3, 2, 1}));
+        return true;
+    });
+
+    runner.test("Pattern matching without concatenation", []() {
+        ASSERT_TRUE(prefix_match_lengths("aab", "xaabaa") == (vector<int>{0, 3, 1, 0, 2, 1}));
+        ASSERT_TRUE(z_find_all("aa", "aaaa") == (vector<size_t>{0, 1, 2}));
+        ASSERT_TRUE(z_find_all("abc", "ab").empty());
+        ASSERT_TRUE(prefix_match_lengths("abc", "").empty());
+        return true;
+    });
+
+    runner.test("Long runs cross the vector width", []() {
+        for (int n : {31, 32, 33, 63, 64, 65, 100, 1000}) {
+            string s(n, 'a');
+            auto z = z_function(s);
+            for (int i = 0; i < n; i++)
+                if (z[i] != n - i) return false;
+            s[n / 2] = 'b';
+            if (z_function(s) != naive_z(s)) return false;
+        }
+        return true;
+    });
+}
+
+void stress_test_z(TestRunner& runner) {
+    runner.set_module("Z-function - Stress Testing");
+
+    runner.test("z_function vs naive", []() {
+        StressTester stress;
+        for (int t = 0; t < 1000; t++) {
+            string s = stress.random_string(stress.random_int(0, 300), 'a', char('a' + stress.random_int(0, 2)));
+            if (z_function(s) != naive_z(s)) return false;
+        }
+        return true;
+    });
+
+    runner.test("Periodic strings with defects", []() {
+        StressTester stress;
+        for (int t = 0; t < 200; t++) {
+            string unit = stress.random_string(stress.random_int(1, 40), 'a', 'b'), s;
+            int len = stress.random_int(1, 2000);
+            while (int(s.size()) < len) s += unit;
+            for (int d = stress.random_int(0, 3); d > 0; d--) s[stress.random_int(0, int(s.size()) - 1)] = 'z';
+            if (z_function(s) != naive_z(s)) return false;
+        }
+        return true;
+    });
+
+    runner.test("prefix_match_lengths and z_search vs concatenation", []() {
+        StressTester stress;
+        for (int t = 0; t < 500; t++) {
+            int sigma = stress.random_int(1, 3);
+            string p = stress.random_string(stress.random_int(1, 50), 'a', char('a' + sigma - 1));
+            string s = stress.random_string(stress.random_int(0, 400), 'a', char('a' + sigma - 1));
+            auto z = naive_z(p + '#' + s);
+            auto ext = prefix_match_lengths(p, s);
+            vector<size_t> occ;
+            for (size_t i = 0; i < s.size(); i++) {
+                if (ext[i] != z[p.size() + 1 + i]) return false;
+                if (ext[i] == int(p.size())) occ.push_back(i);
+            }
+            if (z_find_all(p, s) != occ) return false;
+        }
+        return true;
+    });
+}
+
+void test_z_performance(TestRunner& runner) {
+    runner.set_module("Z-function - Performance");
+
+    runner.test("Z of 10^8 repetitive bytes", []() {
+        string s;
+        s.reserve(100000000);
+        while (s.size() < 100000000) s += "abcabcabd";
+        auto z = z_function(s);
+        ASSERT_EQ(z[9], int(s.size()) - 9);
+        return true;
+    });
+}
+
+int main(int argc, char** argv) {
+    TestRunner runner(argc, argv);
+    test_z_basic(runner);
+    stress_test_z(runner);
+    test_z_performance(runner);
+    runner.summary();
+    return runner.get_exit_code();
+}
@@ -1,12 +1,20 @@
 #include "test_runner.h"
+#ifdef CP_PERF
+#include "misc/perf_counters.hpp"
+#endif
 #include <iostream>
 #include <chrono>
 #include <iomanip>
+#include <fstream>
 
 using namespace std;
 
 TestRunner::TestRunner() : tests_run(0), tests_passed(0) {}
 
+TestRunner::TestRunner(int argc, char** argv) : TestRunner() {
+    StressTester::configure(argc, argv);
+}
+
 void TestRunner::set_module(const string& module) {
     current_module = module;
     cout << "\n=== Testing " << module << " ===\n";
@@ -17,6 +25,10 @@ void TestRunner::test(const string& test_name, function<bool()> test_func) {
     cout << "Test: " << test_name << " ... ";
     cout.flush();
     
+#ifdef CP_PERF
+    PerfSample perf_start = PerfCounters::thread_local_instance().read();
+    auto events_start = perf_event_counts();
+#endif
     auto start = chrono::high_resolution_clock::now();
     
     try {
@@ -35,6 +47,13 @@ void TestRunner::test(const string& test_name, function<bool()> test_func) {
     } catch (...) {
         cout << "❌ FAILED (Unknown exception)\n";
     }
+#ifdef CP_PERF
+    // Counts the calling thread only, not run_cases workers.
+    cout << "   perf: " << perf_format(PerfCounters::thread_local_instance().read() - perf_start) << "\n";
+    string events = perf_event_delta(events_start, perf_event_counts());
+    if (!events.empty())
+        cout << "   events: " << events << "\n";
+#endif
 }
 
 void TestRunner::summary() {
@@ -51,23 +70,119 @@ void TestRunner::summary() {
     
     double success_rate = tests_run > 0 ? (double)tests_passed / tests_run * 100.0 : 0.0;
     cout << "Success rate: " << fixed << setprecision(1) << success_rate << "%\n";
+#ifdef CP_PERF
+    perf_report(cout);
+#endif
 }
 
 int TestRunner::get_exit_code() {
     return (tests_passed == tests_run) ? 0 : 1;
 }
 
-StressTester::StressTester() : seed(chrono::steady_clock::now().time_since_epoch().count()) {
-    rng.seed(seed);
-    cout << "🧪 Stress tester initialized (seed: " << seed << ")\n";
+namespace {
+
+uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+struct StressConfig {
+    uint64_t seed;
+    int threads;
+    long long only_case = -1;
+    string only_name;
+    atomic<uint64_t> testers{0};
+
+    StressConfig() {
+        const char* s = getenv("STRESS_SEED");
+        seed = s ? stoull(s) : chrono::steady_clock::now().time_since_epoch().count();
+        const char* t = getenv("STRESS_THREADS");
+        threads = t ? stoi(t) : 0;
+        const char* c = getenv("STRESS_CASE");
+        if (c) only_case = stoll(c);
+        const char* o = getenv("STRESS_ONLY");
+        if (o) only_name = o;
+    }
+};
+
+StressConfig& config() {
+    static StressConfig c;
+    return c;
+}
+
+}  // namespace
+
+void StressTester::configure(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg.rfind("--seed=", 0) == 0) config().seed = stoull(arg.substr(7));
+        else if (arg.rfind("--threads=", 0) == 0) config().threads = stoi(arg.substr(10));
+        else if (arg.rfind("--case=", 0) == 0) config().only_case = stoll(arg.substr(7));
+        else if (arg.rfind("--only=", 0) == 0) config().only_name = arg.substr(7);
+    }
+}
+
+uint64_t StressTester::master_seed() { return config().seed; }
+
+int StressTester::threads() {
+    int t = config().threads;
+    return t > 0 ? t : max(1u, thread::hardware_concurrency());
+}
+
+long long StressTester::only_case() { return config().only_case; }
+
+const string& StressTester::only_name() { return config().only_name; }
+
+StressTester::StressTester() {
+    uint64_t stream = config().testers++;
+    reseed(splitmix64(master_seed() ^ splitmix64(stream)));
+    cout << "🧪 Stress tester initialized (STRESS_SEED=" << master_seed() << ", stream " << stream << ")\n";
+}
+
+StressTester::StressTester(uint64_t stream_seed) { reseed(stream_seed); }
+
+void StressTester::reseed(uint64_t stream_seed) {
+    seed = stream_seed;
+    rng.seed(uint32_t(seed ^ (seed >> 32)));
+}
+
+uint64_t StressTester::case_seed(long long case_index) const {
+    return splitmix64(seed + splitmix64(uint64_t(case_index)));
+}
+
+void StressTester::print_reproducer(const string& name, long long case_index) const {
+#ifdef __GLIBC__
+    const char* binary = program_invocation_name;
+#else
+    const char* binary = "<test binary>";
+#endif
+    // Single-quoted for the shell; names are free text.
+    string quoted = "'";
+    for (char ch : name) quoted += ch == '\'' ? string("'\\''") : string(1, ch);
+    quoted += "'";
+    cout << "   reproduce: STRESS_SEED=" << master_seed() << " STRESS_CASE=" << case_index << " STRESS_ONLY=" << quoted
+         << " " << binary << "\n";
+}
+
+StressTester::StressTester(const uint8_t* data, size_t size) : input(data), input_left(size) { reseed(0); }
+
+uint64_t StressTester::from_input(uint64_t range) {
+    // Just enough bytes for the range, so each decision maps to its own bytes.
+    uint64_t v = 0;
+    for (uint64_t r = range; r > 0 && input_left > 0; r >>= 8, input_left--) v = v << 8 | *input++;
+    return range == UINT64_MAX ? v : v % (range + 1);
 }
 
 int StressTester::random_int(int min_val, int max_val) {
+    if (input_left > 0) return int(min_val + (long long)from_input(uint64_t((long long)max_val - min_val)));
     uniform_int_distribution<int> dist(min_val, max_val);
     return dist(rng);
 }
 
 long long StressTester::random_ll(long long min_val, long long max_val) {
+    if (input_left > 0) return (long long)(uint64_t(min_val) + from_input(uint64_t(max_val) - uint64_t(min_val)));
     uniform_int_distribution<long long> dist(min_val, max_val);
     return dist(rng);
 }
@@ -121,4 +236,121 @@ void StressTester::print_progress(int current, int total) {
         cout << "Progress: " << current + 1 << "/" << total 
              << " (" << percent << "%)\n";
     }
-}
\ No newline at end of file
+}
+bool StressCase::valid() const {
+    for (auto& op : ops)
+        for (int f : index_fields)
+            if (f < (int)op.size() && (op[f] < 0 || op[f] >= (long long)array.size())) return false;
+    return true;
+}
+
+string StressCase::to_input(int index_base) const {
+    ostringstream out;
+    out << array.size();
+    if (!ops.empty() || !index_fields.empty()) out << " " << ops.size();
+    out << "\n";
+    for (size_t i = 0; i < array.size(); i++) out << (i ? " " : "") << array[i];
+    out << "\n";
+    for (auto& op : ops) {
+        for (size_t f = 0; f < op.size(); f++) {
+            bool index = find(index_fields.begin(), index_fields.end(), (int)f) != index_fields.end();
+            out << (f ? " " : "") << op[f] + (index ? index_base : 0);
+        }
+        out << "\n";
+    }
+    return out.str();
+}
+
+namespace {
+
+// c without array element p; index fields past p move down by one.
+StressCase erase_element(const StressCase& c, size_t p) {
+    StressCase d = c;
+    d.array.erase(d.array.begin() + p);
+    for (auto& op : d.ops)
+        for (int f : d.index_fields)
+            if (f < (int)op.size() && op[f] > (long long)p) op[f]--;
+    return d;
+}
+
+}  // namespace
+
+StressCase StressTester::shrink(StressCase c, const function<bool(const StressCase&)>& fails, int threads) {
+    threads = threads > 0 ? threads : StressTester::threads();
+    // Applies the first failing candidate, if any.
+    auto take_first = [&](const vector<StressCase>& cand) {
+        long long k = first_failure(cand.size(), threads, [&](StressTester&, long long i) {
+            return cand[i].valid() && fails(cand[i]);
+        });
+        if (k >= 0) c = cand[k];
+        return k >= 0;
+    };
+    // Deletes chunks of len items (halving len when nothing can go) by
+    // remove(c, begin, end).
+    auto delete_chunks = [&](auto size, auto remove) {
+        bool changed = false;
+        for (size_t len = max<size_t>(1, size() / 2); size() > 0;) {
+            vector<StressCase> cand;
+            for (size_t b = 0; b < size(); b += len) cand.push_back(remove(b, min(size(), b + len)));
+            if (take_first(cand)) {
+                changed = true;
+                len = min(len, max<size_t>(1, size() / 2));
+            } else if (len == 1) {
+                break;
+            } else {
+                len /= 2;
+            }
+        }
+        return changed;
+    };
+    auto shrink_values = [&]() {
+        vector<StressCase> cand;
+        auto try_value = [&](long long v, auto set) {
+            for (long long w : {0LL, v / 2, v - (v > 0) + (v < 0)})
+                if (w != v && (w == 0 || abs(w) < abs(v))) {
+                    StressCase d = c;
+                    set(d, w);
+                    cand.push_back(d);
+                }
+        };
+        for (size_t i = 0; i < c.array.size(); i++)
+            try_value(c.array[i], [i](StressCase& d, long long w) { d.array[i] = w; });
+        for (size_t i = 0; i < c.ops.size(); i++)
+            for (size_t f = 1; f < c.ops[i].size(); f++)
+                if (find(c.index_fields.begin(), c.index_fields.end(), (int)f) == c.index_fields.end())
+                    try_value(c.ops[i][f], [i, f](StressCase& d, long long w) { d.ops[i][f] = w; });
+        return take_first(cand);
+    };
+
+    for (bool changed = true; changed;) {
+        changed = delete_chunks([&]() { return c.ops.size(); },
+                                [&](size_t b, size_t e) {
+                                    StressCase d = c;
+                                    d.ops.erase(d.ops.begin() + b, d.ops.begin() + e);
+                                    return d;
+                                });
+        changed |= delete_chunks([&]() { return c.array.size(); },
+                                 [&](size_t b, size_t e) {
+                                     StressCase d = c;
+                                     for (size_t p = e; p-- > b;) d = erase_element(d, p);
+                                     return d;
+                                 });
+        while (shrink_values()) changed = true;
+    }
+    return c;
+}
+
+string StressTester::save_case(const string& name, const string& input) {
+    string file;
+    for (char ch : name) file += isalnum((unsigned char)ch) ? ch : '_';
+    const char* dir = getenv("STRESS_CASE_DIR");
+    string path = string(dir ? dir : ".") + "/" + file + ".in";
+    ofstream(path) << input;
+    return path;
+}
+
+void StressTester::report_shrunk(const string& name, const StressCase& c) {
+    string input = c.to_input();
+    cout << "🔍 Shrunk to " << c.array.size() << " elements, " << c.ops.size() << " operations:\n" << input;
+    cout << "   saved to " << save_case(name, input) << "\n";
+}
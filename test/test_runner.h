@@ -10,6 +10,8 @@ private:
     
 public:
     TestRunner();
+    // Also reads --seed=N, --threads=N, --case=N and --only=NAME (see StressTester).
+    TestRunner(int argc, char** argv);
     
     void set_module(const string& module);
     void test(const string& test_name, function<bool()> test_func);
@@ -17,13 +19,69 @@ public:
     int get_exit_code();
 };
 
+// A stress case in the shape of a CSES input: an initial array and a
+// sequence of operations, one row each. ops[i][0] is the operation type;
+// the fields listed in index_fields are 0-based array positions; every
+// other field is a value. StressTester::shrink understands this layout.
+struct StressCase {
+    vector<long long> array;
+    vector<vector<long long>> ops;
+    vector<int> index_fields;
+    
+    bool valid() const;   // every index field lies inside the array
+    // "n q", the array, one operation per line; indices shifted by index_base.
+    // Array-only cases (no ops, no index fields) print just "n" and the array.
+    string to_input(int index_base = 1) const;
+};
+
+// Random data for stress tests.
+//
+// Every StressTester draws from a stream derived from one master seed:
+// STRESS_SEED (or --seed=N), else the clock. Testers are numbered in
+// construction order, so the same master seed replays the same run.
+//
+// run_cases(name, n, case_fn) shards n independent cases over
+// STRESS_THREADS (or --threads=N, default: all cores) threads. Case i draws
+// from its own stream seeded from the tester's seed and i, so the outcome
+// does not depend on the thread count; the smallest failing case is
+// reported with a command line that replays it alone: STRESS_CASE=i (or
+// --case=i) with STRESS_ONLY=name (or --only=name) runs case i of that
+// run_cases call and skips every other call. Without STRESS_ONLY, case i is
+// replayed in every call that has it.
+// case_fn(rng) or case_fn(rng, i) returns true when the case passes.
+//
+// run_cases(name, n, gen, check) is the same for cases built as a
+// StressCase by gen(rng): a failing case is shrunk (see shrink) and saved as
+// <STRESS_CASE_DIR or .>/<name>.in, ready to drop into a CSES data folder.
+// compare_algorithms shrinks failing vector<int> inputs too, sequentially,
+// since its callbacks share this tester's generator.
 class StressTester {
 private:
     mt19937 rng;
-    unsigned int seed;
+    uint64_t seed;
+    long long failed_case = -1;
+    const uint8_t* input = nullptr;
+    size_t input_left = 0;
+    
+    uint64_t from_input(uint64_t range);
     
 public:
     StressTester();
+    explicit StressTester(uint64_t stream_seed);
+    // Draws come from the bytes first (for libFuzzer inputs), then from a
+    // fixed stream once they run out.
+    StressTester(const uint8_t* data, size_t size);
+    
+    static void configure(int argc, char** argv);
+    static uint64_t master_seed();
+    static int threads();
+    static long long only_case();   // STRESS_CASE, -1 if unset
+    static const string& only_name();   // STRESS_ONLY, empty if unset
+    
+    void reseed(uint64_t stream_seed);
+    uint64_t get_seed() const { return seed; }
+    uint64_t case_seed(long long case_index) const;
+    long long get_failed_case() const { return failed_case; }   // last run_cases, -1 if it passed
     
     int random_int(int min_val, int max_val);
     long long random_ll(long long min_val, long long max_val);
@@ -35,6 +93,112 @@ public:
     
     void print_progress(int current, int total);
     
+    template<typename CaseFn>
+    bool run_cases(const string& name, long long num_cases, CaseFn case_fn) {
+        failed_case = -1;
+        
+        if (only_case() >= 0) {
+            long long i = only_case();
+            bool scoped = !only_name().empty();
+            if (scoped && only_name() != name) return true;
+            if (i >= num_cases) {
+                if (!scoped) return true;
+                cout << "💥 " << name << ": no case " << i << " to replay (" << num_cases << " cases)\n";
+                return false;
+            }
+            StressTester local(case_seed(i));
+            cout << "🔁 " << name << ": replaying case " << i << "\n";
+            return run_one(name, local, i, case_fn);
+        }
+        
+        int workers = int(max(1LL, min<long long>(threads(), (num_cases + 15) / 16)));
+        cout << "🔄 " << name << ": " << num_cases << " cases on " << workers << " threads\n";
+        auto start = chrono::steady_clock::now();
+        
+        long long fail = first_failure(num_cases, workers, [&](StressTester& local, long long i) {
+            local.reseed(case_seed(i));
+            return !passes(local, i, case_fn);
+        });
+        
+        if (fail >= 0) {
+            // Every case below fail passed, so this is the one a sequential
+            // run would hit first; replay it for the details.
+            long long i = failed_case = fail;
+            StressTester local(case_seed(i));
+            if (run_one(name, local, i, case_fn)) {
+                cout << "💥 " << name << ": case " << i << " failed, but passed when replayed (nondeterministic)\n";
+                print_reproducer(name, i);
+            }
+            return false;
+        }
+        double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "✅ " << name << ": " << num_cases << " cases passed ("
+             << llround(num_cases / max(secs, 1e-9)) << " cases/s)\n";
+        return true;
+    }
+    
+    template<typename Gen, typename Check>
+    bool run_cases(const string& name, long long num_cases, Gen gen, Check check) {
+        if (run_cases(name, num_cases, [&](StressTester& rng) { return check(gen(rng)); }))
+            return true;
+        if (failed_case < 0) return false;   // nothing to replay
+        auto fails = [&](const StressCase& d) {
+            try {
+                return !check(d);
+            } catch (...) {
+                return true;
+            }
+        };
+        StressTester local(case_seed(failed_case));
+        StressCase c = gen(local);
+        // A case that passes when regenerated was reported as nondeterministic
+        // above; shrinking it would only save something that does not fail.
+        if (!fails(c)) return false;
+        report_shrunk(name, shrink(c, fails));
+        return false;
+    }
+    
+    // Smallest case that still fails: deletes chunks of operations, then of
+    // array elements (index fields above a deleted position move down, so
+    // ranges keep their elements), then moves values and non-index fields
+    // towards 0, until a full pass changes nothing. Each pass evaluates its
+    // candidates on `threads` threads (0 = threads()) and keeps the first
+    // failing one, so the result does not depend on the thread count.
+    // fails must be deterministic and thread-safe; invalid candidates are
+    // never passed to it.
+    static StressCase shrink(StressCase c, const function<bool(const StressCase&)>& fails, int threads = 0);
+    
+    // Writes input to <STRESS_CASE_DIR or .>/<name>.in; returns the path.
+    static string save_case(const string& name, const string& input);
+    
+    // Smallest i in [0, n) with fails(tester, i), -1 if none. Workers claim
+    // chunks of 16 indices and stop once past the smallest failure so far,
+    // so every index below the result has been checked.
+    template<typename Fails>
+    static long long first_failure(long long n, int workers, Fails fails) {
+        constexpr long long CHUNK = 16;
+        atomic<long long> next{0}, first_fail{LLONG_MAX};
+        auto worker = [&]() {
+            StressTester local(0);
+            long long b;
+            while ((b = next.fetch_add(CHUNK)) < min(n, first_fail.load())) {
+                for (long long i = b; i < min(n, b + CHUNK) && i < first_fail.load(); i++) {
+                    if (fails(local, i)) {
+                        long long cur = first_fail.load();
+                        while (i < cur && !first_fail.compare_exchange_weak(cur, i)) {}
+                        break;
+                    }
+                }
+            }
+        };
+        workers = int(max(1LL, min<long long>(workers, (n + CHUNK - 1) / CHUNK)));
+        vector<thread> pool;
+        for (int t = 1; t < workers; t++) pool.emplace_back(worker);
+        worker();
+        for (auto& th : pool) th.join();
+        return first_fail.load() == LLONG_MAX ? -1 : first_fail.load();
+    }
+    
     template<typename TestData, typename FastAlgo, typename NaiveAlgo>
     bool compare_algorithms(const string& algo_name, 
                           FastAlgo fast_algo, 
@@ -48,14 +212,30 @@ public:
         for (int test = 0; test < num_tests; test++) {
             try {
                 TestData test_data = data_generator();
+                // The algorithms may draw from this tester as well; replaying
+                // from this state makes every shrink candidate deterministic.
+                mt19937 state = rng;
                 
                 auto result_fast = fast_algo(test_data);
                 auto result_naive = naive_algo(test_data);
                 if (result_fast != result_naive) {
-                    cout << "💥 FAILED on test " << test + 1 << "\n";
+                    cout << "💥 FAILED on test " << test + 1 << " (STRESS_SEED=" << master_seed() << ")\n";
                     cout << "Fast result: " << result_fast << "\n";
                     cout << "Naive result: " << result_naive << "\n";
                     print_test_data(test_data);
+                    if constexpr (is_same_v<TestData, vector<int>>) {
+                        StressCase c{vector<long long>(test_data.begin(), test_data.end()), {}, {}};
+                        c = shrink(c, [&](const StressCase& d) {
+                            rng = state;
+                            vector<int> v(d.array.begin(), d.array.end());
+                            try {
+                                return fast_algo(v) != naive_algo(v);
+                            } catch (...) {
+                                return true;
+                            }
+                        }, 1);
+                        report_shrunk(algo_name, c);
+                    }
                     return false;
                 }
                 
@@ -90,6 +270,44 @@ public:
     }
     
 private:
+    template<typename CaseFn>
+    static bool call(CaseFn& case_fn, StressTester& local, long long i) {
+        if constexpr (is_invocable_v<CaseFn&, StressTester&, long long>)
+            return case_fn(local, i);
+        else
+            return case_fn(local);
+    }
+    
+    template<typename CaseFn>
+    static bool passes(StressTester& local, long long i, CaseFn& case_fn) {
+        try {
+            return call(case_fn, local, i);
+        } catch (...) {
+            return false;
+        }
+    }
+    
+    template<typename CaseFn>
+    bool run_one(const string& name, StressTester& local, long long i, CaseFn& case_fn) {
+        string what;
+        bool ok = false;
+        try {
+            ok = call(case_fn, local, i);
+        } catch (const exception& e) {
+            what = e.what();
+        } catch (...) {
+            what = "unknown";
+        }
+        if (ok) return true;
+        failed_case = i;
+        cout << "💥 " << name << ": case " << i << " failed" << (what.empty() ? "" : " (exception: " + what + ")") << "\n";
+        print_reproducer(name, i);
+        return false;
+    }
+    
+    void print_reproducer(const string& name, long long case_index) const;
+    static void report_shrunk(const string& name, const StressCase& c);
+    
     template<typename TestData>
     void print_test_data(const TestData& data) {
         cout << "Test data: ";